@@ -46,6 +46,11 @@ namespace cro
     The AudioMixer also has a master volume channel which
     is applied to all subsequent channels. By default
     AudioEmitter components are assigned to channel 0
+
+    When crogine is built with USE_SOFTWARE_MIXER each channel is
+    mixed as a separate bus, which may additionally be low-pass
+    filtered or ducked by another channel. These settings have no
+    effect with other audio renderers.
     \see AudioEmitter::setChannel()
     */
     class CRO_EXPORT_API AudioMixer final
@@ -116,6 +121,42 @@ namespace cro
         */
         static const std::string& getLabel(std::uint8_t channel);
 
+        /*!
+        \brief Applies a low-pass filter to the given channel, for example
+        to muffle sounds when underwater or indoors.
+        \param cutoff Cutoff frequency in Hz. 0 disables the filter.
+        \param channel ID of the channel (0 - 15) to filter
+        */
+        static void setLowPassCutoff(float cutoff, std::uint8_t channel);
+
+        /*!
+        \brief Returns the low-pass cutoff frequency of the given channel
+        */
+        static float getLowPassCutoff(std::uint8_t channel);
+
+        /*!
+        \brief Ducks the volume of a channel while another channel is
+        producing output, for example to lower effects during voice chat.
+        \param amount Amount, 0 - 1, by which the channel is attenuated
+        when fully ducked. 0 disables ducking.
+        \param channel ID of the channel to duck
+        \param keyChannel ID of the channel whose output triggers the ducking
+        */
+        static void setDucking(float amount, std::uint8_t channel, std::uint8_t keyChannel);
+
+        /*!
+        \brief Returns the ducking amount of the given channel
+        */
+        static float getDuckingAmount(std::uint8_t channel);
+
+        /*!
+        \brief Sets the maximum number of sources which are mixed at once.
+        Once this is exceeded the least audible sources are virtualised -
+        they continue to play but aren't heard until they become audible
+        enough to displace a mixed source.
+        */
+        static void setVoiceBudget(std::uint32_t count);
+
         /*!
         \brief Returns true is a valid audio renderer was found to be available
         */
@@ -134,9 +175,15 @@ namespace cro
         static std::array<std::string, MaxChannels> m_labels;
         static std::array<float, MaxChannels> m_channels;
         static std::array<float, MaxChannels> m_prefadeChannels;
+        static std::array<float, MaxChannels> m_lowPassCutoffs;
+        static std::array<float, MaxChannels> m_duckAmounts;
+        static std::array<std::uint8_t, MaxChannels> m_duckKeys;
         static float m_masterVol;
 
+        static void updateChannel(std::uint8_t);
+
         friend class AudioPlayerSystem;
         friend class AudioSystem;
+        friend class AudioRenderer;
     };
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <crogine/Config.hpp>
+
+#include <cstdint>
+
+namespace cro
+{
+    /*!
+    \brief Counts calls to the global operator new.
+
+    Counting is only available when crogine is built with the CMake option
+    USE_ALLOCATION_COUNTING enabled, which replaces the global operator new
+    and delete with versions which increment a counter before forwarding to
+    malloc() and free(). It is intended for checks which assert that the
+    steady state of a frame makes no heap allocations, and should not be
+    enabled in release builds.
+
+    When crogine is built as a shared library the replacement only applies
+    to the whole process on Linux. On Windows and macOS crogine should be
+    built statically (BUILD_SHARED_LIBS=OFF) so that allocations made by
+    the application are counted as well as those made by the engine.
+    */
+    class CRO_EXPORT_API AllocationCounter final
+    {
+    public:
+        /*!
+        \brief Returns true if crogine was built with allocation counting enabled
+        */
+        static bool isAvailable();
+
+        /*!
+        \brief Returns the number of allocations made by all threads
+        since the program started.
+        */
+        static std::uint64_t getCount();
+
+        /*!
+        \brief Returns the number of allocations made by the calling thread
+        */
+        static std::uint64_t getThreadCount();
+    };
+}
@@ -186,6 +186,13 @@ namespace cro
         */
         void saveSettings();
 
+        /*!
+        \brief Enables or disables saving the window and AudioMixer settings.
+        Useful when the window has been temporarily modified, such as when
+        running an automated benchmark at a fixed resolution. Enabled by default.
+        */
+        void setSaveSettingsEnabled(bool enabled) { m_saveSettings = enabled; }
+
         /*!
         \brief Load and execute an external project from a plugin
         \param path Path to the directory containing the plugin. Shared library name is automatically appended
@@ -210,6 +217,7 @@ namespace cro
         Colour m_clearColour;
         HiResTimer* m_frameClock;
         bool m_running;
+        bool m_saveSettings = true;
 
         void handleEvents();
 
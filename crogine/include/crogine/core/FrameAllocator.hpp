@@ -0,0 +1,128 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <crogine/Config.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace cro
+{
+    /*!
+    \brief Linear arena for scratch data which only lives for a single frame.
+
+    Allocations are made by bumping an offset into a single block of memory,
+    which is reset by the App at the end of every pass of its main loop - so
+    memory allocated during a fixed update is not valid in a later render. Memory is never freed
+    individually. If the block is exhausted during a frame further requests fall
+    back to the heap, and the block is resized to fit at the next reset, so that
+    once the peak per-frame usage has been seen no more heap allocations are made.
+
+    Allocation is thread safe, so the arena may be used by jobs launched with
+    JobSystem::parallelFor(), but anything allocated from it must not be used
+    once the frame has ended. This includes the contents of any member
+    containers - use FrameVector only for locals or for data which is rebuilt
+    every frame before it is read. Jobs which may outlive the frame should not
+    use the arena.
+    */
+    class CRO_EXPORT_API FrameAllocator final
+    {
+    public:
+        struct Stats final
+        {
+            std::size_t capacity = 0; //size of the arena in bytes
+            std::size_t used = 0; //bytes used last frame, including any which fell back to the heap
+            std::size_t peak = 0; //most bytes used in a single frame
+            std::size_t overflowCount = 0; //number of frames which fell back to the heap
+        };
+
+        /*!
+        \brief Returns memory for the current frame.
+        \param size Number of bytes to allocate
+        \param alignment Alignment of the returned memory. Must be a power of two.
+        */
+        static void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        /*!
+        \brief Invalidates all memory allocated during the current frame.
+        This is called automatically by the App at the end of every frame
+        and must not be called while other threads are allocating.
+        */
+        static void reset();
+
+        /*!
+        \brief Resizes the arena. Takes effect at the next reset().
+        The arena starts at 1MB, and grows automatically as needed.
+        */
+        static void reserve(std::size_t bytes);
+
+        /*!
+        \brief Returns the current usage statistics of the arena
+        */
+        static Stats getStats();
+
+        /*!
+        \brief Allocator for standard containers using the frame arena.
+        deallocate() does nothing, so containers should reserve() their
+        expected size up front to avoid wasting arena space as they grow.
+        */
+        template <typename T>
+        class Allocator
+        {
+        public:
+            using value_type = T;
+
+            Allocator() = default;
+
+            template <typename U>
+            Allocator(const Allocator<U>&) {}
+
+            T* allocate(std::size_t count)
+            {
+                return static_cast<T*>(FrameAllocator::allocate(count * sizeof(T), alignof(T)));
+            }
+
+            void deallocate(T*, std::size_t) {}
+
+            template <typename U>
+            bool operator == (const Allocator<U>&) const { return true; }
+
+            template <typename U>
+            bool operator != (const Allocator<U>&) const { return false; }
+        };
+    };
+
+    /*!
+    \brief std::vector which allocates from the FrameAllocator
+    */
+    template <typename T>
+    using FrameVector = std::vector<T, FrameAllocator::Allocator<T>>;
+}
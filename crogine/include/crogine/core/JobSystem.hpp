@@ -0,0 +1,173 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <crogine/Config.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace cro
+{
+    /*!
+    \brief Fixed pool of worker threads shared by the engine and the game.
+
+    One worker is created for each hardware thread, less one for the main
+    thread, when the App is created. Each worker owns a queue from which it
+    takes the most recently added job, and idle workers steal the oldest job
+    from other queues, so that all parallel work in a frame, from Systems
+    or game code, shares the same threads rather than each creating its own.
+
+    Jobs can be tracked with a Counter, which can also be used to delay a
+    job until another set of jobs has finished. If the job system is not
+    running (for example no App has been created) all jobs are executed
+    immediately on the calling thread.
+
+    Jobs should not block waiting on other threads, other than via wait()
+    or parallelFor(), which both run pending work while they wait.
+    Long running loops and blocking I/O such as network or audio streaming
+    should continue to use dedicated threads.
+    */
+    class CRO_EXPORT_API JobSystem final
+    {
+    public:
+        using Job = std::function<void()>;
+
+        /*!
+        \brief Counts the number of incomplete jobs which were
+        scheduled with it. Jobs which depend on a Counter are queued
+        once its count reaches zero.
+        Counters must outlive any jobs which use them.
+        */
+        class CRO_EXPORT_API Counter final
+        {
+        public:
+            Counter() = default;
+
+            Counter(const Counter&) = delete;
+            Counter(Counter&&) = delete;
+            Counter& operator = (const Counter&) = delete;
+            Counter& operator = (Counter&&) = delete;
+
+            /*!
+            \brief Returns true if all jobs scheduled with this counter have completed
+            */
+            bool isComplete() const { return m_count == 0; }
+
+        private:
+            std::atomic<std::int32_t> m_count = 0;
+            std::mutex m_mutex;
+            std::vector<Job> m_dependents;
+
+            friend class JobSystem;
+        };
+
+        /*!
+        \brief Starts the worker threads. This is called automatically
+        by the App
+        \param threadCount Number of workers to create. If this is zero
+        the number is based on the available hardware threads.
+        */
+        static void init(std::size_t threadCount = 0);
+
+        /*!
+        \brief Completes any remaining jobs and stops the worker threads.
+        This is called automatically by the App on shutdown.
+        */
+        static void finalise();
+
+        /*!
+        \brief Returns the number of worker threads, not
+        including the calling thread.
+        */
+        static std::size_t getWorkerCount();
+
+        /*!
+        \brief Schedules a job to be executed by the next available worker.
+        \param job The job to execute
+        \param counter Optional Counter which is incremented now, and
+        decremented once the job has been executed
+        \param dependency Optional Counter which must be complete
+        before this job is queued
+        */
+        static void run(Job job, Counter* counter = nullptr, Counter* dependency = nullptr);
+
+        /*!
+        \brief Blocks until the given Counter is complete, executing
+        any pending jobs on the calling thread while it waits.
+        */
+        static void wait(Counter& counter);
+
+        /*!
+        \brief Calls job once for each index in the range [0, count), split
+        across all workers and the calling thread, and returns once every
+        index has been processed. This is safe to call from within a job.
+        \param count Number of indices to process
+        \param job Function called with each index
+        \param grainSize Number of consecutive indices processed by a worker
+        each time it claims work. If this is zero it is chosen based on the
+        number of workers.
+        */
+        static void parallelFor(std::size_t count, const std::function<void(std::size_t)>& job, std::size_t grainSize = 0);
+
+        /*!
+        \brief Calls func for each element in the range [first, last)
+        in parallel. Requires random access iterators.
+        */
+        template <typename Iterator, typename Func>
+        static void forEach(Iterator first, Iterator last, Func&& func)
+        {
+            const auto count = static_cast<std::size_t>(std::distance(first, last));
+            parallelFor(count, [&](std::size_t i) { func(*(first + i)); });
+        }
+
+        /*!
+        \brief Executes func on a worker thread and returns a std::future
+        containing its result. Note that waiting on the future from within
+        another job blocks that worker - prefer a Counter in this case.
+        */
+        template <typename Func>
+        static auto async(Func&& func) -> std::future<std::invoke_result_t<std::decay_t<Func>>>
+        {
+            using ReturnType = std::invoke_result_t<std::decay_t<Func>>;
+            auto task = std::make_shared<std::packaged_task<ReturnType()>>(std::forward<Func>(func));
+            auto result = task->get_future();
+            run([task]() { (*task)(); });
+            return result;
+        }
+    };
+}
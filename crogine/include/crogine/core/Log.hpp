@@ -39,7 +39,6 @@ source distribution.
 #include <crogine/graphics/Rectangle.hpp>
 
 #include <string>
-#include <list>
 #include <ostream>
 #include <streambuf>
 
@@ -50,6 +49,17 @@ source distribution.
 
 #define FILE_LINE cro::FileSystem::getFileName(__FILE__) << ", line " << __LINE__ << " "
 
+//log levels used to filter messages at compile time. Define CRO_LOG_LEVEL
+//as one of these values to remove the LogI/LogW/LogE/LOG macros below that level
+#define CRO_LOG_LEVEL_INFO 0
+#define CRO_LOG_LEVEL_WARNING 1
+#define CRO_LOG_LEVEL_ERROR 2
+#define CRO_LOG_LEVEL_NONE 3
+
+#ifndef CRO_LOG_LEVEL
+#define CRO_LOG_LEVEL CRO_LOG_LEVEL_INFO
+#endif
+
 namespace cro
 {
     class String;
@@ -57,7 +67,16 @@ namespace cro
     /*!
     \brief Class to allowing messages to be logged to a combination
     of one or more destinations such as the console, log file or
-    output window in Visual Studio
+    output window in Visual Studio.
+
+    Messages are placed in a lock-free queue and written out by a
+    background thread, so logging never waits on the console or disk.
+    The log file, output.log in the preferences directory, is rotated
+    when it grows too large, keeping a few previous files. Messages
+    destined for the in-game console are forwarded on the main thread.
+    If the queue is full informational messages are dropped (and the
+    number dropped is reported) while errors wait for space to become
+    available.
     */
     class CRO_EXPORT_API Logger final
     {
@@ -90,11 +109,22 @@ namespace cro
         */
         static std::ostream& log(Type type = Type::Info);
 
+        /*!
+        \brief Blocks until all queued messages have been written.
+        This is called automatically when the App shuts down.
+        */
+        static void flush();
+
     private:
-        static std::list<std::string> m_buffer;
-        static std::string m_output;
+        friend class App;
+
+        //prints any messages queued for the console. Called by the App
+        //on the main thread as Console is not thread safe.
+        static void printToConsole();
 
-        static void updateOutString(std::size_t maxBuffer);
+        //stops the writer thread once the queue is flushed. Any messages
+        //logged afterwards are written immediately by the calling thread.
+        static void finalise();
     };
 
     namespace Detail
@@ -105,10 +135,17 @@ namespace cro
             LogBuf();
             ~LogBuf();
 
+            //submits any partial line and sets the type of the following lines
+            void setType(Logger::Type);
+
         private:
+            Logger::Type m_type;
+            std::string m_line; //buffers truncated lines between flushes
 
             int overflow(int character) override;
             int sync() override;
+
+            void submitLine();
         };
 
         class LogStream final : public std::ostream
@@ -116,6 +153,8 @@ namespace cro
         public:
             LogStream();
 
+            void setType(Logger::Type type) { m_buffer.setType(type); }
+
         private:
             LogBuf m_buffer;
         };
@@ -157,17 +196,36 @@ std::ostream& operator << (std::ostream& out, cro::Rectangle<T> r)
     return out;
 }
 
+//disabled levels expand to a branch which is never taken, so the stream
+//arguments are never evaluated and are removed entirely by the optimiser
+#define CRO_LOG_DISABLED(type) if (true) {} else cro::Logger::log(type)
+
+#if CRO_LOG_LEVEL > CRO_LOG_LEVEL_INFO
+#define LogI CRO_LOG_DISABLED(cro::Logger::Type::Info)
+#else
 #define LogI cro::Logger::log(cro::Logger::Type::Info)
+#endif
+
+#if CRO_LOG_LEVEL > CRO_LOG_LEVEL_WARNING
+#define LogW CRO_LOG_DISABLED(cro::Logger::Type::Warning)
+#else
 #define LogW cro::Logger::log(cro::Logger::Type::Warning)
+#endif
+
+#if CRO_LOG_LEVEL > CRO_LOG_LEVEL_ERROR
+#define LogE CRO_LOG_DISABLED(cro::Logger::Type::Error)
+#else
 #define LogE cro::Logger::log(cro::Logger::Type::Error) << FILE_LINE
+#endif
 
-#ifndef CRO_DEBUG_
+#if !defined CRO_DEBUG_ || CRO_LOG_LEVEL == CRO_LOG_LEVEL_NONE
 #define LOG(message, type)
 #else
 #define LOG(message, type) {\
+if (static_cast<int>(type) >= CRO_LOG_LEVEL) { \
 std::string fileName(__FILE__); \
 fileName = cro::FileSystem::getFileName(fileName); \
 std::stringstream ss; \
 ss << message << " (" << fileName << ", " << __LINE__ << ")"; \
-cro::Logger::log(ss.str(), type);}
+cro::Logger::log(ss.str(), type);}}
 #endif //CRO_DEBUG_
\ No newline at end of file
@@ -0,0 +1,196 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <crogine/Config.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cro
+{
+    /*!
+    \brief Hierarchical CPU profiler.
+    Zones are declared with the CRO_PROFILE_SCOPE() macro and are recorded
+    into a lock-free buffer belonging to the calling thread, so they can be
+    used from any thread (such as a game server) without contention.
+    Once per frame the App collects the buffers from all threads and
+    aggregates the zones by their call path for display in the profiler
+    window, opened with the 'profiler' console command.
+
+    Captures can be saved in the Chrome trace event format, which can
+    be opened in chrome://tracing or https://ui.perfetto.dev
+
+    Zone names must be string literals or otherwise have static storage,
+    only the pointer is stored. When the profiler is disabled a zone costs
+    a single relaxed atomic load. Defining CRO_NO_PROFILER removes all
+    zones at compile time.
+    */
+    class CRO_EXPORT_API Profiler final
+    {
+    public:
+        struct SummaryZone final
+        {
+            std::string thread;
+            const char* name = nullptr;
+            std::uint32_t depth = 0;
+            float averageMs = 0.f; //per frame
+            float maxMs = 0.f;
+            float calls = 0.f; //per frame
+        };
+
+        /*!
+        \brief Enables or disables the recording of zones.
+        This is automatically enabled when the profiler window
+        is visible or a capture is in progress.
+        */
+        static void setEnabled(bool enabled);
+
+        /*!
+        \brief Returns true if zones are currently being recorded
+        */
+        static bool isEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+
+        /*!
+        \brief Sets the name of the calling thread as it appears in
+        the profiler window and in exported traces. Threads which are
+        not named are labelled with an index.
+        */
+        static void setThreadName(const std::string& name);
+
+        /*!
+        \brief Starts recording all collected zones into a capture buffer
+        */
+        static void beginCapture();
+
+        /*!
+        \brief Stops any active capture and writes it to the given path
+        as Chrome trace JSON.
+        \returns true on success
+        */
+        static bool endCapture(const std::string& path);
+
+        /*!
+        \brief Starts a capture which automatically ends after the
+        given number of frames, and is saved to the preferences
+        directory.
+        */
+        static void captureFrames(std::uint32_t frameCount);
+
+        /*!
+        \brief Returns true if a capture is currently in progress
+        */
+        static bool isCapturing();
+
+        /*!
+        \brief Starts accumulating the time spent in every zone over all
+        subsequent frames, for example to summarise a benchmark run.
+        */
+        static void beginSummary();
+
+        /*!
+        \brief Ends the current summary and returns the accumulated zones
+        of every thread. Zones are ordered depth first, with the most
+        expensive children of each zone listed first.
+        */
+        static std::vector<SummaryZone> endSummary();
+
+        /*!
+        \brief Collects the zones recorded by all threads since the
+        last call. This is called by the App once per frame and should
+        only ever be called from the main thread.
+        */
+        static void collect();
+
+        /*!
+        \brief Draws the profiler window, if it is visible.
+        Used internally by the App.
+        */
+        static void drawWindow();
+
+        /*!
+        \brief Shows or hides the profiler window.
+        */
+        static void setWindowVisible(bool visible);
+
+        /*!
+        \brief Scoped zone used by the CRO_PROFILE_SCOPE() macro.
+        The zone is recorded when this goes out of scope.
+        */
+        class CRO_EXPORT_API Zone final
+        {
+        public:
+            explicit Zone(const char* name)
+                : m_name(isEnabled() ? name : nullptr)
+            {
+                if (m_name)
+                {
+                    begin();
+                }
+            }
+
+            ~Zone()
+            {
+                if (m_name)
+                {
+                    end();
+                }
+            }
+
+            Zone(const Zone&) = delete;
+            Zone(Zone&&) = delete;
+            Zone& operator = (const Zone&) = delete;
+            Zone& operator = (Zone&&) = delete;
+
+        private:
+            const char* m_name = nullptr;
+            std::uint64_t m_start = 0;
+
+            void begin();
+            void end();
+        };
+
+    private:
+        static std::atomic_bool m_enabled;
+    };
+}
+
+#define CRO_PROFILE_CONCAT_(a, b) a##b
+#define CRO_PROFILE_CONCAT(a, b) CRO_PROFILE_CONCAT_(a, b)
+
+#ifdef CRO_NO_PROFILER
+#define CRO_PROFILE_SCOPE(name)
+#else
+#define CRO_PROFILE_SCOPE(name) cro::Profiler::Zone CRO_PROFILE_CONCAT(croProfileZone_, __LINE__)(name)
+#endif
+
+#define CRO_PROFILE_FUNCTION() CRO_PROFILE_SCOPE(__func__)
@@ -87,6 +87,17 @@ namespace cro::Detail
         */
         std::vector<Entity> query(FloatRect area) const;
 
+        /*!
+        \brief Query the tree without allocating, writing the results
+        to a caller provided array, such as a FrameVector or std::array
+        \param area Area to query within the tree, in world coords
+        \param dst Pointer to the array to receive the results
+        \param dstSize Maximum number of entities to write to dst.
+        Any further results are discarded.
+        \returns The number of entities written to dst
+        */
+        std::size_t query(FloatRect area, Entity* dst, std::size_t dstSize) const;
+
         /*!
         \brief Returns a vector of pairs of entities whose
         AABBs intersect.
@@ -114,7 +125,8 @@ namespace cro::Detail
         bool removeFromNode(Node*, FloatRect bounds, Entity member);
         void removeMember(Node*, Entity);
         bool tryMerge(Node*);
-        void query(Node*, FloatRect bounds, FloatRect queryBounds, std::vector<Entity>& dst) const;
+        template <typename Output>
+        void query(Node*, FloatRect bounds, FloatRect queryBounds, Output& dst) const;
         void findIntersections(Node*, std::vector<std::pair<Entity, Entity>>& dst) const;
         void findChildIntersections(Node*, Entity parent, std::vector<std::pair<Entity, Entity>>& dst) const;
 
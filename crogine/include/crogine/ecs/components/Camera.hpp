@@ -52,6 +52,8 @@ source distribution.
 
 namespace cro
 {
+    class OcclusionBuffer;
+
     /*!
     \brief Render flags.
     Use these to filter renderable items which should be drawn for a
@@ -392,6 +394,25 @@ namespace cro
         */
         bool isStatic = false;
 
+        /*!
+        \brief If this is set to false an active camera keeps the draw lists
+        from its most recent update rather than culling the Scene again.
+        Unlike setting the active flag to false the camera's matrices are
+        still updated, which allows views which are rendered at a reduced
+        rate to skip culling on the frames they are not drawn, while any
+        other systems can still use the active state of the camera.
+        */
+        bool refreshDrawLists = true;
+
+        /*!
+        \brief Optional OcclusionBuffer used by the ModelRenderer to cull
+        Models hidden behind large occluders in the Final pass. The buffer
+        is not owned by the Camera and must outlive it, although it may be
+        shared between multiple Cameras.
+        \see OcclusionBuffer
+        */
+        OcclusionBuffer* occlusionBuffer = nullptr;
+
 
         /*!
         \brief Target to use as this camera's reflection buffer.
@@ -549,6 +570,43 @@ namespace cro
         */
         std::uint32_t getBlurPassCount() const { return m_blurPasses; }
 
+        /*!
+        \brief Enables stable fitting of shadow map cascades.
+        When enabled each cascade is fitted to a sphere bounding its
+        split of the camera frustum, so that its size doesn't change as
+        the camera rotates, and its position is snapped to whole shadow
+        map texels. This removes the shimmering of shadow edges as the
+        camera moves, at the cost of some effective shadow resolution.
+        Disabled by default.
+        \see ShadowMapRenderer
+        */
+        void setStableShadows(bool stable) { m_stableShadows = stable; }
+
+        /*!
+        \brief Returns true if stable shadow fitting is enabled
+        \see setStableShadows()
+        */
+        bool getStableShadows() const { return m_stableShadows; }
+
+        /*!
+        \brief Sets how often, in shadow map updates, cascades other than
+        the nearest are re-rendered.
+        Far cascades cover a larger area so move less on screen, and can
+        usually be updated less often than the nearest cascade. Updates are
+        staggered so that far cascades don't all render on the same frame.
+        All cascades are updated whenever the camera is activated or its
+        projection changes. This works best with setStableShadows() enabled.
+        \param interval Number of updates between renders of each far
+        cascade. Defaults to 1 (every cascade is updated every time)
+        */
+        void setCascadeUpdateInterval(std::uint32_t interval) { m_cascadeInterval = std::max(1u, interval); }
+
+        /*!
+        \brief Returns the current cascade update interval
+        \see setCascadeUpdateInterval()
+        */
+        std::uint32_t getCascadeUpdateInterval() const { return m_cascadeInterval; }
+
         /*!
         brief Returns the z depth, in view space, of each cascade split, ending
         with the far plane.
@@ -675,6 +733,10 @@ namespace cro
         std::uint32_t m_blurPasses;
         std::vector<float> m_splitDistances;
 
+        bool m_stableShadows = false;
+        std::uint32_t m_cascadeInterval = 1;
+        std::uint32_t m_shadowUpdateCount = 0; //reset to 0 to force all cascades to update
+
         bool m_dirtyTx;
     };
 }
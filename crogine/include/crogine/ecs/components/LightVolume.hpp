@@ -51,6 +51,10 @@ namespace cro
     debugging purposes as this with render the mesh in the
     scene.
 
+    Visible lights are also made available to forward
+    rendered materials drawn by the ModelRenderer whose
+    shaders use the CLUSTERED_LIGHTS include.
+
     \see LightVolumeSystem
     */
     struct CRO_EXPORT_API LightVolume final
@@ -71,5 +75,6 @@ namespace cro
         float lightScale = 1.f; //used to scale the volume to the mesh based on current transform
         float cullAttenuation = 1.f; //used to fade the light before it's culled
         friend class LightVolumeSystem;
+        friend class ModelRenderer;
     };
 }
\ No newline at end of file
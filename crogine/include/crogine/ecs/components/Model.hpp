@@ -230,6 +230,23 @@ namespace cro
         */
         void updateInstanceTransforms(const std::vector<const std::vector<glm::mat4>*>& transforms, const std::vector<const std::vector<glm::mat3>*>& normalMatrices);
 
+        /*!
+        \brief Sets a vec4 of custom data for each instance of an instanced model.
+        This is read by materials whose shader has a vec4 a_instanceData vertex
+        attribute, and can be used to vary the appearance of individual instances,
+        such as animation timing, without writing to the material each frame.
+        setInstanceTransforms() must have been called first, and the data
+        must contain at least getInstanceCount() values. If the instance
+        count is later increased the data needs to be set again.
+        */
+        void setInstanceData(const std::vector<glm::vec4>& data);
+
+        /*!
+        \brief Returns the number of instances drawn by this model, or 0
+        if the model is not instanced
+        */
+        std::uint32_t getInstanceCount() const;
+
         /*!
         \brief Returns the bounding sphere of the Model
         Note that this may not necessarily be the same as the of the Model's
@@ -308,6 +325,7 @@ namespace cro
         {
             std::uint32_t transformBuffer = 0;
             std::uint32_t normalBuffer = 0;
+            std::uint32_t dataBuffer = 0;
             std::uint32_t instanceCount = 0;
         }m_instanceBuffers;
 
@@ -63,6 +63,19 @@ namespace cro
         */
         std::vector<Entity> query(Box area, std::uint64_t filter = std::numeric_limits<std::uint64_t>::max()) const;
 
+        /*!
+        \brief Query the tree without allocating, writing the results
+        to a caller provided array, such as a FrameVector or std::array
+        \param area Area in world coordinates to query
+        \param dst Pointer to the array to receive the results
+        \param dstSize Maximum number of entities to write to dst.
+        Any further results are discarded.
+        \param filter Only entities with DynamicTreeComponents matching
+        the given bit flags are returned. Defaults to all flags set.
+        \returns The number of entities written to dst
+        */
+        std::size_t query(Box area, Entity* dst, std::size_t dstSize, std::uint64_t filter = std::numeric_limits<std::uint64_t>::max()) const;
+
     private:
         Detail::BalancedTree m_tree;
     };
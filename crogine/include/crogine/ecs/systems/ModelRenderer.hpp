@@ -46,6 +46,8 @@ source distribution.
 #include <crogine/gui/GuiClient.hpp>
 #endif
 
+#include <array>
+#include <memory>
 #include <vector>
 
 namespace cro
@@ -57,7 +59,10 @@ namespace cro
     struct SortData final
     {
         std::int64_t flags = 0;
-        std::vector<std::int32_t> matIDs;
+
+        //range of submesh indices in the PassList's materialIDs
+        std::uint32_t materialStart = 0;
+        std::uint32_t materialCount = 0;
 
         //store this here as it's more efficient
         //to calc once per draw list rather than
@@ -70,14 +75,24 @@ namespace cro
     struct PassList final
     {
         std::vector<MaterialPair> renderables;
+        std::vector<std::int32_t> materialIDs; //shared by all renderables so they don't each allocate
         glm::mat4 viewMatrix = glm::mat4(1.f);
+        std::size_t occludedCount = 0; //models inside the frustum hidden by the camera's OcclusionBuffer
     };
 
     /*!
     \brief Used to draw scene Models.
     The system frustum-culls then renders any entities with a Model component
-    in the scene. Note this only renders Models - Sprite and Text components
+    in the scene. If the Camera has an OcclusionBuffer assigned then Models
+    hidden behind its occluders are also culled from the Final pass. Note this only renders Models - Sprite and Text components
     are rendered with RenderSystem2D.
+
+    If the Scene also contains a LightVolumeSystem then any materials whose shader
+    uses the CLUSTERED_LIGHTS include are forward lit by the visible LightVolumes.
+    Lights are assigned to a grid of view space clusters, with exponentially spaced
+    depth slices, for each camera, so that each fragment only evaluates the lights
+    which may affect it. This requires a perspective camera and is only available
+    on desktop platforms. Clustered lighting is applied to the Final pass only.
     */
     class CRO_EXPORT_API ModelRenderer final : public System, public Renderable
 #if defined(DEBUG_WINDOWS) || defined(BENCHMARK)
@@ -92,6 +107,25 @@ namespace cro
         */
         explicit ModelRenderer(MessageBus& mb);
 
+        ~ModelRenderer();
+
+        ModelRenderer(const ModelRenderer&) = delete;
+        ModelRenderer(ModelRenderer&&) = delete;
+        ModelRenderer& operator = (const ModelRenderer&) = delete;
+        ModelRenderer& operator = (ModelRenderer&&) = delete;
+
+        static constexpr std::uint32_t MaxClusteredLights = 256;
+        static constexpr std::uint32_t ClusterGridX = 16;
+        static constexpr std::uint32_t ClusterGridY = 9;
+        static constexpr std::uint32_t ClusterGridZ = 24;
+
+        /*!
+        \brief Texture unit reserved for the light cluster grid.
+        Materials using the CLUSTERED_LIGHTS include should not
+        bind this many textures or more.
+        */
+        static constexpr std::uint32_t ClusterTextureUnit = 15;
+
         /*!
         \brief Performs frustum culling and Material sorting by depth and blend mode
         */
@@ -115,6 +149,25 @@ namespace cro
         */
         std::size_t getVisibleCount(std::size_t cameraIndex, std::int32_t passIndex = 0) const;
 
+        /*!
+        \brief Returns the number of Models which were inside the frustum of the
+        given camera but were culled by the camera's OcclusionBuffer, the last
+        time its draw list was updated. Only the Final pass is occlusion tested
+        so the Reflection pass always returns 0.
+        \param cameraIndex The index of the camera's drawlist
+        \param passIndex the ID of the pass to query
+        \see Camera::occlusionBuffer
+        */
+        std::size_t getOccludedCount(std::size_t cameraIndex, std::int32_t passIndex = 0) const;
+
+        /*!
+        \brief Returns the number of point lights assigned to the clusters
+        of the given camera the last time it was drawn. This is always 0 if
+        no visible materials use the CLUSTERED_LIGHTS shader include.
+        \param cameraIndex The index of the camera's drawlist
+        */
+        std::size_t getClusteredLightCount(std::size_t cameraIndex) const;
+
         struct VertexShaderID final
         {
             enum
@@ -183,6 +236,36 @@ namespace cro
         }m_lightUniforms;
         UniformBuffer<LightUniformBlock> m_lightUBO;
 
+        struct ClusterUniformBlock final
+        {
+            glm::uvec4 gridSize = glm::uvec4(ClusterGridX, ClusterGridY, ClusterGridZ, 0); //w is light count
+            glm::vec4 depthParams = glm::vec4(0.f); //log scale, log bias, near, far
+            std::array<glm::vec4, MaxClusteredLights> lightPositions = {}; //w is radius
+            std::array<glm::vec4, MaxClusteredLights> lightColours = {};
+        };
+        using ClusterUBO = std::shared_ptr<UniformBuffer<ClusterUniformBlock>>;
+
+        //the final pass is binned against the camera's visible lights
+        //and the reflection pass is bound to an empty block
+        struct LightClusters final
+        {
+            std::array<ClusterUBO, 2u> ubos;
+            std::uint32_t tbo = 0;
+            std::uint32_t texture = 0;
+            std::size_t tboSize = 0;
+            std::size_t lightCount = 0;
+            bool dirty = true;
+        };
+        std::vector<LightClusters> m_lightClusters;
+
+        //reused when binning to save reallocating every frame
+        std::vector<std::uint32_t> m_clusterCounts;
+        std::vector<std::uint32_t> m_clusterData;
+        std::vector<std::array<std::uint32_t, 6u>> m_lightRanges; //min xyz, max xyz
+        std::unique_ptr<ClusterUniformBlock> m_clusterBlock;
+
+        void updateLightClusters(Entity);
+
 #if defined(BENCHMARK)
         cro::HiResTimer m_timer;
         static constexpr std::size_t MaxBenchSamples = 60;
@@ -146,6 +146,8 @@ namespace cro
         };
         //for each camera, for each camera cascade, a vector of entities
         std::vector<std::vector<std::vector<Drawable>>> m_drawLists;
+        //for each camera a bit per cascade scheduled for rendering this frame
+        std::vector<std::uint32_t> m_cascadeMasks;
 
         //buffer to render first pass blur if soft shadowing
         DepthTexture m_blurBuffer;
@@ -46,6 +46,7 @@ namespace cro
     {
         static constexpr std::uint32_t High = 0;
         static constexpr std::uint32_t Low = 1;
+        static constexpr std::uint32_t Half = 2;
     };
 
     /*!
@@ -53,7 +54,10 @@ namespace cro
 
     Currently only supports 4 channel image data. Precision
     paramater only affects float textures, where low precision
-    uses 16 bit floats instead of 32 bit.
+    uses 16 bit floats instead of 32 bit, and std::uint16_t
+    textures, where Half precision expects the data to already
+    be packed as 16 bit floats (see glm::packHalf1x16()). This
+    halves the memory and upload bandwidth used by float data.
     */
     template <class T, std::uint32_t Layers, std::uint32_t Precision = TexturePrecision::High>
     class ArrayTexture final
@@ -76,8 +80,16 @@ namespace cro
 
             else if constexpr (std::is_same<T, std::uint16_t>::value)
             {
-                m_type = GL_UNSIGNED_SHORT;
-                m_format = GL_RGBA16;
+                if constexpr (Precision == TexturePrecision::Half)
+                {
+                    m_type = GL_HALF_FLOAT;
+                    m_format = GL_RGBA16F;
+                }
+                else
+                {
+                    m_type = GL_UNSIGNED_SHORT;
+                    m_format = GL_RGBA16;
+                }
             }
 
             else if constexpr (std::is_same<T, std::uint8_t>::value)
@@ -0,0 +1,196 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <crogine/Config.hpp>
+#include <crogine/core/Profiler.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cro
+{
+    /*!
+    \brief Measures the GPU time taken by render passes.
+    Passes are declared with the CRO_GPU_SCOPE() macro, which wraps
+    the pass in GL_TIME_ELAPSED queries. As these queries cannot be
+    nested, the query of an enclosing pass is suspended while a nested
+    pass is active, and the results are combined to give both the
+    exclusive and inclusive time of each pass.
+
+    Query results are read back FrameLatency frames later so that
+    the CPU never waits on the GPU. Results can be viewed with the
+    'gpu_profiler' console command, and logged to a CSV file with
+    'gpu_profile_log'.
+
+    GPU timing is only available on desktop platforms, and must only
+    be used on the thread which owns the OpenGL context. Pass names
+    must be string literals or otherwise have static storage.
+    */
+    class CRO_EXPORT_API GPUProfiler final
+    {
+    public:
+        static constexpr std::size_t FrameLatency = 4;
+
+        struct Result final
+        {
+            const char* name = nullptr;
+            std::uint32_t depth = 0;
+            float inclusiveMs = 0.f; //averaged per frame
+            float exclusiveMs = 0.f;
+        };
+
+        /*!
+        \brief Enables or disables timer queries.
+        This is enabled automatically when the window is visible
+        or CSV logging is active.
+        */
+        static void setEnabled(bool enabled);
+
+        /*!
+        \brief Requests that timer queries stay enabled, for example
+        from a debug UI. Unlike setEnabled() this persists when the
+        window is closed or any logging or summary ends.
+        */
+        static void setUserEnabled(bool enabled);
+
+        /*!
+        \brief Returns true if passes are currently being timed
+        */
+        static bool isEnabled() { return m_enabled; }
+
+        /*!
+        \brief Returns true if the current platform supports timer queries
+        */
+        static bool isAvailable();
+
+        /*!
+        \brief Returns the most recent results, averaged over half
+        a second, in the order in which the passes were first drawn.
+        */
+        static const std::vector<Result>& getResults();
+
+        /*!
+        \brief Starts writing the time of every pass for every frame
+        to the given file as comma separated values
+        \returns true if the file was successfully opened
+        */
+        static bool beginCSVLog(const std::string& path);
+
+        /*!
+        \brief Stops any active CSV logging and closes the file
+        */
+        static void endCSVLog();
+
+        /*!
+        \brief Returns true if results are being logged to a CSV file
+        */
+        static bool isLogging();
+
+        /*!
+        \brief Starts accumulating the time of every pass over all
+        subsequent frames, for example to summarise a benchmark run.
+        */
+        static void beginSummary();
+
+        /*!
+        \brief Ends the current summary and returns each pass
+        averaged over every frame since beginSummary() was called
+        */
+        static std::vector<Result> endSummary();
+
+        /*!
+        \brief Ends the current frame and collects any available results.
+        This is called by the App after the window contents are displayed.
+        */
+        static void frameEnd();
+
+        /*!
+        \brief Ends any logging and deletes all query objects.
+        Called by the App before the OpenGL context is destroyed.
+        */
+        static void finalise();
+
+        /*!
+        \brief Draws the GPU timing window if it is visible. Used internally.
+        */
+        static void drawWindow();
+
+        /*!
+        \brief Shows or hides the GPU timing window
+        */
+        static void setWindowVisible(bool visible);
+
+        /*!
+        \brief Scoped pass used by the CRO_GPU_SCOPE() macro
+        */
+        class CRO_EXPORT_API Pass final
+        {
+        public:
+            explicit Pass(const char* name)
+                : m_active(isEnabled())
+            {
+                if (m_active)
+                {
+                    begin(name);
+                }
+            }
+
+            ~Pass()
+            {
+                if (m_active)
+                {
+                    end();
+                }
+            }
+
+            Pass(const Pass&) = delete;
+            Pass(Pass&&) = delete;
+            Pass& operator = (const Pass&) = delete;
+            Pass& operator = (Pass&&) = delete;
+
+        private:
+            bool m_active = false;
+
+            void begin(const char*);
+            void end();
+        };
+
+    private:
+        static bool m_enabled;
+    };
+}
+
+#ifdef CRO_NO_PROFILER
+#define CRO_GPU_SCOPE(name)
+#else
+#define CRO_GPU_SCOPE(name) cro::GPUProfiler::Pass CRO_PROFILE_CONCAT(croGpuPass_, __LINE__)(name)
+#endif
@@ -0,0 +1,137 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+#pragma once
+
+#include <crogine/Config.hpp>
+#include <crogine/graphics/Rectangle.hpp>
+
+#include <crogine/detail/glm/vec2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace cro
+{
+    /*!
+    \brief Reads texture or framebuffer contents back from the GPU
+    without stalling the pipeline.
+
+    Each request is copied into a pixel pack buffer and followed by
+    a fence. Once the fence is signalled, usually a frame or two later,
+    the buffer is mapped and its contents passed to the request's
+    callback. Callbacks are executed by the App after the window has
+    been displayed, on the thread which owns the OpenGL context. The
+    data passed to a callback is only valid for the duration of the
+    call, so should be copied if it needs to be kept.
+
+    Any object which queues a readback must cancel it if it is destroyed
+    before the callback is executed. Pixel buffer objects are only
+    available on desktop platforms - elsewhere the pixels are read
+    immediately and the callback is executed before the request returns.
+    */
+    class CRO_EXPORT_API GPUReadback final
+    {
+    public:
+        /*!
+        \brief Identifies a pending request. 0 is never a valid ID
+        */
+        using ID = std::uint32_t;
+
+        /*!
+        \brief Receives the pixel data and its size in bytes.
+        Rows are tightly packed, starting at the bottom of the image.
+        */
+        using Callback = std::function<void(const std::byte*, std::size_t)>;
+
+        enum class Format
+        {
+            RGB8,
+            RGBA8,
+            RGBA32F,
+            R32F
+        };
+
+        /*!
+        \brief Queues a read of the first mip level of the given texture
+        \param textureID OpenGL handle of the texture to read. The texture
+        may be safely destroyed once this function returns.
+        \param size Size of the texture in pixels
+        \param format Format in which the pixel data should be returned
+        \param callback Executed once the data is available
+        \returns ID of the request, or 0 if the request was completed
+        immediately or failed.
+        */
+        static ID readTexture(std::uint32_t textureID, glm::uvec2 size, Format format, Callback callback);
+
+        /*!
+        \brief Queues a read of the given area of the currently bound
+        read framebuffer.
+        \see readTexture()
+        */
+        static ID readFramebuffer(URect area, Format format, Callback callback);
+
+        /*!
+        \brief Returns true if the given request is still waiting for
+        its data to become available
+        */
+        static bool isPending(ID id);
+
+        /*!
+        \brief Blocks until the given request is available and executes
+        its callback immediately. Use this when the result is needed
+        before the frame can continue, for example when waiting on
+        data which was queued on an earlier frame.
+        */
+        static void complete(ID id);
+
+        /*!
+        \brief Cancels the given request without executing its callback
+        */
+        static void cancel(ID id);
+
+        /*!
+        \brief Returns the number of requests which are waiting
+        */
+        static std::size_t getPendingCount();
+
+        /*!
+        \brief Executes the callback of any requests which have become
+        available. This is called by the App after the window contents
+        are displayed.
+        */
+        static void frameEnd();
+
+        /*!
+        \brief Cancels all requests and frees any buffers.
+        Called by the App before the OpenGL context is destroyed.
+        */
+        static void finalise();
+    };
+}
@@ -119,6 +119,7 @@ namespace cro
             RefractionMap,
             ReflectionMatrix,
             SkyBox,
+            LightClusterGrid,
             Total
         };
         
@@ -361,6 +362,12 @@ namespace cro
             */
             bool hasLightUBO() const { return m_hasLightUBO; }
 
+            /*!
+            \brief Returns true if the material shader supports the clustered
+            point light UBO block. Used internally by the ModelRenderer system
+            */
+            bool hasClusterUBO() const { return m_hasClusterUBO; }
+
 
             /*
             Here be dragons! Don't modify these variables as they are configured
@@ -377,7 +384,7 @@ namespace cro
             //for example skinning and projection map data which is
             //used internally, and not user-definable
             std::size_t optionalUniformCount = 0;
-            std::array<std::int32_t, 10> optionalUniforms{};
+            std::array<std::int32_t, 11> optionalUniforms{};
 
             bool customShader = false; //set to true by model def if a custom shader was requested and successfully applied
 
@@ -387,6 +394,7 @@ namespace cro
 
             bool m_hasCameraUBO = false;
             bool m_hasLightUBO = false;
+            bool m_hasClusterUBO = false;
 
             static constexpr std::size_t MaxCustomSettings = 10;
             std::size_t m_customSettingsCount = 0;
@@ -0,0 +1,149 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <crogine/Config.hpp>
+#include <crogine/graphics/BoundingBox.hpp>
+
+#include <crogine/detail/glm/vec2.hpp>
+#include <crogine/detail/glm/vec3.hpp>
+#include <crogine/detail/glm/mat4x4.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace cro
+{
+    /*!
+    \brief Low resolution, software rendered depth buffer used to cull
+    Models which are hidden behind large occluders such as terrain.
+
+    Occluding geometry is set once as a list of world space triangles.
+    When the buffer is assigned to a Camera the ModelRenderer calls
+    update() with the Camera's view-projection matrix before culling.
+    If the matrix has changed the occluders are rasterised again, and
+    a hierarchical depth pyramid (Hi-Z) is built from the result. Any
+    Model which passes the frustum test in the Final pass is then
+    tested against the pyramid and skipped if its bounding box is
+    entirely behind the occluders.
+
+    Occluders are drawn conservatively. Each triangle is written with
+    the depth of its furthest vertex, and triangles which cross the near
+    plane are skipped, so a Model is never culled if any part of it may
+    be visible. Occluder geometry should be a simplified version of the
+    visible mesh which lies on or inside its surface. As with any low
+    resolution depth test, objects which are visible only through gaps
+    smaller than a texel of the buffer may still be culled.
+    */
+    class CRO_EXPORT_API OcclusionBuffer final
+    {
+    public:
+        /*!
+        \brief Constructor
+        \param size Resolution of the depth buffer. This should be small,
+        and ideally a power of two on each axis.
+        */
+        explicit OcclusionBuffer(glm::uvec2 size = glm::uvec2(256u, 128u));
+
+        /*!
+        \brief Sets the occluding geometry
+        \param vertices World space vertex positions
+        \param indices Three indices per triangle into the vertex array
+        */
+        void setOccluders(std::vector<glm::vec3> vertices, std::vector<std::uint32_t> indices);
+
+        /*!
+        \brief Removes all occluding geometry
+        */
+        void clearOccluders();
+
+        /*!
+        \brief Returns the number of occluding triangles
+        */
+        std::size_t getOccluderCount() const { return m_indices.size() / 3; }
+
+        /*!
+        \brief Enables or disables occlusion testing. When disabled
+        isVisible() always returns true. Enabled by default.
+        */
+        void setEnabled(bool enabled) { m_enabled = enabled; }
+
+        /*!
+        \brief Returns true if occlusion testing is enabled
+        */
+        bool isEnabled() const { return m_enabled; }
+
+        /*!
+        \brief Rasterises the occluders with the given view-projection
+        matrix if it or the occluder geometry has changed since the last
+        update. This is called by the ModelRenderer for any Camera with
+        this buffer assigned, and must not be called while isVisible()
+        is being used by another thread.
+        */
+        void update(const glm::mat4& viewProjection);
+
+        /*!
+        \brief Returns false if the given bounding box is entirely hidden
+        by the occluders
+        \param box Axis aligned bounding box in local space
+        \param worldTransform Transform used to place the box in the world
+        */
+        bool isVisible(const Box& box, const glm::mat4& worldTransform) const;
+
+        /*!
+        \brief Returns the resolution of the depth buffer
+        */
+        glm::uvec2 getSize() const { return m_size; }
+
+    private:
+        glm::uvec2 m_size;
+        bool m_enabled;
+        bool m_dirty;
+
+        std::vector<glm::vec3> m_vertices;
+        std::vector<std::uint32_t> m_indices;
+
+        glm::mat4 m_viewProjection;
+        std::vector<glm::vec4> m_projected; //pixel position, depth, and w is zero if clipped by the near plane
+
+        //normalised device depth of the nearest occluder. Each
+        //subsequent level stores the furthest of the 2x2 texels
+        //below it, so it never reports more occlusion than exists
+        struct Level final
+        {
+            glm::uvec2 size = glm::uvec2(0u);
+            std::vector<float> depth;
+        };
+        std::vector<Level> m_levels;
+
+        void rasterise();
+        void buildPyramid();
+    };
+}
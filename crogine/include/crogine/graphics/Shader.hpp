@@ -54,6 +54,7 @@ namespace cro
             {
                 InstanceTransform = Mesh::Attribute::Total,
                 InstanceNormal,
+                InstanceData,
 
                 Count
             };
@@ -93,6 +94,40 @@ namespace cro
         bool loadFromString(const std::string& vertex, const std::string& fragment, const std::string& defines = "");
         bool loadFromString(const std::string& vertex, const std::string& geometry, const std::string& fragment, const std::string& defines);
 
+        /*!
+        \brief Issues the compilation and linking of the given source without
+        waiting for the result.
+        When the driver supports GL_KHR_parallel_shader_compile the program is
+        built on the driver's own threads, so many shaders can be issued in a
+        row before any of them are needed. finishLoad() MUST be called before
+        the shader is used - ShaderResource does this automatically.
+        \returns false if the program could not be created, else true. Compile
+        errors are not reported until finishLoad() is called.
+        \see loadFromString()
+        */
+        bool beginLoadFromString(const std::string& vertex, const std::string& fragment, const std::string& defines = "");
+        bool beginLoadFromString(const std::string& vertex, const std::string& geometry, const std::string& fragment, const std::string& defines);
+
+        /*!
+        \brief Returns true if a program issued with beginLoadFromString() has
+        finished building, so that calling finishLoad() will not block.
+        Always returns true if parallel compilation is not available.
+        */
+        bool isLoadComplete() const;
+
+        /*!
+        \brief Returns true if beginLoadFromString() has been called but
+        finishLoad() has not.
+        */
+        bool isLoadPending() const { return m_pending.program != 0; }
+
+        /*!
+        \brief Waits for a program issued with beginLoadFromString() to finish
+        building, then checks it for errors and maps its attributes and uniforms.
+        \returns true if the shader is ready to use, else false
+        */
+        bool finishLoad();
+
         /*!
         \brief Returns the OpenGL handle for the shader program
         */
@@ -125,8 +160,20 @@ namespace cro
 
     private:
         bool loadFromSource(const char* v, const char* g, const char* f, const char* d);
+        bool issueSource(const char* v, const char* g, const char* f, const char* d);
 
         std::uint32_t m_handle;
+
+        struct PendingProgram final
+        {
+            std::uint32_t vertID = 0;
+            std::uint32_t geomID = 0;
+            std::uint32_t fragID = 0;
+            std::uint32_t program = 0;
+        }m_pending;
+        bool checkCompileStatus(std::uint32_t, const std::string&) const;
+        void deletePending();
+
         std::array<std::int32_t, AttributeID::Count> m_attribMap;
         bool fillAttribMap();
         void resetAttribMap();
@@ -36,6 +36,7 @@ source distribution.
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace cro
 {    
@@ -227,6 +228,47 @@ namespace cro
         */
         std::int32_t loadBuiltIn(BuiltIn type, std::int32_t flags);
 
+        /*!
+        \brief Starts a batch of shader loads.
+        While a batch is active loadFromString() and loadBuiltIn() issue the
+        compilation of each shader without waiting for it to finish, so that
+        drivers supporting GL_KHR_parallel_shader_compile can build the whole
+        batch concurrently. Shaders are finished when they are first requested
+        with get(), or when endBatch() is called - so for the best results load
+        every shader in a batch before requesting any of them.
+        */
+        void beginBatch();
+
+        /*!
+        \brief Ends the current batch, waiting for any remaining shaders to
+        finish building. Shaders which fail to build are removed from the resource.
+        \returns true if all the shaders in the batch were built successfully
+        */
+        bool endBatch();
+
+        /*!
+        \brief Writes the IDs of every built in shader variant requested with
+        loadBuiltIn() so far to the given path. Variants which were only loaded
+        from a manifest, or which failed to build, are not included so the
+        manifest doesn't grow from one run to the next.
+        The manifest can be passed to loadBuiltInManifest() the
+        next time the application runs, so that variants which would otherwise
+        be compiled on demand when models are loaded can be built up front,
+        for example as part of a batch while a loading screen is displayed.
+        Built in IDs are made from the shader type and its BuiltInFlags so
+        they are stable between runs.
+        \returns true on success
+        */
+        bool saveBuiltInManifest(const std::string& path) const;
+
+        /*!
+        \brief Loads every built in shader variant listed in the manifest at
+        the given path
+        \param path Absolute path to a manifest created with saveBuiltInManifest()
+        \returns The number of variants loaded
+        */
+        std::size_t loadBuiltInManifest(const std::string& path);
+
         /*!
         \brief Returns the shader with the given ID if it exists, else the default system shader.
         */
@@ -291,6 +333,11 @@ namespace cro
 
         std::unordered_map<std::string, std::int32_t> m_stringMappings;
 
+        std::vector<std::int32_t> m_builtInIDs; //requested with loadBuiltIn(), written to the manifest
+        bool m_batchActive = false;
+
         std::string parseIncludes(const std::string& src) const;
+        std::int32_t createBuiltIn(BuiltIn type, std::int32_t flags); //doesn't add the ID to the manifest
+        void removeShader(std::int32_t ID); //after a failed build
     };
 }
\ No newline at end of file
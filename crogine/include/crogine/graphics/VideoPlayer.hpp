@@ -36,6 +36,11 @@ source distribution.
 #include <crogine/graphics/RenderTexture.hpp>
 #include <crogine/graphics/SimpleQuad.hpp>
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 struct plm_t;
@@ -65,6 +70,11 @@ namespace cro
 
     In testing VCD video files have been found to not present audio
     channels to the plm decoder, and need to be remuxed as MPG-PS.
+
+    While playing, the file is decoded on a worker thread which fills
+    a small queue of decoded frames ahead of playback. Audio samples
+    are passed directly to the audio stream from the worker thread,
+    and update() only uploads the most recent due frame.
     */
 
     class CRO_EXPORT_API VideoPlayer final : public cro::Detail::SDLResource
@@ -93,13 +103,12 @@ namespace cro
         bool loadFromFile(const std::string& path);
 
         /*!
-        \brief Updates the decoding of the file, if a file is open.
+        \brief Updates the playback of the file, if a file is open.
         This is automatically locked to the frame rate of the video
         up to the maximum rate at which this is called, at which point
-        frames will be skipped.
+        frames will be skipped. Decoding happens on a worker thread,
+        this only uploads the current frame to the output texture.
         \param dt The time since this function was last called
-
-        hmmmmm - shame we can't spin this off into a thread, but OpenGL.
         */
         void update(float dt);
 
@@ -162,10 +171,12 @@ namespace cro
     private:
 
         plm_t* m_plm;
-        bool m_looped;
+        std::atomic_bool m_looped;
 
         float m_timeAccumulator;
         float m_frameTime;
+        float m_duration;
+        float m_position;
 
         enum class State
         {
@@ -180,7 +191,47 @@ namespace cro
         cro::SimpleQuad m_quad;
         cro::RenderTexture m_outputBuffer;
 
-        void updateTexture(std::uint32_t, plm_plane_t*);
+        struct Plane final
+        {
+            std::vector<std::uint8_t> data;
+            std::uint32_t width = 0;
+            std::uint32_t height = 0;
+        };
+
+        struct Frame final
+        {
+            std::array<Plane, 3u> planes = {}; //Y, Cb, Cr
+            float time = 0.f;
+        };
+
+        //decoded frames waiting to be displayed. Slots are swapped with
+        //m_currentFrame when displayed so that buffers are recycled.
+        static constexpr std::size_t FrameQueueSize = 4;
+        std::array<Frame, FrameQueueSize> m_frameQueue = {};
+        std::size_t m_queueHead;
+        std::size_t m_queueCount;
+        std::mutex m_queueMutex;
+        std::condition_variable m_queueCondition;
+        Frame m_currentFrame;
+
+        //the worker only ever touches m_plm while it's running
+        std::thread m_decodeThread;
+        std::atomic_bool m_decoding;
+        std::atomic_bool m_ended;
+
+        void startDecoding();
+        void stopDecoding();
+        void decodeThreadFunc();
+
+        void pushFrame(plm_frame_t*);
+        bool popFrame(); //swaps the next queued frame into m_currentFrame
+        void clearQueue();
+
+        //pixel unpack buffers used to upload each plane
+        std::array<std::uint32_t, 3u> m_pbos = {};
+        std::array<std::pair<std::uint32_t, std::uint32_t>, 3u> m_textureSizes = {};
+
+        void updateTexture(std::size_t, const Plane&);
         void updateBuffer();
 
 
@@ -198,11 +249,13 @@ namespace cro
 
         private:
             static constexpr std::int32_t SAMPLES_PER_FRAME = 1152;
-            std::array<std::int16_t, SAMPLES_PER_FRAME * 8> m_inBuffer = {};
+            //large enough to hold the audio decoded ahead with the frame queue
+            std::array<std::int16_t, SAMPLES_PER_FRAME * 32> m_inBuffer = {};
             std::array<std::int16_t, SAMPLES_PER_FRAME * 2> m_outBuffer = {};
 
-            std::uint32_t m_bufferIn = SAMPLES_PER_FRAME * 6;
-            std::uint32_t m_bufferOut = 2;
+            //written by the decoder, read by the stream thread
+            std::atomic<std::uint32_t> m_bufferIn = SAMPLES_PER_FRAME * 6;
+            std::atomic<std::uint32_t> m_bufferOut = 2;
 
         }m_audioStream;
 
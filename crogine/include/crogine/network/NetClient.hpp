@@ -37,6 +37,7 @@ source distribution.
 #include <thread>
 #include <mutex>
 #include <any>
+#include <list>
 #include <memory>
 #include <atomic>
 
@@ -44,6 +45,11 @@ struct _ENetHost;
 
 namespace cro
 {
+    namespace Detail
+    {
+        class NetBatcher;
+    }
+
     /*!
     \brief Creates a client side host which can be used to create
     a peer connected to a NetHost server.
@@ -146,11 +152,37 @@ namespace cro
         */
         const NetPeer& getPeer() const { return m_peer; }
 
+        /*!
+        \brief Enables or disables the batching of reliable packets.
+        When enabled, reliable packets sent on the same channel are
+        accumulated and sent as a single packet the next time pollEvent()
+        or flush() is called. Batches are unpacked transparently by the
+        receiving NetHost. This must also be enabled to receive batches
+        sent by a NetHost, and while enabled packet ID 0xff is reserved
+        and must not be used by the application. Disabled by default.
+        \see NetHost::setBatchingEnabled()
+        */
+        void setBatchingEnabled(bool enabled);
+
+        /*!
+        \brief Returns true if reliable packet batching is enabled
+        */
+        bool getBatchingEnabled() const { return m_batchingEnabled; }
+
+        /*!
+        \brief Queues any batched packets to be sent immediately,
+        rather than waiting for the next call to pollEvent()
+        */
+        void flush();
+
     private:
 
         _ENetHost* m_client;
         NetPeer m_peer;
 
+        bool m_batchingEnabled;
+        std::unique_ptr<Detail::NetBatcher> m_batcher;
+
         std::unique_ptr<std::thread> m_thread;
         std::mutex m_mutex;
         std::list<std::any> m_evtBuffer;
@@ -35,6 +35,7 @@ source distribution.
 
 #include <cstring>
 #include <string>
+#include <vector>
 
 struct _ENetPacket;
 struct _ENetPeer;
@@ -139,13 +140,32 @@ namespace cro
 
             /*!
             \brief returns the entire packet as raw bytes, including the ID at[0]
+            \see getRawData()
             */
             std::vector<std::byte> getDataRaw() const;
 
+            /*!
+            \brief Returns a pointer to the entire packet, including the ID at [0].
+            Unlike getDataRaw() this does not copy the packet, so the pointer
+            is only valid for the lifetime of this Packet.
+            */
+            const std::byte* getRawData() const;
+
+            /*!
+            \brief Returns the size of the entire packet, including the ID
+            */
+            std::size_t getRawSize() const;
+
         private:
             _ENetPacket* m_packet;
             std::uint8_t m_id;
+
+            //packets unpacked from a batch are a view into the batch
+            std::size_t m_offset;
+            std::size_t m_size;
+
             void setPacketData(_ENetPacket*);
+            void setPacketData(_ENetPacket*, std::size_t offset, std::size_t size);
 
             friend class NetClient;
             friend class NetHost;
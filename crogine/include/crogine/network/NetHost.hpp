@@ -33,6 +33,7 @@ source distribution.
 #include <crogine/detail/Types.hpp>
 #include <crogine/network/NetData.hpp>
 
+#include <memory>
 #include <string>
 
 struct _ENetHost;
@@ -41,6 +42,11 @@ namespace cro
 {
     struct NetEvent;
     struct NetPeer;
+
+    namespace Detail
+    {
+        class NetBatcher;
+    }
     
     /*!
     \brief Creates a network host.
@@ -164,9 +170,38 @@ namespace cro
         */
         void disconnectLater(NetPeer& peer);
 
+        /*!
+        \brief Enables or disables the batching of reliable packets.
+        When enabled, reliable packets sent to the same peer on the same
+        channel are accumulated and sent as a single packet the next time
+        pollEvent() or flush() is called, reducing the per-packet overhead
+        of sending many small messages in a single update. Batches are
+        unpacked transparently by the receiving NetClient, which raises a
+        PacketReceived event for each message in the order they were sent.
+
+        Batching must be enabled at both ends of the connection, as
+        received packets are only checked for batches when it is enabled.
+        While enabled packet ID 0xff (NetBatcher::BatchID) is reserved and
+        must not be used by the application. Disabled by default.
+        */
+        void setBatchingEnabled(bool enabled);
+
+        /*!
+        \brief Returns true if reliable packet batching is enabled
+        */
+        bool getBatchingEnabled() const { return m_batchingEnabled; }
+
+        /*!
+        \brief Queues any batched packets to be sent immediately,
+        rather than waiting for the next call to pollEvent()
+        */
+        void flush();
+
     private:
 
         _ENetHost* m_host;
+        bool m_batchingEnabled;
+        std::unique_ptr<Detail::NetBatcher> m_batcher;
     };
 
 #include "NetHost.inl"
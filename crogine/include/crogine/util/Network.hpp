@@ -186,6 +186,30 @@ namespace cro
             \brief Returns a list of IPv4 Addresses associated with available network adapters
             */
             std::vector<std::string> CRO_EXPORT_API getLocalAddresses();
+
+            /*!
+            \brief Allocation counters for the memory used by NetHost and NetClient.
+            Only memory allocated by ENet is counted - packets, peers and host
+            buffers. Containers owned by NetHost, NetClient or the application
+            are not included, so to check that the whole network loop is free
+            of allocations crogine must be built with USE_ALLOCATION_COUNTING
+            \see AllocationCounter
+            */
+            struct CRO_EXPORT_API AllocationStats final
+            {
+                std::uint64_t allocationCount = 0; //! <Total number of allocations requested, including those served from the pool
+                std::uint64_t systemAllocationCount = 0; //! <Number of allocations which had to be made by the system allocator
+                std::uint64_t activeCount = 0; //! <Number of allocations currently in use
+            };
+
+            /*!
+            \brief Returns the current network allocation counters.
+            Once a NetHost or NetClient reaches a steady state the system
+            allocation count should stop increasing, as packet memory is
+            recycled by an internal pool. This is asserted by the net_alloc_check
+            program in samples/alloc_check.
+            */
+            AllocationStats CRO_EXPORT_API getAllocationStats();
         }
     }
 }
\ No newline at end of file
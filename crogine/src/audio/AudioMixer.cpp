@@ -68,6 +68,10 @@ std::array<float, AudioMixer::MaxChannels> AudioMixer::m_channels
 std::array<float, AudioMixer::MaxChannels> AudioMixer::m_prefadeChannels
 { { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f } };
 
+std::array<float, AudioMixer::MaxChannels> AudioMixer::m_lowPassCutoffs = {};
+std::array<float, AudioMixer::MaxChannels> AudioMixer::m_duckAmounts = {};
+std::array<std::uint8_t, AudioMixer::MaxChannels> AudioMixer::m_duckKeys = {};
+
 float AudioMixer::m_masterVol = 1.f;
 
 void AudioMixer::setMasterVolume(float vol)
@@ -84,6 +88,7 @@ void AudioMixer::setVolume(float vol, std::uint8_t channel)
 {
     CRO_ASSERT(channel < MaxChannels, "Channel index out of range");
     AudioMixer::m_channels[channel] = Util::Maths::clamp(vol, 0.f, 10.f);
+    updateChannel(channel);
 
     auto* msg = cro::App::getInstance().getMessageBus().post<Message::AudioEvent>(Message::AudioMessage);
     msg->action = Message::AudioEvent::ChannelVolumeChanged;
@@ -99,6 +104,7 @@ void AudioMixer::setPrefadeVolume(float vol, std::uint8_t channel)
 {
     CRO_ASSERT(channel < MaxChannels, "Channel index out of range");
     AudioMixer::m_prefadeChannels[channel] = Util::Maths::clamp(vol, 0.f, 1.f);
+    updateChannel(channel);
 
     auto* msg = cro::App::getInstance().getMessageBus().post<Message::AudioEvent>(Message::AudioMessage);
     msg->action = Message::AudioEvent::ChannelVolumeChanged;
@@ -122,6 +128,39 @@ const std::string& AudioMixer::getLabel(std::uint8_t channel)
     return m_labels[channel];
 }
 
+void AudioMixer::setLowPassCutoff(float cutoff, std::uint8_t channel)
+{
+    CRO_ASSERT(channel < MaxChannels, "Channel index out of range");
+    m_lowPassCutoffs[channel] = std::max(0.f, cutoff);
+    updateChannel(channel);
+}
+
+float AudioMixer::getLowPassCutoff(std::uint8_t channel)
+{
+    CRO_ASSERT(channel < MaxChannels, "Channel index out of range");
+    return m_lowPassCutoffs[channel];
+}
+
+void AudioMixer::setDucking(float amount, std::uint8_t channel, std::uint8_t keyChannel)
+{
+    CRO_ASSERT(channel < MaxChannels, "Channel index out of range");
+    CRO_ASSERT(keyChannel < MaxChannels, "Channel index out of range");
+    m_duckAmounts[channel] = Util::Maths::clamp(amount, 0.f, 1.f);
+    m_duckKeys[channel] = keyChannel;
+    updateChannel(channel);
+}
+
+float AudioMixer::getDuckingAmount(std::uint8_t channel)
+{
+    CRO_ASSERT(channel < MaxChannels, "Channel index out of range");
+    return m_duckAmounts[channel];
+}
+
+void AudioMixer::setVoiceBudget(std::uint32_t count)
+{
+    AudioRenderer::setVoiceBudget(std::max(1u, count));
+}
+
 bool AudioMixer::hasAudioRenderer()
 {
     return AudioRenderer::isValid();
@@ -130,4 +169,19 @@ bool AudioMixer::hasAudioRenderer()
 void AudioMixer::printDebug()
 {
     AudioRenderer::printDebug();
-}
\ No newline at end of file
+}
+
+//private
+void AudioMixer::updateChannel(std::uint8_t channel)
+{
+    if (AudioRenderer::mixesChannels())
+    {
+        Detail::MixerChannel properties;
+        properties.gain = m_channels[channel] * m_prefadeChannels[channel];
+        properties.lowPassCutoff = m_lowPassCutoffs[channel];
+        properties.duckAmount = m_duckAmounts[channel];
+        properties.duckKey = m_duckKeys[channel];
+
+        AudioRenderer::setMixerChannel(channel, properties);
+    }
+}
@@ -29,6 +29,7 @@ source distribution.
 
 #include "AudioRenderer.hpp"
 #include "OpenALImpl.hpp"
+#include "SoftwareMixerImpl.hpp"
 //#include "SDLMixerImpl.hpp"
 #include "NullImpl.hpp"
 
@@ -46,7 +47,9 @@ namespace
 
 bool AudioRenderer::init()
 {
-#ifdef AL_AUDIO
+#ifdef CRO_SOFTWARE_MIXER
+    m_impl = std::make_unique<Detail::SoftwareMixerImpl>();
+#elif defined(AL_AUDIO)
     m_impl = std::make_unique<Detail::OpenALImpl>();
 #elif defined(SDL_AUDIO)
     m_impl = std::make_unique<Detail::SDLMixerImpl>();
@@ -57,6 +60,11 @@ bool AudioRenderer::init()
 
     if (!valid) m_impl = std::make_unique<Detail::NullImpl>();
 
+    for (auto i = 0u; i < AudioMixer::MaxChannels; ++i)
+    {
+        AudioMixer::updateChannel(static_cast<std::uint8_t>(i));
+    }
+
     return valid;
 }
 
@@ -221,6 +229,34 @@ void AudioRenderer::setSpeedOfSound(float speed)
     m_impl->setSpeedOfSound(std::max(0.01f, speed));
 }
 
+bool AudioRenderer::mixesChannels()
+{
+    return m_impl && m_impl->mixesChannels();
+}
+
+void AudioRenderer::setSourceChannel(std::int32_t src, std::uint8_t channel)
+{
+    CRO_ASSERT(channel < AudioMixer::MaxChannels, "Channel index out of range");
+    m_impl->setSourceChannel(src, channel);
+}
+
+void AudioRenderer::setMixerChannel(std::uint8_t channel, const Detail::MixerChannel& properties)
+{
+    CRO_ASSERT(channel < AudioMixer::MaxChannels, "Channel index out of range");
+    if (m_impl)
+    {
+        m_impl->setMixerChannel(channel, properties);
+    }
+}
+
+void AudioRenderer::setVoiceBudget(std::uint32_t count)
+{
+    if (m_impl)
+    {
+        m_impl->setVoiceBudget(count);
+    }
+}
+
 const std::string& AudioRenderer::getActiveDevice()
 {
     if (m_impl)
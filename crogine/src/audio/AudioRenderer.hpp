@@ -43,6 +43,15 @@ namespace cro
     namespace Detail
     {
         struct PCMData;
+
+        //the properties of an AudioMixer channel for renderers which mix channels themselves
+        struct MixerChannel final
+        {
+            float gain = 1.f; //channel volume * prefade volume
+            float lowPassCutoff = 0.f; //Hz, 0 is disabled
+            float duckAmount = 0.f;
+            std::uint8_t duckKey = 0; //channel which triggers ducking
+        };
     }
     
     /*!
@@ -114,6 +123,14 @@ namespace cro
         //called when the current device is resumed from sleep mode
         virtual void resume() {};
 
+        //optionally override these if the renderer mixes the AudioMixer
+        //channels itself, rather than having the channel volume applied
+        //to the volume of each source
+        virtual bool mixesChannels() const { return false; }
+        virtual void setSourceChannel(std::int32_t, std::uint8_t) {}
+        virtual void setMixerChannel(std::uint8_t, const Detail::MixerChannel&) {}
+        virtual void setVoiceBudget(std::uint32_t) {}
+
         //optionally override this to implement ImGui debug printing
         //*without* window begin/end
         virtual void printDebug() {}
@@ -332,6 +349,31 @@ namespace cro
         */
         static void setSpeedOfSound(float speed);
 
+        /*!
+        \brief Returns true if the active renderer applies the AudioMixer
+        channel volumes and effects itself, in which case the volume of
+        a source should not include its channel volume.
+        */
+        static bool mixesChannels();
+
+        /*!
+        \brief Sets the AudioMixer channel to which the source is routed.
+        This has no effect if the renderer doesn't mix channels itself.
+        */
+        static void setSourceChannel(std::int32_t src, std::uint8_t channel);
+
+        /*!
+        \brief Updates the properties of the given AudioMixer channel.
+        Used internally by the AudioMixer.
+        */
+        static void setMixerChannel(std::uint8_t channel, const Detail::MixerChannel& properties);
+
+        /*!
+        \brief Sets the maximum number of sources the renderer
+        should mix at once, if supported.
+        */
+        static void setVoiceBudget(std::uint32_t count);
+
         /*!
         \brief Return the string name of the currently active device if the
         current backend supports it.
@@ -30,6 +30,7 @@ source distribution.
 #include "BufferedStreamLoader.hpp"
 #include "AudioRenderer.hpp"
 #include "OpenALImpl.hpp"
+#include "SoftwareMixerImpl.hpp"
 
 #include <crogine/audio/DynamicAudioStream.hpp>
 
@@ -42,7 +43,14 @@ DynamicAudioStream::DynamicAudioStream(std::uint32_t channelCount, std::uint32_t
 
     if (AudioRenderer::isValid())
     {
-        setID(AudioRenderer::getImpl<Detail::OpenALImpl>()->requestNewBufferableStream(&m_bufferedStream, channelCount, samplerate));
+        if (auto* al = AudioRenderer::getImpl<Detail::OpenALImpl>(); al)
+        {
+            setID(al->requestNewBufferableStream(&m_bufferedStream, channelCount, samplerate));
+        }
+        else if (auto* mixer = AudioRenderer::getImpl<Detail::SoftwareMixerImpl>(); mixer)
+        {
+            setID(mixer->requestNewBufferableStream(&m_bufferedStream, channelCount, samplerate));
+        }
     }
 }
 
@@ -0,0 +1,222 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include "MixerDSP.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef CRO_MIXER_SSE
+#include <emmintrin.h>
+#endif
+
+using namespace cro::Detail;
+
+namespace
+{
+    constexpr float Q = 0.7071f; //butterworth
+    constexpr float Pi = 3.14159265359f;
+}
+
+void Mixer::mixMono(float* dst, const float* src, std::size_t frameCount, glm::vec2 gainStart, glm::vec2 gainEnd)
+{
+    const glm::vec2 step = (gainEnd - gainStart) / static_cast<float>(frameCount);
+    std::size_t i = 0;
+
+#ifdef CRO_MIXER_SSE
+    //each register holds 2 stereo frames, so the gains are interleaved LRLR
+    auto gainA = _mm_setr_ps(gainStart.x, gainStart.y, gainStart.x + step.x, gainStart.y + step.y);
+    auto gainB = _mm_add_ps(gainA, _mm_setr_ps(step.x * 2.f, step.y * 2.f, step.x * 2.f, step.y * 2.f));
+    const auto gainStep = _mm_setr_ps(step.x * 4.f, step.y * 4.f, step.x * 4.f, step.y * 4.f);
+
+    for (; i + 4 <= frameCount; i += 4)
+    {
+        const auto s = _mm_loadu_ps(src + i);
+        const auto lo = _mm_unpacklo_ps(s, s); //s0 s0 s1 s1
+        const auto hi = _mm_unpackhi_ps(s, s); //s2 s2 s3 s3
+
+        auto* d = dst + (i * 2);
+        _mm_storeu_ps(d, _mm_add_ps(_mm_loadu_ps(d), _mm_mul_ps(lo, gainA)));
+        _mm_storeu_ps(d + 4, _mm_add_ps(_mm_loadu_ps(d + 4), _mm_mul_ps(hi, gainB)));
+
+        gainA = _mm_add_ps(gainA, gainStep);
+        gainB = _mm_add_ps(gainB, gainStep);
+    }
+#endif
+
+    for (; i < frameCount; ++i)
+    {
+        const auto gain = gainStart + (step * static_cast<float>(i));
+        dst[i * 2] += src[i] * gain.x;
+        dst[(i * 2) + 1] += src[i] * gain.y;
+    }
+}
+
+void Mixer::mixStereo(float* dst, const float* src, std::size_t frameCount, glm::vec2 gainStart, glm::vec2 gainEnd)
+{
+    const glm::vec2 step = (gainEnd - gainStart) / static_cast<float>(frameCount);
+    std::size_t i = 0;
+
+#ifdef CRO_MIXER_SSE
+    auto gainA = _mm_setr_ps(gainStart.x, gainStart.y, gainStart.x + step.x, gainStart.y + step.y);
+    auto gainB = _mm_add_ps(gainA, _mm_setr_ps(step.x * 2.f, step.y * 2.f, step.x * 2.f, step.y * 2.f));
+    const auto gainStep = _mm_setr_ps(step.x * 4.f, step.y * 4.f, step.x * 4.f, step.y * 4.f);
+
+    for (; i + 4 <= frameCount; i += 4)
+    {
+        const auto* s = src + (i * 2);
+        auto* d = dst + (i * 2);
+        _mm_storeu_ps(d, _mm_add_ps(_mm_loadu_ps(d), _mm_mul_ps(_mm_loadu_ps(s), gainA)));
+        _mm_storeu_ps(d + 4, _mm_add_ps(_mm_loadu_ps(d + 4), _mm_mul_ps(_mm_loadu_ps(s + 4), gainB)));
+
+        gainA = _mm_add_ps(gainA, gainStep);
+        gainB = _mm_add_ps(gainB, gainStep);
+    }
+#endif
+
+    for (; i < frameCount; ++i)
+    {
+        const auto gain = gainStart + (step * static_cast<float>(i));
+        dst[i * 2] += src[i * 2] * gain.x;
+        dst[(i * 2) + 1] += src[(i * 2) + 1] * gain.y;
+    }
+}
+
+void Mixer::clip(float* dst, std::size_t sampleCount)
+{
+    std::size_t i = 0;
+
+#ifdef CRO_MIXER_SSE
+    const auto upper = _mm_set1_ps(1.f);
+    const auto lower = _mm_set1_ps(-1.f);
+    for (; i + 4 <= sampleCount; i += 4)
+    {
+        _mm_storeu_ps(dst + i, _mm_max_ps(lower, _mm_min_ps(upper, _mm_loadu_ps(dst + i))));
+    }
+#endif
+
+    for (; i < sampleCount; ++i)
+    {
+        dst[i] = std::clamp(dst[i], -1.f, 1.f);
+    }
+}
+
+float Mixer::peak(const float* src, std::size_t sampleCount)
+{
+    float result = 0.f;
+    std::size_t i = 0;
+
+#ifdef CRO_MIXER_SSE
+    //clearing the sign bit gives the absolute value
+    const auto absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    auto maxVal = _mm_setzero_ps();
+    for (; i + 4 <= sampleCount; i += 4)
+    {
+        maxVal = _mm_max_ps(maxVal, _mm_and_ps(_mm_loadu_ps(src + i), absMask));
+    }
+
+    alignas(16) float values[4];
+    _mm_store_ps(values, maxVal);
+    result = std::max(std::max(values[0], values[1]), std::max(values[2], values[3]));
+#endif
+
+    for (; i < sampleCount; ++i)
+    {
+        result = std::max(result, std::abs(src[i]));
+    }
+    return result;
+}
+
+//low pass
+void Mixer::LowPass::setCutoff(float cutoff, float sampleRate)
+{
+    if (cutoff == m_cutoff)
+    {
+        return;
+    }
+
+    const bool wasEnabled = m_enabled;
+
+    m_cutoff = cutoff;
+    m_enabled = cutoff > 0.f && cutoff < sampleRate * 0.45f;
+
+    if (m_enabled)
+    {
+        //RBJ cookbook coefficients
+        const float w0 = 2.f * Pi * (cutoff / sampleRate);
+        const float cosW = std::cos(w0);
+        const float alpha = std::sin(w0) / (2.f * Q);
+        const float a0 = 1.f + alpha;
+
+        m_b0 = ((1.f - cosW) / 2.f) / a0;
+        m_b1 = (1.f - cosW) / a0;
+        m_b2 = m_b0;
+        m_a1 = (-2.f * cosW) / a0;
+        m_a2 = (1.f - alpha) / a0;
+
+        if (!wasEnabled)
+        {
+            reset();
+        }
+    }
+}
+
+void Mixer::LowPass::process(float* samples, std::size_t frameCount)
+{
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    //transposed direct form II. This is inherently serial
+    //so each channel is processed with scalar code
+    for (auto c = 0u; c < 2u; ++c)
+    {
+        float z1 = m_z1[c];
+        float z2 = m_z2[c];
+
+        for (auto i = 0u; i < frameCount; ++i)
+        {
+            auto& s = samples[(i * 2) + c];
+            const float out = (m_b0 * s) + z1;
+            z1 = (m_b1 * s) - (m_a1 * out) + z2;
+            z2 = (m_b2 * s) - (m_a2 * out);
+            s = out;
+        }
+
+        m_z1[c] = z1;
+        m_z2[c] = z2;
+    }
+}
+
+void Mixer::LowPass::reset()
+{
+    m_z1 = {};
+    m_z2 = {};
+}
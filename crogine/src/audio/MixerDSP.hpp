@@ -0,0 +1,105 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <crogine/detail/glm/vec2.hpp>
+
+#include <array>
+#include <cstddef>
+
+//SIMD mixing kernels used by the software mixer. These fall
+//back to scalar code on platforms without SSE2
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CRO_MIXER_SSE
+#endif
+
+namespace cro
+{
+    namespace Detail
+    {
+        namespace Mixer
+        {
+            /*!
+            \brief Adds a mono signal to an interleaved stereo buffer.
+            The left and right gains are linearly ramped from gainStart
+            to gainEnd over the course of the buffer, to prevent clicks
+            when gain changes between blocks.
+            */
+            void mixMono(float* dst, const float* src, std::size_t frameCount, glm::vec2 gainStart, glm::vec2 gainEnd);
+
+            /*!
+            \brief Adds an interleaved stereo signal to an interleaved stereo buffer.
+            \see mixMono()
+            */
+            void mixStereo(float* dst, const float* src, std::size_t frameCount, glm::vec2 gainStart, glm::vec2 gainEnd);
+
+            /*!
+            \brief Clamps all samples to the range -1 to 1
+            */
+            void clip(float* dst, std::size_t sampleCount);
+
+            /*!
+            \brief Returns the absolute peak value of the given samples
+            */
+            float peak(const float* src, std::size_t sampleCount);
+
+            /*!
+            \brief Second order low-pass filter for interleaved stereo signals
+            */
+            class LowPass final
+            {
+            public:
+                /*!
+                \brief Sets the cutoff frequency in Hz.
+                Frequencies above (roughly) Nyquist disable the filter
+                */
+                void setCutoff(float cutoff, float sampleRate);
+                float getCutoff() const { return m_cutoff; }
+                bool enabled() const { return m_enabled; }
+
+                void process(float* samples, std::size_t frameCount);
+                void reset();
+
+            private:
+                float m_cutoff = 0.f;
+                bool m_enabled = false;
+
+                float m_b0 = 1.f;
+                float m_b1 = 0.f;
+                float m_b2 = 0.f;
+                float m_a1 = 0.f;
+                float m_a2 = 0.f;
+
+                std::array<float, 2u> m_z1 = {};
+                std::array<float, 2u> m_z2 = {};
+            };
+        }
+    }
+}
@@ -38,6 +38,7 @@ source distribution.
 #include <crogine/util/String.hpp>
 #include <crogine/core/App.hpp>
 #include <crogine/core/FileSystem.hpp>
+#include <crogine/core/Profiler.hpp>
 #include <crogine/gui/Gui.hpp>
 
 //oh apple you so quirky
@@ -47,6 +48,7 @@ source distribution.
 #endif
 
 #include <array>
+#include <chrono>
 
 using namespace cro;
 using namespace cro::Detail;
@@ -55,6 +57,38 @@ namespace
 {
     constexpr std::size_t STREAM_CHUNK_SIZE = 32768;// 48000u * sizeof(std::uint16_t) * 30; //30 sec of stereo @ highest quality (mono)
 
+    //how long the stream thread may sleep if no stream needs it sooner
+    constexpr float MaxStreamWait = 0.5f;
+    //how soon to retry a stream which had no data available, eg a network stream
+    constexpr float StreamRetryTime = 0.01f;
+
+    float getDuration(const PCMData& data)
+    {
+        std::uint32_t frameSize = 1;
+        switch (data.format)
+        {
+        default: break;
+        case PCMData::Format::MONO16:
+        case PCMData::Format::STEREO8:
+            frameSize = 2;
+            break;
+        case PCMData::Format::STEREO16:
+            frameSize = 4;
+            break;
+        }
+
+        if (data.frequency == 0)
+        {
+            return 0.f;
+        }
+        return static_cast<float>(data.size / frameSize) / data.frequency;
+    }
+
+#ifdef AL_SOFT_events
+    LPALEVENTCONTROLSOFT alEventControlSOFT = nullptr;
+    LPALEVENTCALLBACKSOFT alEventCallbackSOFT = nullptr;
+#endif
+
     ALenum getFormatFromData(const PCMData& data)
     {
         switch (data.format)
@@ -76,7 +110,10 @@ OpenALImpl::OpenALImpl()
     : m_device          (nullptr),
     m_context           (nullptr),
     m_nextFreeStream    (0),
-    m_nextFreeSource    (0)
+    m_nextFreeSource    (0),
+    m_streamEvent       (false),
+    m_streamThreadRunning(false),
+    m_bufferEvents      (false)
 {
     for (auto i = 0u; i < m_streamIDs.size(); ++i)
     {
@@ -136,6 +173,14 @@ bool OpenALImpl::init()
         m_devices.push_back("default");
     }
 
+    if (current)
+    {
+        enableBufferEvents();
+
+        m_streamThreadRunning = true;
+        m_streamThread = std::thread(&OpenALImpl::streamThreadFunc, this);
+    }
+
     return current;
 }
 
@@ -144,11 +189,21 @@ void OpenALImpl::shutdown()
     unregisterWindows();
     removeCommands();
 
-    for (auto i = 0u; i < m_nextFreeSource; ++i)
+    //the stream thread queries and requeues buffers on pooled
+    //sources so it must be stopped before anything is deleted
+    if (m_streamThread.joinable())
     {
-        deleteAudioSource(m_sourcePool[i]);
+        m_streamThreadRunning = false;
+        wakeStreamThread();
+        m_streamThread.join();
     }
-    alCheck(alDeleteSources(static_cast<ALsizei>(m_sourcePool.size()), m_sourcePool.data()));
+
+#ifdef AL_SOFT_events
+    if (m_bufferEvents)
+    {
+        alEventCallbackSOFT(nullptr, nullptr);
+    }
+#endif
 
     //make sure to close any open streams
     for (auto i = 0u; i < m_streams.size(); ++i)
@@ -160,6 +215,12 @@ void OpenALImpl::shutdown()
         deleteStream(i);
     }
 
+    for (auto i = 0u; i < m_nextFreeSource; ++i)
+    {
+        deleteAudioSource(m_sourcePool[i]);
+    }
+    alCheck(alDeleteSources(static_cast<ALsizei>(m_sourcePool.size()), m_sourcePool.data()));
+
     alcCheck(alcMakeContextCurrent(nullptr), m_device);
     alcCheck(alcDestroyContext(m_context), m_device);
     alcCheck(alcCloseDevice(m_device), m_device);
@@ -352,15 +413,10 @@ void OpenALImpl::deleteStream(std::int32_t id)
     {
         alCheck(alSourceStop(stream.sourceID));
     }
-    stream.running = false;
 
-    if (stream.thread)
-    {
-        //we can't just detach as we need to reset the
-        //thread pointer.
-        stream.thread->join();
-        stream.thread.reset();
-    }
+    //once this is released the stream thread will skip this stream
+    std::scoped_lock lock(stream.mutex);
+    stream.running = false;
 
     if (stream.buffers[0])
     {
@@ -375,6 +431,8 @@ void OpenALImpl::deleteStream(std::int32_t id)
         stream.audioFile.reset();
         stream.currentBuffer = 0;
         stream.sourceID = -1;
+        stream.nextChunkReady = false;
+        stream.state = AL_STOPPED;
 
         m_nextFreeStream--;
 
@@ -415,12 +473,12 @@ std::int32_t OpenALImpl::requestAudioSource(std::int32_t buffer, bool streaming)
         {
             //sync with the stream thread...
             auto& stream = m_streams[buffer];
-            while (stream.busy) {}
-
-            stream.accessed = true;
-            stream.sourceID = source;
-            alCheck(alSourceQueueBuffers(source, static_cast<ALsizei>(stream.buffers.size()), stream.buffers.data()));
-            stream.accessed = false;
+            {
+                std::scoped_lock lock(stream.mutex);
+                stream.sourceID = source;
+                alCheck(alSourceQueueBuffers(source, static_cast<ALsizei>(stream.buffers.size()), stream.buffers.data()));
+            }
+            wakeStreamThread();
         }
 
         return source;
@@ -451,13 +509,12 @@ void OpenALImpl::updateAudioSource(std::int32_t sourceID, std::int32_t bufferID,
     else
     {
         auto& stream = m_streams[bufferID];
-
-        while (stream.busy) {}
-
-        stream.accessed = true;
-        stream.sourceID = sourceID;
-        alCheck(alSourceQueueBuffers(sourceID, static_cast<ALsizei>(stream.buffers.size()), stream.buffers.data()));
-        stream.accessed = false;
+        {
+            std::scoped_lock lock(stream.mutex);
+            stream.sourceID = sourceID;
+            alCheck(alSourceQueueBuffers(sourceID, static_cast<ALsizei>(stream.buffers.size()), stream.buffers.data()));
+        }
+        wakeStreamThread();
     }
 }
 
@@ -502,7 +559,7 @@ void OpenALImpl::deleteAudioSource(std::int32_t source)
 void OpenALImpl::playSource(std::int32_t source, bool looped)
 {
     //OpenAL is supposed to be thread safe according to the spec
-    //so we only sync stream threads if we actually touch a stream
+    //so we only sync with the stream thread if we actually touch a stream
     //object and modify it.
 
     ALuint src = static_cast<ALuint>(source);
@@ -519,13 +576,14 @@ void OpenALImpl::playSource(std::int32_t source, bool looped)
     }
     else
     {
-        while (result->busy) {}
-
-        result->accessed = true;
         result->looped = looped;
-        result->accessed = false;
     }
     alCheck(alSourcePlay(src));
+
+    if (result != m_streams.end())
+    {
+        wakeStreamThread();
+    }
 }
 
 void OpenALImpl::pauseSource(std::int32_t source)
@@ -539,6 +597,9 @@ void OpenALImpl::stopSource(std::int32_t source)
 {
     ALuint src = static_cast<ALuint>(source);
     alCheck(alSourceStop(src));
+
+    //make sure streams are rewound promptly
+    wakeStreamThread();
 }
 
 void OpenALImpl::setPlayingOffset(std::int32_t source, cro::Time offset)
@@ -562,11 +623,9 @@ void OpenALImpl::setPlayingOffset(std::int32_t source, cro::Time offset)
     }
     else
     {
-        while (result->busy) {}
-
-        result->accessed = true;
+        std::scoped_lock lock(result->mutex);
         result->audioFile->seek(offset);
-        result->accessed = false;
+        result->nextChunkReady = false; //this was decoded from the old position
     }
 }
 
@@ -855,12 +914,12 @@ std::string OpenALImpl::getPreferencePath() const
 
 OpenALStream& OpenALImpl::getNextFreeStream()
 {
-    //we shouldn't have to lock here as the stream's thread has not yet been created
+    //we shouldn't have to lock here as the stream thread ignores streams which aren't running
     auto streamID = m_streamIDs[m_nextFreeStream];
 
     //attempt to open the file
     auto& stream = m_streams[streamID];
-    CRO_ASSERT(!stream.thread, "this shouldn't be running yet!");
+    CRO_ASSERT(!stream.running, "this shouldn't be running yet!");
     stream.streamID = streamID;
 
     return stream;
@@ -877,10 +936,14 @@ bool OpenALImpl::initStream(OpenALStream& stream)
         {
             auto& audioData = stream.audioFile->getData(STREAM_CHUNK_SIZE);
             alCheck(alBufferData(b, getFormatFromData(audioData), audioData.data, audioData.size, audioData.frequency));
+            stream.chunkDuration = getDuration(audioData);
         }
 
+        stream.currentBuffer = 0;
+        stream.nextChunkReady = false;
+        stream.state = AL_STOPPED;
         stream.running = true;
-        stream.thread = std::make_unique<std::thread>(&OpenALStream::updateStream, &stream);
+        wakeStreamThread();
 
         //hurrah we has stream
         m_nextFreeStream++;
@@ -971,75 +1034,166 @@ void OpenALImpl::reconnect(const char* deviceStr)
     }
 }
 
-//stream thread function
-void OpenALStream::updateStream()
+void OpenALImpl::enableBufferEvents()
 {
-    //this is called by a stream's thread
-    while (running)
+#ifdef AL_SOFT_events
+    if (alIsExtensionPresent("AL_SOFT_events"))
     {
-        //wait for the main thread to finish what it's
-        //doing to the stream
-        while (accessed) {}
+        alEventControlSOFT = reinterpret_cast<LPALEVENTCONTROLSOFT>(alGetProcAddress("alEventControlSOFT"));
+        alEventCallbackSOFT = reinterpret_cast<LPALEVENTCALLBACKSOFT>(alGetProcAddress("alEventCallbackSOFT"));
 
-        //check if we need update
-        busy = true;
-
-        if (sourceID > -1)
+        if (alEventControlSOFT && alEventCallbackSOFT)
         {
-            std::int32_t processed = 0;
-            alCheck(alGetSourcei(sourceID, AL_BUFFERS_PROCESSED, &processed));
+            const std::array<ALenum, 2u> types = { AL_EVENT_TYPE_BUFFER_COMPLETED_SOFT, AL_EVENT_TYPE_SOURCE_STATE_CHANGED_SOFT };
+            alEventCallbackSOFT(&OpenALImpl::bufferEventCallback, this);
+            alEventControlSOFT(static_cast<ALsizei>(types.size()), types.data(), AL_TRUE);
 
-            //if stopped rewind file and load buffers
-            ALenum newState;
-            alCheck(alGetSourcei(sourceID, AL_SOURCE_STATE, &newState));
-            if (newState != state && newState == AL_STOPPED)
-            {
-                audioFile->seek(cro::Time());
-                processed = static_cast<ALint>(buffers.size());
-            }
+            m_bufferEvents = true;
+            LogI << "OpenAL: Using buffer events for audio streams" << std::endl;
+        }
+    }
+#endif
+}
+
+void OpenALImpl::wakeStreamThread()
+{
+    {
+        std::scoped_lock lock(m_streamThreadMutex);
+        m_streamEvent = true;
+    }
+    m_streamCondition.notify_one();
+}
+
+#ifdef AL_SOFT_events
+void AL_APIENTRY OpenALImpl::bufferEventCallback(ALenum, ALuint, ALuint, ALsizei, const ALchar*, void* userParam) noexcept
+{
+    static_cast<OpenALImpl*>(userParam)->wakeStreamThread();
+}
+#endif
+
+//stream thread function
+void OpenALImpl::streamThreadFunc()
+{
+    cro::Profiler::setThreadName("Audio Streams");
+
+    while (m_streamThreadRunning)
+    {
+        float nextUpdate = MaxStreamWait;
 
-            //update the buffers if necessary
-            if (processed > 0
-                && (state == AL_PLAYING))
+        {
+            CRO_PROFILE_SCOPE("OpenALImpl::updateStreams");
+            for (auto& stream : m_streams)
             {
-                for (auto i = 0; i < processed; ++i)
+                if (stream.running)
                 {
-                    //fill buffer
-                    const auto& data = audioFile->getData(STREAM_CHUNK_SIZE, looped);
-                    if (data.size > 0) //only update if we have data else we'll loop even if we don't want to
+                    std::scoped_lock lock(stream.mutex);
+
+                    //check again in case the stream was deleted while we were waiting
+                    if (stream.running)
                     {
-                        //unqueue
-                        alCheck(alSourceUnqueueBuffers(sourceID, 1, &buffers[currentBuffer]));
+                        nextUpdate = std::min(nextUpdate, stream.update());
+                    }
+                }
+            }
+        }
 
-                        //refill
-                        alCheck(alBufferData(buffers[currentBuffer], getFormatFromData(data), data.data, data.size, data.frequency));
+        //buffer events wake this up when they happen, but we
+        //still need the timeout in case they aren't available
+        std::unique_lock lock(m_streamThreadMutex);
+        m_streamCondition.wait_for(lock, std::chrono::duration<float>(nextUpdate), [&]() { return m_streamEvent || !m_streamThreadRunning; });
+        m_streamEvent = false;
+    }
+}
 
-                        //requeue
-                        alCheck(alSourceQueueBuffers(sourceID, 1, &buffers[currentBuffer]));
+bool OpenALStream::decodeAhead()
+{
+    if (!nextChunkReady)
+    {
+        const auto& data = audioFile->getData(STREAM_CHUNK_SIZE, looped);
+        if (data.size > 0) //only update if we have data else we'll loop even if we don't want to
+        {
+            const auto* begin = static_cast<const std::uint8_t*>(data.data);
+            nextChunk.assign(begin, begin + data.size);
 
-                        //increment currentBuffer
-                        currentBuffer = (currentBuffer + 1) % buffers.size();
-                    }
-                }
+            nextChunkData = data;
+            nextChunkData.data = nextChunk.data();
+            nextChunkReady = true;
+        }
+    }
+    return nextChunkReady;
+}
 
-                busy = false;
-                processed = 0;
-            }
-            else
+float OpenALStream::update()
+{
+    //this is called by the stream thread with the stream locked
+    if (sourceID < 0)
+    {
+        return MaxStreamWait;
+    }
+
+    std::int32_t processed = 0;
+    alCheck(alGetSourcei(sourceID, AL_BUFFERS_PROCESSED, &processed));
+
+    //if stopped rewind file and load buffers
+    ALenum newState;
+    alCheck(alGetSourcei(sourceID, AL_SOURCE_STATE, &newState));
+    if (newState != state && newState == AL_STOPPED)
+    {
+        audioFile->seek(cro::Time());
+        nextChunkReady = false;
+        processed = static_cast<ALint>(buffers.size());
+    }
+
+    float nextUpdate = MaxStreamWait;
+
+    //update the buffers if necessary
+    if (processed > 0
+        && (state == AL_PLAYING))
+    {
+        //refill as many buffers as we have data for, then queue them together
+        std::array<ALuint, 4u> refilled = {};
+        std::size_t refillCount = 0;
+
+        for (auto i = 0; i < processed; ++i)
+        {
+            if (!decodeAhead())
             {
-                //sleep for a bit
-                //it's important to sleep *after* the busy flag is set to
-                //false as this is the time the main thread might set the 'accessed' flag
-                busy = false;
-                std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(50));
+                //try again shortly
+                nextUpdate = StreamRetryTime;
+                break;
             }
-            state = newState;
+
+            //unqueue
+            alCheck(alSourceUnqueueBuffers(sourceID, 1, &buffers[currentBuffer]));
+
+            //refill
+            alCheck(alBufferData(buffers[currentBuffer], getFormatFromData(nextChunkData), nextChunkData.data, nextChunkData.size, nextChunkData.frequency));
+            chunkDuration = getDuration(nextChunkData);
+            nextChunkReady = false;
+
+            refilled[refillCount++] = buffers[currentBuffer];
+
+            //increment currentBuffer
+            currentBuffer = (currentBuffer + 1) % buffers.size();
         }
-        else
+
+        //requeue
+        if (refillCount != 0)
         {
-            //sleep for a bit
-            busy = false;
-            std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(50));
+            alCheck(alSourceQueueBuffers(sourceID, static_cast<ALsizei>(refillCount), refilled.data()));
         }
     }
+    state = newState;
+
+    if (state == AL_PLAYING)
+    {
+        //decode the next chunk while the queued buffers play
+        //so it's ready as soon as the next buffer is processed
+        decodeAhead();
+
+        //service the stream before the queue runs dry
+        nextUpdate = std::min(nextUpdate, std::max(StreamRetryTime, chunkDuration / 2.f));
+    }
+
+    return nextUpdate;
 }
@@ -46,8 +46,11 @@ source distribution.
 
 #include <atomic>
 #include <array>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 #include <memory>
+#include <vector>
 
 namespace cro
 {
@@ -61,14 +64,21 @@ namespace cro
             std::array<ALuint, 4u> buffers{};
             std::size_t currentBuffer = 0;
             std::int32_t streamID = -1; //NOT the same as source ID!
-            //ALint processed = 0;
 
-            std::atomic<bool> busy{ false }; //signifies the thread is processing
-            std::atomic<bool> running{ false }; //signifies the thread is running
-            std::atomic<bool> accessed{ false }; //signifies the main thread is modifying the stream
-            
-            std::unique_ptr<std::thread> thread;
-            void updateStream(); //runs in own thread
+            //held by the stream thread while servicing the stream
+            //and by the main thread while modifying it
+            std::mutex mutex;
+            std::atomic<bool> running{ false }; //signifies the stream is serviced by the stream thread
+
+            //the next chunk is decoded ahead so that it's ready
+            //to queue as soon as a buffer has been processed
+            std::vector<std::uint8_t> nextChunk;
+            PCMData nextChunkData;
+            bool nextChunkReady = false;
+            float chunkDuration = 0.f; //seconds
+
+            bool decodeAhead();
+            float update(); //returns the time in seconds until this next needs servicing
 
             std::int32_t sourceID = -1;
             std::atomic<bool> looped{ false };
@@ -157,6 +167,24 @@ namespace cro
             OpenALStream& getNextFreeStream();
             bool initStream(OpenALStream&);
 
+            //a single thread services all streams, woken when a buffer is
+            //processed (if AL_SOFT_events is available), when a stream is
+            //modified, or when the next stream is due to run low on data
+            std::thread m_streamThread;
+            std::mutex m_streamThreadMutex;
+            std::condition_variable m_streamCondition;
+            bool m_streamEvent;
+            std::atomic_bool m_streamThreadRunning;
+            bool m_bufferEvents;
+
+            void streamThreadFunc();
+            void wakeStreamThread();
+            void enableBufferEvents();
+#ifdef AL_SOFT_events
+            //called from OpenAL's mixer thread, so mustn't call back into OpenAL
+            static void AL_APIENTRY bufferEventCallback(ALenum, ALuint, ALuint, ALsizei, const ALchar*, void*) noexcept;
+#endif
+
             void refreshDeviceList();
             void reconnect(const char*);
         };
@@ -0,0 +1,1215 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include "SoftwareMixerImpl.hpp"
+#include "BufferedStreamLoader.hpp"
+#include "WavLoader.hpp"
+#include "VorbisLoader.hpp"
+#include "Mp3Loader.hpp"
+
+#include <crogine/core/App.hpp>
+#include <crogine/core/Console.hpp>
+#include <crogine/core/FileSystem.hpp>
+#include <crogine/core/Log.hpp>
+#include <crogine/core/Profiler.hpp>
+#include <crogine/gui/Gui.hpp>
+#include <crogine/detail/glm/geometric.hpp>
+
+#include <SDL_rwops.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+using namespace cro;
+using namespace cro::Detail;
+
+namespace
+{
+    constexpr std::size_t StreamChunkSize = 32768; //bytes
+    constexpr std::size_t StreamRingSize = StreamChunkSize * 4; //samples - a chunk of 8 bit data decodes to StreamChunkSize samples
+    constexpr float RefDistance = 1.f; //matches the OpenAL default
+    constexpr float MinAudibility = 0.0001f; //quieter than this is virtualised regardless of budget
+    constexpr float DuckThreshold = 0.02f; //key level at which ducking is fully applied
+    constexpr float DuckRelease = 0.3f; //seconds
+    constexpr float Pi = 3.14159265359f;
+
+    //frames queued ahead of the audio device
+    constexpr std::uint32_t TargetLatency = SoftwareMixerImpl::BlockSize * 3;
+    constexpr std::uint32_t BlockBytes = SoftwareMixerImpl::BlockSize * 2 * sizeof(float);
+
+    std::uint32_t getChannelCount(PCMData::Format format)
+    {
+        return (format == PCMData::Format::STEREO8 || format == PCMData::Format::STEREO16) ? 2 : 1;
+    }
+
+    std::size_t getSampleCount(const PCMData& data)
+    {
+        return (data.format == PCMData::Format::MONO8 || data.format == PCMData::Format::STEREO8)
+            ? data.size : data.size / sizeof(std::int16_t);
+    }
+
+    //converts the PCM data to float, passing each sample to dst
+    template <typename Func>
+    void convertPCM(const PCMData& data, Func&& dst)
+    {
+        const auto count = getSampleCount(data);
+        if (data.format == PCMData::Format::MONO8
+            || data.format == PCMData::Format::STEREO8)
+        {
+            const auto* src = static_cast<const std::uint8_t*>(data.data);
+            for (auto i = 0u; i < count; ++i)
+            {
+                dst((static_cast<float>(src[i]) - 128.f) / 128.f);
+            }
+        }
+        else
+        {
+            const auto* src = static_cast<const std::int16_t*>(data.data);
+            for (auto i = 0u; i < count; ++i)
+            {
+                dst(static_cast<float>(src[i]) / 32768.f);
+            }
+        }
+    }
+
+    //converts the PCM data to float and appends it to dst
+    void appendPCM(std::vector<float>& dst, const PCMData& data)
+    {
+        dst.reserve(dst.size() + getSampleCount(data));
+        convertPCM(data, [&dst](float sample) { dst.push_back(sample); });
+    }
+
+    std::unique_ptr<AudioFile> openAudioFile(const std::string& path)
+    {
+        std::unique_ptr<AudioFile> file;
+
+        const auto ext = FileSystem::getFileExtension(path);
+        if (ext == ".wav")
+        {
+            file = std::make_unique<WavLoader>();
+        }
+        else if (ext == ".ogg")
+        {
+            file = std::make_unique<VorbisLoader>();
+        }
+        else if (ext == ".mp3")
+        {
+            file = std::make_unique<Mp3Loader>();
+        }
+        else
+        {
+            LogE << ext << ": format not supported" << std::endl;
+            return file;
+        }
+
+        if (!file->open(FileSystem::getResourcePath() + path))
+        {
+            LogE << "Failed to open " << path << std::endl;
+            file.reset();
+        }
+        return file;
+    }
+
+    template <typename T>
+    void writeValue(SDL_RWops* file, T value)
+    {
+        SDL_RWwrite(file, &value, sizeof(T), 1);
+    }
+}
+
+SoftwareMixerImpl::SoftwareMixerImpl()
+    : m_nextBufferID    (1),
+    m_listenerPosition  (0.f),
+    m_listenerRight     (1.f, 0.f, 0.f),
+    m_listenerVolume    (1.f),
+    m_voiceBudget       (DefaultVoiceBudget),
+    m_device            (0),
+#ifdef AL_AUDIO
+    m_alDevice          (nullptr),
+    m_alContext         (nullptr),
+#endif
+    m_running           (false),
+    m_captureSize       (0),
+    m_realVoiceCount    (0),
+    m_virtualVoiceCount (0),
+    m_mixTime           (0.f)
+{
+
+}
+
+//public
+bool SoftwareMixerImpl::init()
+{
+    if (SDL_WasInit(SDL_INIT_AUDIO) == 0
+        && SDL_InitSubSystem(SDL_INIT_AUDIO) != 0)
+    {
+        LogW << "Software Mixer: " << SDL_GetError() << std::endl;
+    }
+
+    for (auto& bus : m_buses)
+    {
+        bus.samples.resize(BlockSize * 2);
+    }
+    m_voiceBuffer.resize(BlockSize * 2);
+    m_outputBuffer.resize(BlockSize * 2);
+    m_decodeJobs.reserve(MaxStreams);
+
+    if (!openDevice())
+    {
+        LogW << "Software Mixer: No audio device available, mixing to null output" << std::endl;
+    }
+    createALContext();
+
+    m_running = true;
+    m_mixThread = std::thread(&SoftwareMixerImpl::mixThreadFunc, this);
+
+    registerCommand("mixer_capture",
+        [&](const std::string&)
+        {
+            if (m_captureFile.file)
+            {
+                endCapture();
+                Console::print("Ended mixer capture");
+            }
+            else
+            {
+                const auto path = App::getPreferencePath() + "mixer_capture.wav";
+                if (beginCapture(path))
+                {
+                    Console::print("Capturing mixer output to " + path);
+                }
+            }
+        });
+
+    registerCommand("mixer_render",
+        [&](const std::string& params)
+        {
+            const float seconds = params.empty() ? 10.f : std::strtof(params.c_str(), nullptr);
+            const auto path = App::getPreferencePath() + "mixer_render.wav";
+            if (renderToFile(path, seconds))
+            {
+                Console::print("Rendered " + std::to_string(seconds) + "s to " + path);
+            }
+        });
+
+    LogI << "Using software mixer" << std::endl;
+
+    return true;
+}
+
+void SoftwareMixerImpl::shutdown()
+{
+    if (m_mixThread.joinable())
+    {
+        m_running = false;
+        m_mixThread.join();
+    }
+
+    endCapture();
+
+    if (m_device)
+    {
+        SDL_CloseAudioDevice(m_device);
+        m_device = 0;
+    }
+    destroyALContext();
+
+    m_voices.clear();
+    m_buffers.clear();
+    for (auto& stream : m_streams)
+    {
+        stream = Stream();
+    }
+}
+
+void SoftwareMixerImpl::setListenerPosition(glm::vec3 position)
+{
+    std::scoped_lock lock(m_mutex);
+    m_listenerPosition = position;
+}
+
+void SoftwareMixerImpl::setListenerOrientation(glm::vec3 forward, glm::vec3 up)
+{
+    const auto right = glm::cross(forward, up);
+    if (glm::dot(right, right) != 0)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_listenerRight = glm::normalize(right);
+    }
+}
+
+void SoftwareMixerImpl::setListenerVolume(float volume)
+{
+    {
+        std::scoped_lock lock(m_mutex);
+        m_listenerVolume = volume;
+    }
+
+#ifdef AL_AUDIO
+    //keeps the sound_system sources at the same volume
+    if (m_alContext)
+    {
+        alListenerf(AL_GAIN, volume);
+    }
+#endif
+}
+
+void SoftwareMixerImpl::setListenerVelocity(glm::vec3)
+{
+    //doppler isn't currently simulated
+}
+
+glm::vec3 SoftwareMixerImpl::getListenerPosition() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_listenerPosition;
+}
+
+std::int32_t SoftwareMixerImpl::requestNewBuffer(const std::string& path)
+{
+    auto file = openAudioFile(path);
+    if (file)
+    {
+        const auto& data = file->getData();
+        if (data.data)
+        {
+            return requestNewBuffer(data);
+        }
+    }
+    return -1;
+}
+
+std::int32_t SoftwareMixerImpl::requestNewBuffer(const PCMData& data)
+{
+    auto buffer = createBuffer(data);
+
+    std::scoped_lock lock(m_mutex);
+    auto id = m_nextBufferID++;
+    m_buffers.insert(std::make_pair(id, buffer));
+
+    return id;
+}
+
+void SoftwareMixerImpl::deleteBuffer(std::int32_t id)
+{
+    //any voice still using this buffer keeps it
+    //alive until the voice is updated or deleted
+    std::scoped_lock lock(m_mutex);
+    m_buffers.erase(id);
+}
+
+std::int32_t SoftwareMixerImpl::requestNewStream(const std::string& path)
+{
+    auto file = openAudioFile(path);
+    if (!file)
+    {
+        return -1;
+    }
+
+    auto data = std::make_shared<StreamData>();
+    data->channelCount = getChannelCount(file->getFormat());
+    data->samples.resize(StreamRingSize);
+    data->audioFile = std::move(file);
+
+    std::scoped_lock lock(m_mutex);
+    auto id = getFreeStream();
+    if (id != -1)
+    {
+        auto& stream = m_streams[id];
+        stream.channelCount = data->channelCount;
+        stream.data = std::move(data);
+        stream.used = true;
+    }
+    return id;
+}
+
+std::int32_t SoftwareMixerImpl::requestNewBufferableStream(BufferedStreamLoader** dstPtr, std::uint32_t channelCount, std::uint32_t sampleRate)
+{
+    std::scoped_lock lock(m_mutex);
+    auto id = getFreeStream();
+    if (id != -1)
+    {
+        auto data = std::make_shared<StreamData>();
+        data->audioFile = std::make_unique<BufferedStreamLoader>(channelCount, sampleRate);
+        data->channelCount = getChannelCount(data->audioFile->getFormat());
+        data->samples.resize(StreamRingSize);
+        *dstPtr = dynamic_cast<BufferedStreamLoader*>(data->audioFile.get());
+
+        auto& stream = m_streams[id];
+        stream.channelCount = data->channelCount;
+        stream.data = std::move(data);
+        stream.used = true;
+    }
+    return id;
+}
+
+void SoftwareMixerImpl::deleteStream(std::int32_t id)
+{
+    std::scoped_lock lock(m_mutex);
+    for (auto& voice : m_voices)
+    {
+        if (voice.streamID == id)
+        {
+            stopVoice(voice);
+            voice.streamID = -1;
+        }
+    }
+    m_streams[id] = Stream();
+}
+
+std::int32_t SoftwareMixerImpl::requestAudioSource(std::int32_t buffer, bool streaming)
+{
+    std::scoped_lock lock(m_mutex);
+
+    auto result = std::find_if(m_voices.begin(), m_voices.end(), [](const Voice& v) { return !v.used; });
+    if (result == m_voices.end())
+    {
+        result = m_voices.insert(m_voices.end(), Voice());
+    }
+
+    result->used = true;
+    if (streaming)
+    {
+        result->streamID = buffer;
+    }
+    else if (m_buffers.count(buffer))
+    {
+        result->buffer = m_buffers.at(buffer);
+    }
+
+    //IDs start at 1 as 0 is considered invalid by emitters
+    return static_cast<std::int32_t>(std::distance(m_voices.begin(), result)) + 1;
+}
+
+void SoftwareMixerImpl::updateAudioSource(std::int32_t src, std::int32_t buffer, bool streaming)
+{
+    std::scoped_lock lock(m_mutex);
+    if (auto* voice = getVoice(src); voice)
+    {
+        stopVoice(*voice);
+        voice->buffer.reset();
+        voice->streamID = -1;
+
+        if (streaming)
+        {
+            voice->streamID = buffer;
+        }
+        else if (m_buffers.count(buffer))
+        {
+            voice->buffer = m_buffers.at(buffer);
+        }
+    }
+}
+
+void SoftwareMixerImpl::deleteAudioSource(std::int32_t src)
+{
+    std::scoped_lock lock(m_mutex);
+    if (auto* voice = getVoice(src); voice)
+    {
+        stopVoice(*voice);
+        *voice = Voice();
+    }
+}
+
+void SoftwareMixerImpl::playSource(std::int32_t src, bool looped)
+{
+    std::scoped_lock lock(m_mutex);
+    if (auto* voice = getVoice(src); voice)
+    {
+        if (voice->state != 0)
+        {
+            //fade in from silence
+            voice->gain = glm::vec2(0.f);
+        }
+        voice->state = 0;
+        voice->looped = looped;
+    }
+}
+
+void SoftwareMixerImpl::pauseSource(std::int32_t src)
+{
+    std::scoped_lock lock(m_mutex);
+    if (auto* voice = getVoice(src); voice
+        && voice->state == 0)
+    {
+        voice->state = 1;
+    }
+}
+
+void SoftwareMixerImpl::stopSource(std::int32_t src)
+{
+    std::scoped_lock lock(m_mutex);
+    if (auto* voice = getVoice(src); voice)
+    {
+        stopVoice(*voice);
+    }
+}
+
+void SoftwareMixerImpl::setPlayingOffset(std::int32_t src, cro::Time offset)
+{
+    std::scoped_lock lock(m_mutex);
+    if (auto* voice = getVoice(src); voice
+        && voice->state != 2)
+    {
+        if (voice->streamID > -1)
+        {
+            auto& stream = m_streams[voice->streamID];
+            if (stream.data)
+            {
+                stream.seekPending = true;
+                stream.seekOffset = offset;
+                voice->position = 0.0;
+            }
+        }
+        else if (voice->buffer)
+        {
+            voice->position = offset.asSeconds() * voice->buffer->sampleRate;
+            if (voice->position >= voice->buffer->frameCount)
+            {
+                stopVoice(*voice);
+            }
+        }
+    }
+}
+
+std::int32_t SoftwareMixerImpl::getSourceState(std::int32_t src) const
+{
+    std::scoped_lock lock(m_mutex);
+    if (src > 0 && static_cast<std::size_t>(src) <= m_voices.size())
+    {
+        return m_voices[src - 1].state;
+    }
+    return 2;
+}
+
+void SoftwareMixerImpl::setSourcePosition(std::int32_t src, glm::vec3 position)
+{
+    std::scoped_lock lock(m_mutex);
+    if (auto* voice = getVoice(src); voice)
+    {
+        voice->worldPosition = position;
+    }
+}
+
+void SoftwareMixerImpl::setSourcePitch(std::int32_t src, float pitch)
+{
+    std::scoped_lock lock(m_mutex);
+    if (auto* voice = getVoice(src); voice)
+    {
+        voice->pitch = std::max(0.01f, pitch);
+    }
+}
+
+void SoftwareMixerImpl::setSourceVolume(std::int32_t src, float volume)
+{
+    std::scoped_lock lock(m_mutex);
+    if (auto* voice = getVoice(src); voice)
+    {
+        voice->volume = volume;
+    }
+}
+
+void SoftwareMixerImpl::setSourceRolloff(std::int32_t src, float rolloff)
+{
+    std::scoped_lock lock(m_mutex);
+    if (auto* voice = getVoice(src); voice)
+    {
+        voice->rolloff = rolloff;
+    }
+}
+
+void SoftwareMixerImpl::setSourceVelocity(std::int32_t, glm::vec3)
+{
+    //doppler isn't currently simulated
+}
+
+void SoftwareMixerImpl::playbackDisconnectEvent()
+{
+    std::scoped_lock lock(m_mutex);
+    if (m_device
+        && SDL_GetAudioDeviceStatus(m_device) == SDL_AUDIO_STOPPED)
+    {
+        SDL_CloseAudioDevice(m_device);
+        m_device = 0;
+
+        LogW << "Software Mixer: Audio device disconnected, mixing to null output" << std::endl;
+    }
+}
+
+void SoftwareMixerImpl::playbackConnectEvent()
+{
+    std::scoped_lock lock(m_mutex);
+    if (!m_device)
+    {
+        openDevice();
+    }
+}
+
+void SoftwareMixerImpl::setSourceChannel(std::int32_t src, std::uint8_t channel)
+{
+    std::scoped_lock lock(m_mutex);
+    if (auto* voice = getVoice(src); voice)
+    {
+        voice->channel = channel;
+    }
+}
+
+void SoftwareMixerImpl::setMixerChannel(std::uint8_t channel, const MixerChannel& properties)
+{
+    std::scoped_lock lock(m_mutex);
+    m_buses[channel].properties = properties;
+}
+
+void SoftwareMixerImpl::setVoiceBudget(std::uint32_t count)
+{
+    std::scoped_lock lock(m_mutex);
+    m_voiceBudget = count;
+}
+
+void SoftwareMixerImpl::printDebug()
+{
+    std::scoped_lock lock(m_mutex);
+
+    ImGui::Text("Output: %s", m_device ? "Audio Device" : "Null");
+    ImGui::Text("Voices: %u mixed, %u virtual (budget %u)",
+        static_cast<std::uint32_t>(m_realVoiceCount), static_cast<std::uint32_t>(m_virtualVoiceCount), m_voiceBudget);
+    ImGui::Text("Mix Time: %3.3fms / %3.3fms", m_mixTime, (static_cast<float>(BlockSize) / SampleRate) * 1000.f);
+    ImGui::Text("Capturing: %s", m_captureFile.file ? "Yes" : "No");
+
+    for (auto i = 0u; i < m_busLevels.size(); ++i)
+    {
+        ImGui::ProgressBar(std::min(1.f, m_busLevels[i]), ImVec2(80.f, 0.f), "");
+        ImGui::SameLine();
+        ImGui::Text("%s", AudioMixer::getLabel(static_cast<std::uint8_t>(i)).c_str());
+    }
+}
+
+bool SoftwareMixerImpl::renderToFile(const std::string& path, float seconds)
+{
+    RaiiRWops file;
+    if (!openWav(file, path))
+    {
+        return false;
+    }
+
+    const auto blockCount = static_cast<std::uint32_t>(std::ceil((std::max(0.f, seconds) * SampleRate) / BlockSize));
+
+    std::scoped_lock lock(m_decodeMutex, m_mutex);
+    for (auto i = 0u; i < blockCount; ++i)
+    {
+        collectDecodeJobs();
+        decodeStreams();
+        mixBlock();
+        SDL_RWwrite(file.file, m_outputBuffer.data(), BlockBytes, 1);
+    }
+    closeWav(file, blockCount * BlockBytes);
+
+    return true;
+}
+
+bool SoftwareMixerImpl::beginCapture(const std::string& path)
+{
+    endCapture();
+
+    RaiiRWops file;
+    if (openWav(file, path))
+    {
+        std::scoped_lock lock(m_mutex);
+        m_captureFile.file = file.file;
+        m_captureSize = 0;
+        file.file = nullptr;
+
+        return true;
+    }
+    return false;
+}
+
+void SoftwareMixerImpl::endCapture()
+{
+    std::scoped_lock lock(m_mutex);
+    if (m_captureFile.file)
+    {
+        closeWav(m_captureFile, m_captureSize);
+    }
+}
+
+//private
+SoftwareMixerImpl::Voice* SoftwareMixerImpl::getVoice(std::int32_t src)
+{
+    if (src > 0 && static_cast<std::size_t>(src) <= m_voices.size()
+        && m_voices[src - 1].used)
+    {
+        return &m_voices[src - 1];
+    }
+    return nullptr;
+}
+
+std::shared_ptr<SoftwareMixerImpl::SampleBuffer> SoftwareMixerImpl::createBuffer(const PCMData& data) const
+{
+    auto buffer = std::make_shared<SampleBuffer>();
+    buffer->channelCount = getChannelCount(data.format);
+    buffer->sampleRate = data.frequency;
+
+    appendPCM(buffer->samples, data);
+    buffer->frameCount = buffer->samples.size() / buffer->channelCount;
+
+    return buffer;
+}
+
+std::int32_t SoftwareMixerImpl::getFreeStream() const
+{
+    for (auto i = 0u; i < m_streams.size(); ++i)
+    {
+        if (!m_streams[i].used)
+        {
+            return static_cast<std::int32_t>(i);
+        }
+    }
+
+    LogW << "Software Mixer: Maximum number of streams has been reached!" << std::endl;
+    return -1;
+}
+
+void SoftwareMixerImpl::createALContext()
+{
+#ifdef AL_AUDIO
+    //MusicPlayer, SoundStream and VideoPlayer audio aren't mixed
+    //here, they still create OpenAL sources so need a context
+    m_alDevice = alcOpenDevice(nullptr);
+    if (m_alDevice)
+    {
+        m_alContext = alcCreateContext(m_alDevice, nullptr);
+        if (m_alContext
+            && alcMakeContextCurrent(m_alContext))
+        {
+            return;
+        }
+    }
+    destroyALContext();
+    LogE << "Software Mixer: Failed creating OpenAL context, music and video streams will be silent" << std::endl;
+#else
+    LogE << "Software Mixer: OpenAL is not available, music and video streams will be silent" << std::endl;
+#endif
+}
+
+void SoftwareMixerImpl::destroyALContext()
+{
+#ifdef AL_AUDIO
+    if (m_alContext)
+    {
+        alcMakeContextCurrent(nullptr);
+        alcDestroyContext(m_alContext);
+        m_alContext = nullptr;
+    }
+
+    if (m_alDevice)
+    {
+        alcCloseDevice(m_alDevice);
+        m_alDevice = nullptr;
+    }
+#endif
+}
+
+bool SoftwareMixerImpl::openDevice()
+{
+    SDL_AudioSpec want = {};
+    want.freq = SampleRate;
+    want.format = AUDIO_F32SYS;
+    want.channels = 2;
+    want.samples = BlockSize;
+    want.callback = nullptr; //we queue audio from the mix thread instead
+
+    //SDL converts the output if the device doesn't support this format
+    SDL_AudioSpec have = {};
+    m_device = SDL_OpenAudioDevice(nullptr, 0, &want, &have, 0);
+
+    if (m_device == 0)
+    {
+        LogW << "Software Mixer: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    SDL_PauseAudioDevice(m_device, 0);
+    return true;
+}
+
+void SoftwareMixerImpl::mixThreadFunc()
+{
+    cro::Profiler::setThreadName("Audio Mixer");
+
+    auto lastTime = std::chrono::steady_clock::now();
+    double nullFrames = 0.0;
+
+    while (m_running)
+    {
+        {
+            //decode outside of m_mutex so setting source properties
+            //from the game thread doesn't wait on the decoder
+            std::scoped_lock decodeLock(m_decodeMutex);
+            {
+                std::scoped_lock lock(m_mutex);
+                collectDecodeJobs();
+            }
+            decodeStreams();
+        }
+
+        {
+            std::scoped_lock lock(m_mutex);
+            const auto now = std::chrono::steady_clock::now();
+
+            if (m_device)
+            {
+                while (SDL_GetQueuedAudioSize(m_device) < TargetLatency * 2 * sizeof(float))
+                {
+                    mixBlock();
+                    SDL_QueueAudio(m_device, m_outputBuffer.data(), BlockBytes);
+                }
+                nullFrames = 0.0;
+            }
+            else
+            {
+                //mix in real time so that sources play (and stop) as they would with a device
+                nullFrames += std::chrono::duration<double>(now - lastTime).count() * SampleRate;
+                while (nullFrames >= BlockSize)
+                {
+                    mixBlock();
+                    nullFrames -= BlockSize;
+                }
+            }
+            lastTime = now;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+}
+
+void SoftwareMixerImpl::collectDecodeJobs()
+{
+    m_decodeJobs.clear();
+    for (const auto& voice : m_voices)
+    {
+        if (voice.used
+            && voice.streamID > -1)
+        {
+            auto& stream = m_streams[voice.streamID];
+            if (stream.data
+                && (voice.state == 0 || stream.seekPending))
+            {
+                auto& job = m_decodeJobs.emplace_back();
+                job.stream = stream.data;
+                job.looped = voice.looped;
+                job.seek = stream.seekPending;
+                job.offset = stream.seekOffset;
+
+                stream.seekPending = false;
+            }
+        }
+    }
+}
+
+void SoftwareMixerImpl::decodeStreams()
+{
+    CRO_PROFILE_SCOPE("SoftwareMixerImpl::decodeStreams");
+
+    for (auto& job : m_decodeJobs)
+    {
+        auto& stream = *job.stream;
+        if (job.seek)
+        {
+            stream.readIndex = 0;
+            stream.sampleCount = 0;
+            stream.ended = !stream.audioFile->seek(job.offset);
+        }
+
+        //top up the ring a whole chunk at a time
+        const auto capacity = stream.samples.size();
+        while (!stream.ended
+            && capacity - stream.sampleCount >= StreamChunkSize)
+        {
+            const auto& data = stream.audioFile->getData(StreamChunkSize, job.looped);
+            if (data.size == 0)
+            {
+                stream.ended = true;
+                break;
+            }
+
+            stream.channelCount = getChannelCount(data.format);
+            stream.sampleRate = data.frequency;
+
+            convertPCM(data, 
+                [&stream, capacity](float sample)
+                {
+                    stream.samples[(stream.readIndex + stream.sampleCount++) % capacity] = sample;
+                });
+        }
+    }
+
+    //release our references so deleted streams are freed
+    m_decodeJobs.clear();
+}
+
+void SoftwareMixerImpl::mixBlock()
+{
+    CRO_PROFILE_SCOPE("SoftwareMixerImpl::mixBlock");
+    const auto start = std::chrono::steady_clock::now();
+
+    for (auto& bus : m_buses)
+    {
+        std::fill(bus.samples.begin(), bus.samples.end(), 0.f);
+        bus.active = false;
+    }
+
+    m_activeVoices.clear();
+    for (auto& voice : m_voices)
+    {
+        if (voice.used && voice.state == 0)
+        {
+            updateVoiceGain(voice);
+            m_activeVoices.push_back(&voice);
+        }
+    }
+
+    //streams are always mixed as they can't be cheaply skipped,
+    //then the most audible sources are mixed up to the budget
+    std::sort(m_activeVoices.begin(), m_activeVoices.end(),
+        [](const Voice* a, const Voice* b)
+        {
+            if ((a->streamID > -1) != (b->streamID > -1))
+            {
+                return a->streamID > -1;
+            }
+            return a->audibility > b->audibility;
+        });
+
+    m_realVoiceCount = 0;
+    m_virtualVoiceCount = 0;
+
+    for (auto* voice : m_activeVoices)
+    {
+        if (voice->streamID == -1
+            && (m_realVoiceCount >= m_voiceBudget || voice->audibility < MinAudibility))
+        {
+            advanceVoice(*voice, BlockSize);
+            voice->isVirtual = true;
+            voice->gain = glm::vec2(0.f); //fades in again if it becomes audible
+            m_virtualVoiceCount++;
+            continue;
+        }
+
+        voice->isVirtual = false;
+        m_realVoiceCount++;
+
+        const auto rendered = renderVoice(*voice, BlockSize);
+        const auto channelCount = voice->streamID > -1 ? m_streams[voice->streamID].channelCount
+            : (voice->buffer ? voice->buffer->channelCount : 1);
+        std::fill(m_voiceBuffer.begin() + (rendered * channelCount), m_voiceBuffer.begin() + (BlockSize * channelCount), 0.f);
+
+        auto& bus = m_buses[voice->channel];
+        if (channelCount == 1)
+        {
+            Mixer::mixMono(bus.samples.data(), m_voiceBuffer.data(), BlockSize, voice->gain, voice->targetGain);
+        }
+        else
+        {
+            Mixer::mixStereo(bus.samples.data(), m_voiceBuffer.data(), BlockSize, voice->gain, voice->targetGain);
+        }
+        voice->gain = voice->targetGain;
+        bus.active = true;
+
+        //streams which are waiting for data keep playing
+        if (rendered < BlockSize
+            && (voice->streamID == -1 || isStreamEnded(m_streams[voice->streamID])))
+        {
+            stopVoice(*voice);
+        }
+    }
+
+    //bus effects
+    const float release = std::exp(-(static_cast<float>(BlockSize) / SampleRate) / DuckRelease);
+    for (auto i = 0u; i < m_buses.size(); ++i)
+    {
+        auto& bus = m_buses[i];
+        bus.lowPass.setCutoff(bus.properties.lowPassCutoff, static_cast<float>(SampleRate));
+
+        float level = 0.f;
+        if (bus.active)
+        {
+            bus.lowPass.process(bus.samples.data(), BlockSize);
+            level = Mixer::peak(bus.samples.data(), bus.samples.size());
+        }
+        else
+        {
+            bus.lowPass.reset();
+        }
+
+        //ducking keys use the pre-fade level so that,
+        //eg, voice chat ducks other channels at any volume
+        bus.envelope = std::max(level, bus.envelope * release);
+        m_busLevels[i] = level * bus.properties.gain;
+    }
+
+    std::fill(m_outputBuffer.begin(), m_outputBuffer.end(), 0.f);
+    for (auto i = 0u; i < m_buses.size(); ++i)
+    {
+        auto& bus = m_buses[i];
+
+        float gain = bus.properties.gain;
+        if (bus.properties.duckAmount > 0
+            && bus.properties.duckKey != i)
+        {
+            const float key = std::min(1.f, m_buses[bus.properties.duckKey].envelope / DuckThreshold);
+            gain *= 1.f - (bus.properties.duckAmount * key);
+        }
+
+        if (bus.active)
+        {
+            Mixer::mixStereo(m_outputBuffer.data(), bus.samples.data(), BlockSize, glm::vec2(bus.gain), glm::vec2(gain));
+        }
+        bus.gain = gain;
+    }
+
+    for (auto& s : m_outputBuffer)
+    {
+        s *= m_listenerVolume;
+    }
+    Mixer::clip(m_outputBuffer.data(), m_outputBuffer.size());
+
+    if (m_captureFile.file)
+    {
+        SDL_RWwrite(m_captureFile.file, m_outputBuffer.data(), BlockBytes, 1);
+        m_captureSize += BlockBytes;
+    }
+
+    m_mixTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void SoftwareMixerImpl::updateVoiceGain(Voice& voice)
+{
+    float gain = voice.volume;
+    glm::vec2 pan(1.f);
+
+    const bool mono = voice.streamID > -1
+        ? (m_streams[voice.streamID].channelCount == 1)
+        : (voice.buffer && voice.buffer->channelCount == 1);
+
+    //like OpenAL only mono sources are spatialised
+    if (mono)
+    {
+        //inverse distance clamped, as used by OpenAL
+        const auto direction = voice.worldPosition - m_listenerPosition;
+        const float distance = glm::length(direction);
+        gain *= RefDistance / (RefDistance + (voice.rolloff * (std::max(distance, RefDistance) - RefDistance)));
+
+        //equal power panning
+        const float side = distance > 0.001f ? glm::dot(direction / distance, m_listenerRight) : 0.f;
+        const float angle = (side + 1.f) * (Pi / 4.f);
+        pan = { std::cos(angle), std::sin(angle) };
+    }
+
+    voice.targetGain = pan * gain;
+    voice.audibility = gain * m_buses[voice.channel].properties.gain;
+}
+
+std::size_t SoftwareMixerImpl::renderVoice(Voice& voice, std::size_t frameCount)
+{
+    if (voice.streamID > -1)
+    {
+        //decoded by decodeStreams() before mixing. A pending seek
+        //means the ring still contains data from the old position
+        auto& stream = m_streams[voice.streamID];
+        if (!stream.data
+            || stream.seekPending)
+        {
+            return 0;
+        }
+
+        auto& src = *stream.data;
+        const auto availableFrames = src.getFrameCount();
+        if (availableFrames == 0)
+        {
+            return 0;
+        }
+
+        //streams loop in the decoder
+        const double step = static_cast<double>(voice.pitch) * src.sampleRate / SampleRate;
+        const auto channelCount = src.channelCount;
+
+        std::size_t i = 0;
+        for (; i < frameCount; ++i)
+        {
+            //keep one frame for interpolation unless the stream has ended
+            const auto index = static_cast<std::size_t>(voice.position);
+            if (index + 1 >= availableFrames
+                && !(src.ended && index < availableFrames))
+            {
+                break;
+            }
+
+            const float t = static_cast<float>(voice.position - index);
+            const auto next = std::min(index + 1, availableFrames - 1);
+
+            for (auto c = 0u; c < channelCount; ++c)
+            {
+                const float a = src.getSample(index, c);
+                const float b = src.getSample(next, c);
+                m_voiceBuffer[(i * channelCount) + c] = a + ((b - a) * t);
+            }
+            voice.position += step;
+        }
+
+        //drop the frames we've finished with
+        const auto consumed = std::min(static_cast<std::size_t>(voice.position), availableFrames);
+        src.readIndex = (src.readIndex + (consumed * channelCount)) % src.samples.size();
+        src.sampleCount -= consumed * channelCount;
+        voice.position -= consumed;
+
+        return i;
+    }
+
+    const SampleBuffer* src = voice.buffer.get();
+    if (!src || src->frameCount == 0)
+    {
+        return 0;
+    }
+
+    const double step = static_cast<double>(voice.pitch) * src->sampleRate / SampleRate;
+    const auto channelCount = src->channelCount;
+    const auto* data = src->samples.data();
+
+    //resample with linear interpolation
+    std::size_t i = 0;
+    for (; i < frameCount; ++i)
+    {
+        if (voice.position >= src->frameCount)
+        {
+            if (!voice.looped)
+            {
+                break;
+            }
+            voice.position = std::fmod(voice.position, static_cast<double>(src->frameCount));
+        }
+
+        const auto index = static_cast<std::size_t>(voice.position);
+        const float t = static_cast<float>(voice.position - index);
+        auto next = index + 1;
+        if (next == src->frameCount)
+        {
+            next = voice.looped ? 0 : index;
+        }
+
+        for (auto c = 0u; c < channelCount; ++c)
+        {
+            const float a = data[(index * channelCount) + c];
+            const float b = data[(next * channelCount) + c];
+            m_voiceBuffer[(i * channelCount) + c] = a + ((b - a) * t);
+        }
+        voice.position += step;
+    }
+
+    return i;
+}
+
+void SoftwareMixerImpl::advanceVoice(Voice& voice, std::size_t frameCount)
+{
+    //only buffers are virtualised
+    if (voice.buffer)
+    {
+        const double step = static_cast<double>(voice.pitch) * voice.buffer->sampleRate / SampleRate;
+        voice.position += step * frameCount;
+
+        if (voice.position >= voice.buffer->frameCount)
+        {
+            if (voice.looped)
+            {
+                voice.position = std::fmod(voice.position, static_cast<double>(voice.buffer->frameCount));
+            }
+            else
+            {
+                stopVoice(voice);
+            }
+        }
+    }
+}
+
+void SoftwareMixerImpl::stopVoice(Voice& voice)
+{
+    voice.state = 2;
+    voice.position = 0.0;
+    voice.gain = glm::vec2(0.f);
+
+    //rewind the stream, as OpenAL does. This is
+    //applied by the mixer thread before the next mix
+    if (voice.streamID > -1)
+    {
+        auto& stream = m_streams[voice.streamID];
+        if (stream.data)
+        {
+            stream.seekPending = true;
+            stream.seekOffset = cro::Time();
+        }
+    }
+}
+
+bool SoftwareMixerImpl::openWav(RaiiRWops& file, const std::string& path) const
+{
+    file.file = SDL_RWFromFile(path.c_str(), "wb");
+    if (!file.file)
+    {
+        LogE << "Software Mixer: Failed to open " << path << " for writing" << std::endl;
+        return false;
+    }
+
+    //the sizes are filled in when the file is closed
+    SDL_RWwrite(file.file, "RIFF", 4, 1);
+    writeValue<std::uint32_t>(file.file, 0);
+    SDL_RWwrite(file.file, "WAVEfmt ", 8, 1);
+    writeValue<std::uint32_t>(file.file, 16);
+    writeValue<std::uint16_t>(file.file, 3); //IEEE float
+    writeValue<std::uint16_t>(file.file, 2);
+    writeValue<std::uint32_t>(file.file, SampleRate);
+    writeValue<std::uint32_t>(file.file, SampleRate * 2 * sizeof(float));
+    writeValue<std::uint16_t>(file.file, 2 * sizeof(float));
+    writeValue<std::uint16_t>(file.file, 32);
+    SDL_RWwrite(file.file, "data", 4, 1);
+    writeValue<std::uint32_t>(file.file, 0);
+
+    return true;
+}
+
+void SoftwareMixerImpl::closeWav(RaiiRWops& file, std::uint32_t dataSize) const
+{
+    SDL_RWseek(file.file, 4, RW_SEEK_SET);
+    writeValue<std::uint32_t>(file.file, dataSize + 36);
+    SDL_RWseek(file.file, 40, RW_SEEK_SET);
+    writeValue<std::uint32_t>(file.file, dataSize);
+
+    file.close();
+}
@@ -0,0 +1,311 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include "AudioRenderer.hpp"
+#include "AudioFile.hpp"
+#include "MixerDSP.hpp"
+
+#include <crogine/audio/AudioMixer.hpp>
+#include <crogine/core/ConsoleClient.hpp>
+
+#include <SDL_audio.h>
+
+#ifdef AL_AUDIO
+#ifdef __APPLE__
+#include "al.h"
+#include "alc.h"
+#else
+#include <AL/al.h>
+#include <AL/alc.h>
+#endif
+#endif
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace cro
+{
+    namespace Detail
+    {
+        class BufferedStreamLoader;
+
+        /*!
+        \brief Mixes all audio sources in software, rather than relying on the
+        limits of the OpenAL backend.
+        Sources are resampled and mixed with SIMD kernels into one bus per
+        AudioMixer channel. Each bus may be low-pass filtered and ducked by
+        another bus, before being mixed to the output. When there are more
+        playing sources than the voice budget the least audible sources are
+        virtualised - their playback position is updated but they are not mixed.
+
+        Streams are decoded by the mixer thread into a ring buffer per stream
+        before each mix, without holding the lock used by the source setters,
+        so that the game thread never waits on the decoder.
+
+        Output is sent to the default SDL audio device. If no device is
+        available the mix continues on a null output in real time, and can
+        be captured to a wav file with beginCapture() or renderToFile(),
+        so that the mixer can be tested offline.
+
+        The sound_system classes (MusicPlayer, SoundStream and the VideoPlayer
+        audio) still use OpenAL directly, so when OpenAL is available a context
+        is kept current alongside the mixer for them. Without it they are silent.
+        */
+        class SoftwareMixerImpl final : public AudioRendererImpl, public cro::ConsoleClient
+        {
+        public:
+            static constexpr std::uint32_t SampleRate = 48000;
+            static constexpr std::uint32_t BlockSize = 512; //frames
+            static constexpr std::uint32_t DefaultVoiceBudget = 48;
+
+            SoftwareMixerImpl();
+
+            bool init() override;
+            void shutdown() override;
+
+            void setListenerPosition(glm::vec3) override;
+            void setListenerOrientation(glm::vec3, glm::vec3) override;
+            void setListenerVolume(float) override;
+            void setListenerVelocity(glm::vec3) override;
+
+            glm::vec3 getListenerPosition() const override;
+
+            std::int32_t requestNewBuffer(const std::string&) override;
+            std::int32_t requestNewBuffer(const PCMData&) override;
+            void deleteBuffer(std::int32_t) override;
+
+            std::int32_t requestNewStream(const std::string&) override;
+            std::int32_t requestNewBufferableStream(BufferedStreamLoader** dst, std::uint32_t channels, std::uint32_t sampleRate);
+            void deleteStream(std::int32_t) override;
+
+            std::int32_t requestAudioSource(std::int32_t, bool) override;
+            void updateAudioSource(std::int32_t, std::int32_t, bool) override;
+            void deleteAudioSource(std::int32_t) override;
+
+            void playSource(std::int32_t, bool) override;
+            void pauseSource(std::int32_t) override;
+            void stopSource(std::int32_t) override;
+
+            void setPlayingOffset(std::int32_t, cro::Time) override;
+            std::int32_t getSourceState(std::int32_t) const override;
+
+            void setSourcePosition(std::int32_t, glm::vec3) override;
+            void setSourcePitch(std::int32_t, float) override;
+            void setSourceVolume(std::int32_t, float) override;
+            void setSourceRolloff(std::int32_t, float) override;
+            void setSourceVelocity(std::int32_t, glm::vec3) override;
+            void setDopplerFactor(float) override {}
+            void setSpeedOfSound(float) override {}
+
+            void playbackDisconnectEvent() override;
+            void playbackConnectEvent() override;
+
+            bool mixesChannels() const override { return true; }
+            void setSourceChannel(std::int32_t, std::uint8_t) override;
+            void setMixerChannel(std::uint8_t, const MixerChannel&) override;
+            void setVoiceBudget(std::uint32_t) override;
+
+            void printDebug() override;
+
+            /*!
+            \brief Immediately mixes the given number of seconds of audio from
+            all playing sources and writes it to a 32 bit float wav file.
+            Sources are advanced as if the time had passed, so this is intended
+            for testing the mix offline, for example with the null output.
+            */
+            bool renderToFile(const std::string& path, float seconds);
+
+            /*!
+            \brief Starts writing all subsequent output to the given wav file
+            */
+            bool beginCapture(const std::string& path);
+
+            /*!
+            \brief Ends any active capture and finalises the wav file
+            */
+            void endCapture();
+
+            /*!
+            \brief Returns true if output is sent to an audio device, or
+            false if mixing to the null output.
+            */
+            bool hasDevice() const { return m_device != 0; }
+
+        private:
+            struct SampleBuffer final
+            {
+                std::vector<float> samples; //interleaved if stereo
+                std::uint32_t channelCount = 1;
+                std::uint32_t sampleRate = SampleRate;
+                std::size_t frameCount = 0;
+            };
+
+            //owned by the mixer thread. The file is only touched when decoding
+            //with m_decodeMutex held, and the ring is read when mixing with
+            //m_mutex held, which are only ever done concurrently by renderToFile()
+            //holding both locks.
+            struct StreamData final
+            {
+                std::unique_ptr<AudioFile> audioFile;
+                std::vector<float> samples; //ring buffer of decoded, interleaved samples
+                std::size_t readIndex = 0; //in samples
+                std::size_t sampleCount = 0; //samples waiting to be mixed
+                std::uint32_t channelCount = 1;
+                std::uint32_t sampleRate = SampleRate;
+                bool ended = false;
+
+                std::size_t getFrameCount() const { return sampleCount / channelCount; }
+                float getSample(std::size_t frame, std::uint32_t channel) const
+                {
+                    return samples[(readIndex + (frame * channelCount) + channel) % samples.size()];
+                }
+            };
+
+            struct Stream final
+            {
+                std::shared_ptr<StreamData> data;
+                std::uint32_t channelCount = 1;
+                bool used = false;
+
+                //seeking is deferred to the decoder
+                bool seekPending = false;
+                cro::Time seekOffset;
+            };
+
+            static bool isStreamEnded(const Stream& stream)
+            {
+                return !stream.data || (!stream.seekPending && stream.data->ended);
+            }
+
+            struct DecodeJob final
+            {
+                std::shared_ptr<StreamData> stream;
+                bool looped = false;
+                bool seek = false;
+                cro::Time offset;
+            };
+
+            struct Voice final
+            {
+                bool used = false;
+                std::shared_ptr<SampleBuffer> buffer;
+                std::int32_t streamID = -1;
+
+                double position = 0.0; //in source frames
+                std::int32_t state = 2; //0 playing, 1 paused, 2 stopped
+                bool looped = false;
+                bool isVirtual = false;
+
+                glm::vec3 worldPosition = glm::vec3(0.f);
+                float pitch = 1.f;
+                float volume = 1.f;
+                float rolloff = 1.f;
+                std::uint8_t channel = 0;
+
+                glm::vec2 gain = glm::vec2(0.f); //applied last block
+                glm::vec2 targetGain = glm::vec2(0.f);
+                float audibility = 0.f;
+            };
+
+            struct Bus final
+            {
+                std::vector<float> samples;
+                bool active = false;
+
+                MixerChannel properties;
+                Mixer::LowPass lowPass;
+                float envelope = 0.f; //used as a ducking key
+                float gain = 1.f; //applied last block, including ducking
+            };
+
+            mutable std::mutex m_mutex;
+            std::mutex m_decodeMutex; //always locked before m_mutex if both are held
+
+            std::unordered_map<std::int32_t, std::shared_ptr<SampleBuffer>> m_buffers;
+            std::int32_t m_nextBufferID;
+
+            static constexpr std::size_t MaxStreams = 128;
+            std::array<Stream, MaxStreams> m_streams = {};
+            std::vector<Voice> m_voices;
+            std::array<Bus, AudioMixer::MaxChannels> m_buses = {};
+            std::vector<Voice*> m_activeVoices;
+            std::vector<DecodeJob> m_decodeJobs;
+            std::vector<float> m_voiceBuffer;
+            std::vector<float> m_outputBuffer;
+
+            glm::vec3 m_listenerPosition;
+            glm::vec3 m_listenerRight;
+            float m_listenerVolume;
+            std::uint32_t m_voiceBudget;
+
+            SDL_AudioDeviceID m_device;
+#ifdef AL_AUDIO
+            ALCdevice* m_alDevice;
+            ALCcontext* m_alContext;
+#endif
+            std::thread m_mixThread;
+            std::atomic_bool m_running;
+
+            RaiiRWops m_captureFile;
+            std::uint32_t m_captureSize;
+
+            //debug info
+            std::size_t m_realVoiceCount;
+            std::size_t m_virtualVoiceCount;
+            float m_mixTime;
+            std::array<float, AudioMixer::MaxChannels> m_busLevels = {};
+
+            Voice* getVoice(std::int32_t);
+            std::shared_ptr<SampleBuffer> createBuffer(const PCMData&) const;
+            std::int32_t getFreeStream() const;
+            bool openDevice();
+            void createALContext();
+            void destroyALContext();
+
+            void mixThreadFunc();
+            void collectDecodeJobs(); //must be called with m_mutex locked
+            void decodeStreams(); //must be called with m_decodeMutex locked
+            void mixBlock(); //must be called with m_mutex locked
+            void updateVoiceGain(Voice&);
+            std::size_t renderVoice(Voice&, std::size_t frameCount);
+            void advanceVoice(Voice&, std::size_t frameCount);
+            void stopVoice(Voice&);
+
+            bool openWav(RaiiRWops&, const std::string&) const;
+            void closeWav(RaiiRWops&, std::uint32_t dataSize) const;
+        };
+    }
+}
@@ -0,0 +1,181 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include <crogine/core/AllocationCounter.hpp>
+
+#ifdef CRO_COUNT_ALLOCATIONS
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<std::uint64_t> globalCount = 0;
+    thread_local std::uint64_t threadCount = 0;
+
+    void* countedAlloc(std::size_t size) noexcept
+    {
+        globalCount.fetch_add(1, std::memory_order_relaxed);
+        threadCount++;
+
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* countedAlignedAlloc(std::size_t size, std::size_t alignment) noexcept
+    {
+        globalCount.fetch_add(1, std::memory_order_relaxed);
+        threadCount++;
+
+        size = size == 0 ? 1 : size;
+#ifdef _MSC_VER
+        return _aligned_malloc(size, alignment);
+#else
+        //aligned_alloc() requires the size to be a multiple of the alignment
+        size = ((size + alignment - 1) / alignment) * alignment;
+        return std::aligned_alloc(alignment, size);
+#endif
+    }
+
+    void alignedFree(void* ptr) noexcept
+    {
+#ifdef _MSC_VER
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    if (auto* ptr = countedAlloc(size); ptr)
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    if (auto* ptr = countedAlloc(size); ptr)
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAlloc(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    if (auto* ptr = countedAlignedAlloc(size, static_cast<std::size_t>(alignment)); ptr)
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    if (auto* ptr = countedAlignedAlloc(size, static_cast<std::size_t>(alignment)); ptr)
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return countedAlignedAlloc(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return countedAlignedAlloc(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { alignedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { alignedFree(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { alignedFree(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { alignedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { alignedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { alignedFree(ptr); }
+
+using namespace cro;
+
+bool AllocationCounter::isAvailable()
+{
+    return true;
+}
+
+std::uint64_t AllocationCounter::getCount()
+{
+    return globalCount.load(std::memory_order_relaxed);
+}
+
+std::uint64_t AllocationCounter::getThreadCount()
+{
+    return threadCount;
+}
+
+#else
+
+using namespace cro;
+
+bool AllocationCounter::isAvailable()
+{
+    return false;
+}
+
+std::uint64_t AllocationCounter::getCount()
+{
+    return 0;
+}
+
+std::uint64_t AllocationCounter::getThreadCount()
+{
+    return 0;
+}
+
+#endif
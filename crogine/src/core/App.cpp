@@ -59,6 +59,11 @@ static void winFPE(int)
 #include <crogine/core/ConfigFile.hpp>
 #include <crogine/core/SysTime.hpp>
 #include <crogine/core/HiResTimer.hpp>
+#include <crogine/core/Profiler.hpp>
+#include <crogine/core/JobSystem.hpp>
+#include <crogine/core/FrameAllocator.hpp>
+#include <crogine/graphics/GPUProfiler.hpp>
+#include <crogine/graphics/GPUReadback.hpp>
 #include <crogine/detail/Assert.hpp>
 #include <crogine/detail/PoolLog.hpp>
 #include <crogine/audio/AudioMixer.hpp>
@@ -92,6 +97,7 @@ static void winFPE(int)
 #include "../audio/AudioRenderer.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 
@@ -305,6 +311,8 @@ App::App(std::uint32_t styleFlags)
             Logger::log("Failed to initialise audio renderer", Logger::Type::Error);
         }
 
+        JobSystem::init();
+
 
 #ifdef WIN32
 #ifdef CRO_DEBUG_
@@ -341,6 +349,12 @@ App::~App()
         SDL_GameControllerClose(info.controller);
     }
     
+    //completes any outstanding jobs and stops the worker threads
+    JobSystem::finalise();
+
+    //writes any remaining messages and stops the log thread
+    Logger::finalise();
+
     //SDL cleanup
     SDL_Quit();
 }
@@ -487,6 +501,96 @@ void App::run(bool resetSettings)
                     m_window.setSize(newSize);
                 }
             }, nullptr);
+
+        Profiler::setThreadName("Main");
+        Console::addCommand("profiler",
+            [](const std::string& param)
+            {
+                if (param == "0")
+                {
+                    Profiler::setWindowVisible(false);
+                }
+                else
+                {
+                    Profiler::setWindowVisible(true);
+                }
+            }, nullptr);
+
+        Console::addCommand("profile_capture",
+            [](const std::string& param)
+            {
+                std::uint32_t frameCount = 0;
+                try
+                {
+                    frameCount = std::stoul(param);
+                }
+                catch (...) {}
+
+                if (frameCount == 0)
+                {
+                    Console::print("Usage: profile_capture <frame count>");
+                }
+                else if (Profiler::isCapturing())
+                {
+                    Console::print("Capture already in progress");
+                }
+                else
+                {
+                    Profiler::captureFrames(frameCount);
+                    Console::print("Capturing " + param + " frames to " + getPreferencePath() + "profiles/");
+                }
+            }, nullptr);
+
+        Console::addCommand("gpu_profiler",
+            [](const std::string& param)
+            {
+                if (!GPUProfiler::isAvailable())
+                {
+                    Console::print("GPU timing is not available on this platform");
+                }
+                else if (param == "0")
+                {
+                    GPUProfiler::setWindowVisible(false);
+                }
+                else
+                {
+                    GPUProfiler::setWindowVisible(true);
+                }
+            }, nullptr);
+
+        Console::addCommand("gpu_profile_log",
+            [](const std::string& param)
+            {
+                if (param == "0")
+                {
+                    if (GPUProfiler::isLogging())
+                    {
+                        GPUProfiler::endCSVLog();
+                        Console::print("Stopped GPU timing log");
+                    }
+                }
+                else if (!GPUProfiler::isLogging())
+                {
+                    auto path = getPreferencePath() + "profiles/";
+                    if (!FileSystem::directoryExists(path))
+                    {
+                        FileSystem::createDirectory(path);
+                    }
+                    auto fileName = "gpu_" + SysTime::dateString() + "_" + SysTime::timeString() + ".csv";
+                    std::replace(fileName.begin(), fileName.end(), '/', '-');
+                    std::replace(fileName.begin(), fileName.end(), ':', '-');
+                    path += fileName;
+
+                    if (GPUProfiler::beginCSVLog(path))
+                    {
+                        Console::print("Logging GPU timing to " + path);
+                    }
+                    else
+                    {
+                        Console::print("Failed opening " + path);
+                    }
+                }
+            }, nullptr);
     }
     else
     {
@@ -510,32 +614,55 @@ void App::run(bool resetSettings)
 
     while (m_running)
     {
-        timeSinceLastUpdate += frameClock.restart();
-
-        while (timeSinceLastUpdate > frameTime)
         {
-            timeSinceLastUpdate -= frameTime;
+            CRO_PROFILE_SCOPE("Frame");
+            timeSinceLastUpdate += frameClock.restart();
 
-            Console::newFrame();
+            while (timeSinceLastUpdate > frameTime)
+            {
+                CRO_PROFILE_SCOPE("App::simulate");
+                timeSinceLastUpdate -= frameTime;
 
-            handleEvents();
-            handleMessages();
+                Console::newFrame();
+                Logger::printToConsole();
 
-            simulate(frameTime);
+                handleEvents();
+                handleMessages();
 
-            framesRendered = 0;
-        }
+                simulate(frameTime);
 
-        if (framesRendered++ < MaxFrames)
-        {
-            doImGui();
+                framesRendered = 0;
+            }
+
+            if (framesRendered++ < MaxFrames)
+            {
+                {
+                    CRO_PROFILE_SCOPE("App::doImGui");
+                    doImGui();
+                    ImGui::Render();
+                }
+
+                {
+                    CRO_PROFILE_SCOPE("App::render");
+                    m_window.clear();
+                    {
+                        CRO_GPU_SCOPE("App::render");
+                        render();
+                    }
+                    {
+                        CRO_GPU_SCOPE("ImGui");
+                        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+                    }
+                }
 
-            ImGui::Render();
-            m_window.clear();
-            render();
-            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
-            m_window.display();
+                CRO_PROFILE_SCOPE("App::display");
+                m_window.display();
+                GPUProfiler::frameEnd();
+                GPUReadback::frameEnd();
+            }
         }
+        FrameAllocator::reset();
+        Profiler::collect();
     }
 
     saveSettings();
@@ -543,6 +670,8 @@ void App::run(bool resetSettings)
     Console::finalise();
     m_messageBus.disable(); //prevents spamming a load of quit messages
     finalise();
+    GPUReadback::finalise();
+    GPUProfiler::finalise();
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplSDL2_Shutdown();
     ImGui::DestroyContext();
@@ -604,104 +733,108 @@ bool App::isValid()
 
 void App::saveScreenshot()
 {
-    //wait for any previous operation
-    static std::future<void> writeResult;
-    if (writeResult.valid())
-    {
-        writeResult.wait();
-    }
-
     static constexpr std::uint32_t bpp = 3;
 
     //TODO this assumes we're calling this with the main buffer
     //active - if a texture buffer is currently active we should be
     //checking the size of that at the very least...
     auto size = m_window.getSize();
-    static std::vector<GLubyte> buffer;
-    buffer.resize(size.x * size.y * bpp);
-
-    glCheck(glPixelStorei(GL_PACK_ALIGNMENT, 1));
-    glCheck(glReadPixels(0, 0, size.x, size.y, GL_RGB, GL_UNSIGNED_BYTE, buffer.data()));
 
-    postMessage<Message::SystemEvent>(Message::SystemMessage)->type = Message::SystemEvent::ScreenshotTaken;
+    //the pixels are copied into a pack buffer and written once the
+    //GPU has caught up, rather than stalling until the frame is done
+    GPUReadback::readFramebuffer({ 0, 0, size.x, size.y }, GPUReadback::Format::RGB8,
+        [size](const std::byte* data, std::size_t dataSize)
+    {
+        //wait for any previous operation
+        static std::future<void> writeResult;
+        if (writeResult.valid())
+        {
+            writeResult.wait();
+        }
 
+        static std::vector<std::uint8_t> buffer;
+        buffer.resize(dataSize);
+        std::memcpy(buffer.data(), data, dataSize);
 
-    writeResult = std::async(std::launch::async, [size]()
-    {
-        //flip row order
-        stbi_flip_vertically_on_write(1);
+        writeResult = std::async(std::launch::async, [size]()
+        {
+            //flip row order
+            stbi_flip_vertically_on_write(1);
 
-        auto d = SysTime::now();
-        std::stringstream ss;
-        ss << std::setw(2) << std::setfill('0') << d.year() << "/"
-            << std::setw(2) << std::setfill('0') << d.months() << "/"
-            << d.days();
+            auto d = SysTime::now();
+            std::stringstream ss;
+            ss << std::setw(2) << std::setfill('0') << d.year() << "/"
+                << std::setw(2) << std::setfill('0') << d.months() << "/"
+                << d.days();
 
 
-        std::string filename = "screenshot_" + ss.str() + "_" + SysTime::timeString() + ".png";
-        std::replace(filename.begin(), filename.end(), '/', '_');
-        std::replace(filename.begin(), filename.end(), ':', '_');
+            std::string filename = "screenshot_" + ss.str() + "_" + SysTime::timeString() + ".png";
+            std::replace(filename.begin(), filename.end(), '/', '_');
+            std::replace(filename.begin(), filename.end(), ':', '_');
 
-        auto outPath = getPreferencePath() + "screenshots/";
-        std::replace(outPath.begin(), outPath.end(), '\\', '/');
+            auto outPath = getPreferencePath() + "screenshots/";
+            std::replace(outPath.begin(), outPath.end(), '\\', '/');
 
-        if (!FileSystem::directoryExists(outPath))
-        {
-            FileSystem::createDirectory(outPath);
-        }
+            if (!FileSystem::directoryExists(outPath))
+            {
+                FileSystem::createDirectory(outPath);
+            }
 
-        filename = outPath + filename;
+            filename = outPath + filename;
 
-        RaiiRWops out;
-        out.file = SDL_RWFromFile(filename.c_str(), "w");
-        if (out.file)
-        {
-            stbi_write_png_to_func(image_write_func, out.file, size.x, size.y, bpp, buffer.data(), size.x * bpp);
-            LogI << "Saved " << filename << std::endl;
+            RaiiRWops out;
+            out.file = SDL_RWFromFile(filename.c_str(), "w");
+            if (out.file)
+            {
+                stbi_write_png_to_func(image_write_func, out.file, size.x, size.y, bpp, buffer.data(), size.x * bpp);
+                LogI << "Saved " << filename << std::endl;
 
 #if defined CLIP_SCREENSHOT
-            //apparently we *must* have an alpha channel when writing to clipboard (plus we need flipping...)
-            //but hey we're in a separate thread here so we can afford the time it takes to do this.
-            std::vector<uint8_t> flipBuffer;
-            buffer.reserve(size.x * size.y * 4);
+                //apparently we *must* have an alpha channel when writing to clipboard (plus we need flipping...)
+                //but hey we're in a separate thread here so we can afford the time it takes to do this.
+                std::vector<uint8_t> flipBuffer;
+                buffer.reserve(size.x * size.y * 4);
 
-            auto y = static_cast<std::int32_t>(size.y - 1);
-            for (; y >= 0; --y)
-            {
-                for (auto x = 0u; x < size.x; ++x)
+                auto y = static_cast<std::int32_t>(size.y - 1);
+                for (; y >= 0; --y)
                 {
-                    auto index = (y * (size.x * bpp)) + (x * bpp);
-                    flipBuffer.push_back(buffer[index]);
-                    flipBuffer.push_back(buffer[index+1]);
-                    flipBuffer.push_back(buffer[index+2]);
-                    flipBuffer.push_back(0xff);
+                    for (auto x = 0u; x < size.x; ++x)
+                    {
+                        auto index = (y * (size.x * bpp)) + (x * bpp);
+                        flipBuffer.push_back(buffer[index]);
+                        flipBuffer.push_back(buffer[index+1]);
+                        flipBuffer.push_back(buffer[index+2]);
+                        flipBuffer.push_back(0xff);
+                    }
                 }
-            }
 
-            clip::image_spec spec;
-            spec.width = size.x;
-            spec.height = size.y;
-            spec.bits_per_pixel = 8 * 4;
-            spec.bytes_per_row = spec.width * 4;
-            spec.red_mask = 0xff;
-            spec.green_mask = 0xff00;
-            spec.blue_mask = 0xff0000;
-            spec.alpha_mask = 0xff000000;
-            spec.red_shift = 0;
-            spec.green_shift = 8;
-            spec.blue_shift = 16;
-            spec.alpha_shift = 24;
-            clip::image img(flipBuffer.data(), spec);
-            clip::set_image(img);
-
-            LogI << "Copied screenshot to clipboard" << std::endl;
+                clip::image_spec spec;
+                spec.width = size.x;
+                spec.height = size.y;
+                spec.bits_per_pixel = 8 * 4;
+                spec.bytes_per_row = spec.width * 4;
+                spec.red_mask = 0xff;
+                spec.green_mask = 0xff00;
+                spec.blue_mask = 0xff0000;
+                spec.alpha_mask = 0xff000000;
+                spec.red_shift = 0;
+                spec.green_shift = 8;
+                spec.blue_shift = 16;
+                spec.alpha_shift = 24;
+                clip::image img(flipBuffer.data(), spec);
+                clip::set_image(img);
+
+                LogI << "Copied screenshot to clipboard" << std::endl;
 #endif
-        }
-        else
-        {
-            LogE << "SDL: Writing screenshot failed - " << SDL_GetError() << std::endl;
-        }
+            }
+            else
+            {
+                LogE << "SDL: Writing screenshot failed - " << SDL_GetError() << std::endl;
+            }
+        });
     });
+
+    postMessage<Message::SystemEvent>(Message::SystemMessage)->type = Message::SystemEvent::ScreenshotTaken;
 }
 
 //protected
@@ -1010,6 +1143,8 @@ void App::doImGui()
 
     //show other windows (console etc)
     Console::draw();
+    Profiler::drawWindow();
+    GPUProfiler::drawWindow();
     
     for (const auto& f : m_guiWindows)
     {
@@ -1184,6 +1319,11 @@ App::WindowSettings App::loadSettings() const
 
 void App::saveSettings()
 {
+    if (!m_saveSettings)
+    {
+        return;
+    }
+
     auto size = m_window.getSize();
 
     ConfigFile saveSettings;
@@ -0,0 +1,140 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include <crogine/core/FrameAllocator.hpp>
+#include <crogine/core/Log.hpp>
+#include <crogine/detail/Assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+using namespace cro;
+
+namespace
+{
+    constexpr std::size_t DefaultCapacity = 1024 * 1024;
+
+    struct Arena final
+    {
+        std::unique_ptr<std::byte[]> block;
+        std::size_t capacity = 0;
+        std::size_t requestedCapacity = DefaultCapacity;
+        std::atomic<std::size_t> offset = 0;
+
+        //allocations which didn't fit in the block this frame
+        std::mutex overflowMutex;
+        std::vector<std::unique_ptr<std::byte[]>> overflow;
+        std::size_t overflowBytes = 0;
+
+        FrameAllocator::Stats stats;
+
+        Arena()
+        {
+            resize(DefaultCapacity);
+        }
+
+        void resize(std::size_t size)
+        {
+            block = std::make_unique<std::byte[]>(size);
+            capacity = size;
+            stats.capacity = size;
+        }
+    }arena;
+}
+
+void* FrameAllocator::allocate(std::size_t size, std::size_t alignment)
+{
+    CRO_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+    const auto base = reinterpret_cast<std::uintptr_t>(arena.block.get());
+    auto current = arena.offset.load(std::memory_order_relaxed);
+    while (true)
+    {
+        const auto start = ((base + current + (alignment - 1)) & ~(alignment - 1)) - base;
+        const auto end = start + size;
+        if (end > arena.capacity)
+        {
+            break;
+        }
+
+        if (arena.offset.compare_exchange_weak(current, end, std::memory_order_relaxed))
+        {
+            return arena.block.get() + start;
+        }
+    }
+
+    //we ran out of space so fall back to the heap until the next reset
+    const auto paddedSize = size + alignment;
+
+    std::scoped_lock lock(arena.overflowMutex);
+    auto& mem = arena.overflow.emplace_back(std::make_unique<std::byte[]>(paddedSize));
+    arena.overflowBytes += paddedSize;
+
+    void* ptr = mem.get();
+    auto space = paddedSize;
+    return std::align(alignment, size, ptr, space);
+}
+
+void FrameAllocator::reset()
+{
+    const auto used = std::min(arena.offset.load(), arena.capacity) + arena.overflowBytes;
+    arena.stats.used = used;
+    arena.stats.peak = std::max(arena.stats.peak, used);
+
+    if (!arena.overflow.empty())
+    {
+        //make room for what we needed this frame, with some spare
+        arena.requestedCapacity = std::max(arena.requestedCapacity, used + (used / 2));
+        arena.stats.overflowCount++;
+
+        arena.overflow.clear();
+        arena.overflowBytes = 0;
+
+        LogI << "Frame allocator grew to " << arena.requestedCapacity / 1024 << "KB" << std::endl;
+    }
+
+    if (arena.requestedCapacity != arena.capacity)
+    {
+        arena.resize(arena.requestedCapacity);
+    }
+    arena.offset = 0;
+}
+
+void FrameAllocator::reserve(std::size_t bytes)
+{
+    arena.requestedCapacity = std::max(bytes, std::size_t(1));
+}
+
+FrameAllocator::Stats FrameAllocator::getStats()
+{
+    return arena.stats;
+}
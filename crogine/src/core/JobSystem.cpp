@@ -0,0 +1,347 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include <crogine/core/JobSystem.hpp>
+#include <crogine/core/Log.hpp>
+#include <crogine/core/Profiler.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <string>
+#include <thread>
+
+using namespace cro;
+
+namespace
+{
+    struct WorkQueue final
+    {
+        std::mutex mutex;
+        std::deque<JobSystem::Job> jobs;
+    };
+
+    //one queue per worker, plus a final queue shared
+    //by any threads which aren't workers
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> threads;
+    std::size_t workerCount = 0;
+
+    std::atomic_bool running = false;
+    std::atomic<std::size_t> queuedJobs = 0;
+
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+
+    //index of the queue owned by the current thread
+    thread_local std::size_t workerIndex = std::numeric_limits<std::size_t>::max();
+
+    struct Batch final
+    {
+        const std::function<void(std::size_t)>* job = nullptr;
+        std::size_t count = 0;
+        std::size_t grainSize = 1;
+        std::atomic<std::size_t> next = 0;
+        std::atomic<std::size_t> remaining = 0;
+    };
+
+    void push(JobSystem::Job&& job)
+    {
+        auto& queue = workerIndex < workerCount ? *queues[workerIndex] : *queues.back();
+        {
+            std::scoped_lock lock(queue.mutex);
+            queue.jobs.push_back(std::move(job));
+        }
+        queuedJobs++;
+
+        //lock so the notification can't be missed between
+        //a worker checking for jobs and going to sleep
+        {
+            std::scoped_lock lock(sleepMutex);
+        }
+        sleepCondition.notify_one();
+    }
+
+    bool pop(JobSystem::Job& dst)
+    {
+        //newest job from our own queue is most likely to still be in the cache
+        if (workerIndex < workerCount)
+        {
+            auto& queue = *queues[workerIndex];
+            std::scoped_lock lock(queue.mutex);
+            if (!queue.jobs.empty())
+            {
+                dst = std::move(queue.jobs.back());
+                queue.jobs.pop_back();
+                queuedJobs--;
+                return true;
+            }
+        }
+
+        //else steal the oldest job from anyone else, starting
+        //with the shared queue and then our neighbours
+        const auto queueCount = queues.size();
+        const auto start = workerIndex < workerCount ? workerIndex + 1 : 0;
+        for (auto i = 0u; i < queueCount; ++i)
+        {
+            const auto index = (queueCount - 1 + start + i) % queueCount;
+            if (index == workerIndex)
+            {
+                continue;
+            }
+
+            auto& queue = *queues[index];
+            std::scoped_lock lock(queue.mutex);
+            if (!queue.jobs.empty())
+            {
+                dst = std::move(queue.jobs.front());
+                queue.jobs.pop_front();
+                queuedJobs--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void threadFunc(std::size_t index)
+    {
+        workerIndex = index;
+        Profiler::setThreadName("Worker " + std::to_string(index));
+
+        JobSystem::Job job;
+        while (running)
+        {
+            if (pop(job))
+            {
+                job();
+                job = nullptr;
+            }
+            else
+            {
+                std::unique_lock lock(sleepMutex);
+                sleepCondition.wait(lock, []() { return !running || queuedJobs != 0; });
+            }
+        }
+    }
+
+    void runBatch(Batch& batch)
+    {
+        auto start = batch.next.fetch_add(batch.grainSize);
+        while (start < batch.count)
+        {
+            const auto end = std::min(start + batch.grainSize, batch.count);
+            for (auto i = start; i < end; ++i)
+            {
+                (*batch.job)(i);
+            }
+            batch.remaining -= (end - start);
+
+            start = batch.next.fetch_add(batch.grainSize);
+        }
+    }
+
+    void signal(std::atomic<std::int32_t>& count, std::mutex& mutex, std::vector<JobSystem::Job>& dependents)
+    {
+        std::vector<JobSystem::Job> ready;
+        {
+            //hold the lock while decrementing so a waiting thread
+            //can't destroy the counter while we're still using it
+            std::scoped_lock lock(mutex);
+            if (--count == 0)
+            {
+                ready.swap(dependents);
+            }
+        }
+
+        for (auto& job : ready)
+        {
+            JobSystem::run(std::move(job));
+        }
+    }
+}
+
+void JobSystem::init(std::size_t threadCount)
+{
+    if (running)
+    {
+        LogW << "Job system is already running" << std::endl;
+        return;
+    }
+
+    if (threadCount == 0)
+    {
+        //leave a thread for the main thread
+        const std::size_t hwThreads = std::thread::hardware_concurrency();
+        threadCount = std::max(hwThreads, std::size_t(2)) - 1;
+    }
+
+    queues.clear();
+    for (auto i = 0u; i < threadCount + 1; ++i)
+    {
+        queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    workerCount = threadCount;
+    running = true;
+    for (auto i = 0u; i < threadCount; ++i)
+    {
+        threads.emplace_back(threadFunc, i);
+    }
+
+    LogI << "Started job system with " << threadCount << " worker threads" << std::endl;
+}
+
+void JobSystem::finalise()
+{
+    if (!running)
+    {
+        return;
+    }
+
+    {
+        std::scoped_lock lock(sleepMutex);
+        running = false;
+    }
+    sleepCondition.notify_all();
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    threads.clear();
+    workerCount = 0;
+
+    //anything still waiting on a counter expects these to complete
+    JobSystem::Job job;
+    while (pop(job))
+    {
+        job();
+    }
+    queues.clear();
+}
+
+std::size_t JobSystem::getWorkerCount()
+{
+    return workerCount;
+}
+
+void JobSystem::run(Job job, Counter* counter, Counter* dependency)
+{
+    if (counter)
+    {
+        counter->m_count++;
+
+        job = [job = std::move(job), counter]() mutable
+            {
+                job();
+                signal(counter->m_count, counter->m_mutex, counter->m_dependents);
+            };
+    }
+
+    if (dependency)
+    {
+        std::scoped_lock lock(dependency->m_mutex);
+        if (dependency->m_count != 0)
+        {
+            dependency->m_dependents.push_back(std::move(job));
+            return;
+        }
+    }
+
+    if (!running)
+    {
+        job();
+        return;
+    }
+    push(std::move(job));
+}
+
+void JobSystem::wait(Counter& counter)
+{
+    JobSystem::Job job;
+    while (!counter.isComplete())
+    {
+        if (running && pop(job))
+        {
+            job();
+            job = nullptr;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    //make sure whoever completed the counter has finished with it
+    std::scoped_lock lock(counter.m_mutex);
+}
+
+void JobSystem::parallelFor(std::size_t count, const std::function<void(std::size_t)>& job, std::size_t grainSize)
+{
+    if (grainSize == 0)
+    {
+        //a few batches per thread balances uneven workloads
+        grainSize = std::max(std::size_t(1), count / ((workerCount + 1) * 4));
+    }
+
+    if (!running
+        || workerCount == 0
+        || count <= grainSize)
+    {
+        for (auto i = 0u; i < count; ++i)
+        {
+            job(i);
+        }
+        return;
+    }
+
+    auto batch = std::make_shared<Batch>();
+    batch->job = &job;
+    batch->count = count;
+    batch->grainSize = grainSize;
+    batch->remaining = count;
+
+    //the batch is shared in case a helper starts after we return,
+    //in which case it finds no work left and never touches the job
+    const auto helperCount = std::min(workerCount, ((count + grainSize - 1) / grainSize) - 1);
+    for (auto i = 0u; i < helperCount; ++i)
+    {
+        push([batch]() { runBatch(*batch); });
+    }
+
+    runBatch(*batch);
+
+    //only wait on the batches already claimed rather than picking
+    //up other work, which could be a long running job and stall us
+    while (batch->remaining != 0)
+    {
+        std::this_thread::yield();
+    }
+}
@@ -30,131 +30,521 @@ source distribution.
 #include <crogine/core/Log.hpp>
 #include <crogine/core/App.hpp>
 #include <crogine/core/Console.hpp>
+#include <crogine/core/Profiler.hpp>
 #include <crogine/core/String.hpp>
 #include <crogine/core/SysTime.hpp>
 #include <crogine/detail/Types.hpp>
 
 #include <SDL_log.h>
 
-#include <sstream>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 using namespace cro;
 
-std::list<std::string> Logger::m_buffer;
-std::string Logger::m_output;
-
-void Logger::log(const std::string& message, Type type, Output output)
+namespace
 {
-    std::string outstring;
-    switch (type)
+    constexpr std::size_t QueueSize = 1024; //must be a power of 2
+    constexpr std::size_t MaxConsoleLines = 256;
+    constexpr std::int64_t MaxFileSize = 2 * 1024 * 1024;
+    constexpr std::int32_t MaxLogFiles = 3; //number of rotated files kept in addition to output.log
+    constexpr auto WriteInterval = std::chrono::milliseconds(20);
+
+    struct Record final
     {
-    case Type::Info:
-    default:
-        outstring = "INFO: " + message;
-        break;
-    case Type::Error:
-        outstring = "ERROR: " + message;
-        output = Output::All;
-        break;
-    case Type::Warning:
-        outstring = "WARNING: " + message;
-        break;
-    }
-#ifndef __ANDROID__
-    if (output == Output::Console || output == Output::All)
+        std::string message;
+        std::uint64_t timestamp = 0;
+        Logger::Type type = Logger::Type::Info;
+        Logger::Output output = Logger::Output::Console;
+    };
+
+    //bounded multiple producer queue where each slot carries a
+    //sequence number, so producers only contend on the head index.
+    //Must only be popped from one thread at a time.
+    class RecordQueue final
     {
-        switch (type)
+    public:
+        RecordQueue()
         {
-        default:
-        case Type::Info:
-            SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%s", message.c_str());
-            break;
-        case Type::Warning:
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "%s", message.c_str());
-            break;
-        case Type::Error:
-            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s", message.c_str());
-            break;
+            for (auto i = 0u; i < m_slots.size(); ++i)
+            {
+                m_slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
         }
 
-        Console::print(outstring);
+        bool push(Record&& record)
+        {
+            auto pos = m_head.load(std::memory_order_relaxed);
+            Slot* slot = nullptr;
+            for (;;)
+            {
+                slot = &m_slots[pos & (QueueSize - 1)];
+                auto seq = slot->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    //full
+                    return false;
+                }
+                else
+                {
+                    pos = m_head.load(std::memory_order_relaxed);
+                }
+            }
+
+            slot->record = std::move(record);
+            slot->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
 
-        const std::size_t maxBuffer = 30;
-        m_buffer.push_back(outstring);
-        if (m_buffer.size() > maxBuffer) m_buffer.pop_front();
-        updateOutString(maxBuffer);
+        bool pop(Record& dst)
+        {
+            auto& slot = m_slots[m_tail & (QueueSize - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != m_tail + 1)
+            {
+                return false;
+            }
+
+            dst = std::move(slot.record);
+            slot.sequence.store(m_tail + QueueSize, std::memory_order_release);
+            m_tail++;
+            return true;
+        }
 
-#ifdef _MSC_VER
-        outstring += "\n";
-        OutputDebugStringA(outstring.c_str());
-#endif //_MSC_VER
-    }
-    if (output == Output::File || output == Output::All)
+    private:
+        struct Slot final
+        {
+            std::atomic<std::size_t> sequence = 0;
+            Record record;
+        };
+        std::array<Slot, QueueSize> m_slots = {};
+
+        alignas(64) std::atomic<std::size_t> m_head = 0;
+        alignas(64) std::size_t m_tail = 0;
+    };
+
+    class LogWriter final
     {
-        //output to a log file
-        RaiiRWops file;
-        auto logPath = cro::App::getPreferencePath() + "output.log";
-        file.file = SDL_RWFromFile(logPath.c_str(), "a");
-        if (file.file)
+    public:
+        ~LogWriter()
         {
-            auto timeStamp = SysTime::timeString();
-            timeStamp += " - ";
-            timeStamp += SysTime::dateString();
-            timeStamp += ": ";
+            stop();
+        }
 
-            SDL_RWwrite(file.file, timeStamp.c_str(), 1, timeStamp.size());
-            SDL_RWwrite(file.file, outstring.c_str(), 1, outstring.size());
+        void submit(Record&& record)
+        {
+            auto state = m_state.load(std::memory_order_acquire);
+            if (state == State::Idle)
+            {
+                start();
+                state = m_state.load(std::memory_order_acquire);
+            }
+
+            if (state == State::Finalised)
+            {
+                std::scoped_lock lock(m_syncMutex);
+                write(record);
+                closeIfError(record.type);
+                return;
+            }
+
+            const bool isError = record.type == Logger::Type::Error;
+            while (!m_queue.push(std::move(record)))
+            {
+                if (!isError)
+                {
+                    m_dropped.fetch_add(1, std::memory_order_relaxed);
+                    wake();
+                    return;
+                }
+
+                //errors wait for the writer to make room
+                wake();
+                std::this_thread::yield();
+
+                if (m_state.load(std::memory_order_acquire) != State::Running)
+                {
+                    std::scoped_lock lock(m_syncMutex);
+                    write(record);
+                    return;
+                }
+            }
+            m_pushed.fetch_add(1, std::memory_order_release);
+
+            if (isError)
+            {
+                wake();
+            }
         }
-        else
+
+        void flush()
         {
-            log(message, type, Output::Console);
-            log("Above message was intended for log file. Opening file probably failed.", Type::Warning, Output::Console);
+            if (m_state.load(std::memory_order_acquire) != State::Running)
+            {
+                return;
+            }
+
+            const auto target = m_pushed.load(std::memory_order_acquire);
+            wake();
+
+            std::unique_lock lock(m_mutex);
+            m_flushCondition.wait(lock, [&]()
+                {
+                    return m_written >= target || !m_running;
+                });
         }
-    }
+
+        void stop()
+        {
+            std::scoped_lock startLock(m_startMutex);
+            if (m_state == State::Running)
+            {
+                {
+                    std::scoped_lock lock(m_mutex);
+                    m_running = false;
+                }
+                m_condition.notify_one();
+
+                if (m_thread.joinable())
+                {
+                    m_thread.join();
+                }
+            }
+            m_state = State::Finalised;
+
+            //anything pushed while the thread was stopping
+            std::scoped_lock lock(m_syncMutex);
+            drain();
+            m_file.close();
+        }
+
+        void printToConsole()
+        {
+            {
+                std::scoped_lock lock(m_consoleMutex);
+                if (m_consoleLines.empty())
+                {
+                    return;
+                }
+                m_consoleLines.swap(m_consoleOutput);
+            }
+
+            for (const auto& line : m_consoleOutput)
+            {
+                Console::print(line);
+            }
+            m_consoleOutput.clear();
+        }
+
+    private:
+        enum class State
+        {
+            Idle, Running, Finalised
+        };
+        std::atomic<State> m_state = State::Idle;
+        std::mutex m_startMutex;
+
+        RecordQueue m_queue;
+        std::atomic<std::uint32_t> m_dropped = 0;
+        std::atomic<std::uint64_t> m_pushed = 0;
+
+        std::thread m_thread;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::condition_variable m_flushCondition;
+        std::atomic_bool m_wake = false;
+        bool m_running = false; //guarded by m_mutex
+        std::uint64_t m_written = 0; //guarded by m_mutex
+
+        std::mutex m_syncMutex; //used when writing from outside the writer thread
+
+        std::mutex m_consoleMutex;
+        std::vector<std::string> m_consoleLines;
+        std::vector<std::string> m_consoleOutput; //main thread only
+
+        RaiiRWops m_file;
+        std::int64_t m_fileSize = 0;
+
+        void start()
+        {
+            std::scoped_lock lock(m_startMutex);
+            if (m_state == State::Idle)
+            {
+                m_running = true;
+                m_thread = std::thread(&LogWriter::threadFunc, this);
+                m_state = State::Running;
+            }
+        }
+
+        void wake()
+        {
+            if (!m_wake.exchange(true, std::memory_order_acq_rel))
+            {
+                m_condition.notify_one();
+            }
+        }
+
+        void threadFunc()
+        {
+            Profiler::setThreadName("Logger");
+
+            bool running = true;
+            while (running)
+            {
+                {
+                    std::unique_lock lock(m_mutex);
+                    m_condition.wait_for(lock, WriteInterval, [&]()
+                        {
+                            return m_wake.load(std::memory_order_acquire) || !m_running;
+                        });
+                    running = m_running;
+                }
+                m_wake.store(false, std::memory_order_release);
+
+                auto count = drain();
+
+                {
+                    std::scoped_lock lock(m_mutex);
+                    m_written += count;
+                }
+                m_flushCondition.notify_all();
+            }
+        }
+
+        //returns the number of records written
+        std::uint64_t drain()
+        {
+            std::uint64_t count = 0;
+            bool hadError = false;
+
+            Record record;
+            while (m_queue.pop(record))
+            {
+                write(record);
+                hadError = hadError || record.type == Logger::Type::Error;
+                count++;
+            }
+
+            auto dropped = m_dropped.exchange(0, std::memory_order_relaxed);
+            if (dropped)
+            {
+                Record warning;
+                warning.message = std::to_string(dropped) + " log messages were dropped because the queue was full";
+                warning.timestamp = SysTime::epoch();
+                warning.type = Logger::Type::Warning;
+                warning.output = Logger::Output::All;
+                write(warning);
+            }
+
+            //SDL has no way to flush a file so close it to make
+            //sure errors are on disk should we subsequently crash
+            closeIfError(hadError ? Logger::Type::Error : Logger::Type::Info);
+
+            return count;
+        }
+
+        void closeIfError(Logger::Type type)
+        {
+            if (type == Logger::Type::Error)
+            {
+                m_file.close();
+            }
+        }
+
+        void write(const Record& record)
+        {
+            std::string outstring;
+            switch (record.type)
+            {
+            case Logger::Type::Info:
+            default:
+                outstring = "INFO: " + record.message;
+                break;
+            case Logger::Type::Error:
+                outstring = "ERROR: " + record.message;
+                break;
+            case Logger::Type::Warning:
+                outstring = "WARNING: " + record.message;
+                break;
+            }
+
+#ifndef __ANDROID__
+            if (record.output == Logger::Output::Console || record.output == Logger::Output::All)
+            {
+                switch (record.type)
+                {
+                default:
+                case Logger::Type::Info:
+                    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%s", record.message.c_str());
+                    break;
+                case Logger::Type::Warning:
+                    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "%s", record.message.c_str());
+                    break;
+                case Logger::Type::Error:
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s", record.message.c_str());
+                    break;
+                }
+
+                {
+                    std::scoped_lock lock(m_consoleMutex);
+                    m_consoleLines.push_back(outstring);
+                    if (m_consoleLines.size() > MaxConsoleLines)
+                    {
+                        m_consoleLines.erase(m_consoleLines.begin());
+                    }
+                }
+
+#ifdef _MSC_VER
+                OutputDebugStringA((outstring + "\n").c_str());
+#endif //_MSC_VER
+            }
+
+            if (record.output == Logger::Output::File || record.output == Logger::Output::All)
+            {
+                if (!writeFile(record.timestamp, outstring)
+                    && record.output == Logger::Output::File)
+                {
+                    Record fallback = record;
+                    fallback.output = Logger::Output::Console;
+                    write(fallback);
+
+                    fallback.message = "Above message was intended for log file. Opening file probably failed.";
+                    fallback.type = Logger::Type::Warning;
+                    write(fallback);
+                }
+            }
 #else
-    //use logcat - technically SDL will log successfully on android too
-    //so this is unnecessary.
-    __android_log_print(ANDROID_LOG_VERBOSE, "CroApp", message.c_str(), 1);
+            //use logcat - technically SDL will log successfully on android too
+            //so this is unnecessary.
+            __android_log_print(ANDROID_LOG_VERBOSE, "CroApp", record.message.c_str(), 1);
 #endif //__ANDROID__
+        }
+
+        bool writeFile(std::uint64_t timestamp, const std::string& outstring)
+        {
+            if (!m_file.file
+                && !openFile())
+            {
+                return false;
+            }
+
+            auto line = SysTime::timeString(timestamp);
+            line += " - ";
+            line += SysTime::dateString(timestamp);
+            line += ": ";
+            line += outstring;
+            if (line.back() != '\n')
+            {
+                line += '\n';
+            }
+
+            SDL_RWwrite(m_file.file, line.c_str(), 1, line.size());
+            m_fileSize += line.size();
+
+            if (m_fileSize > MaxFileSize)
+            {
+                m_file.close();
+                rotateFiles();
+            }
+            return true;
+        }
+
+        bool openFile()
+        {
+            const auto logPath = App::getPreferencePath() + "output.log";
+            m_file.file = SDL_RWFromFile(logPath.c_str(), "a");
+            if (m_file.file)
+            {
+                m_fileSize = SDL_RWsize(m_file.file);
+                if (m_fileSize > MaxFileSize)
+                {
+                    m_file.close();
+                    rotateFiles();
+                    m_file.file = SDL_RWFromFile(logPath.c_str(), "a");
+                    m_fileSize = 0;
+                }
+            }
+            return m_file.file != nullptr;
+        }
+
+        //output.log becomes output.1.log, output.1.log becomes output.2.log etc
+        void rotateFiles()
+        {
+            const auto basePath = App::getPreferencePath() + "output";
+            const auto fileName = [&basePath](std::int32_t i)
+            {
+                return i == 0 ? basePath + ".log" : basePath + "." + std::to_string(i) + ".log";
+            };
+
+            std::remove(fileName(MaxLogFiles).c_str());
+            for (auto i = MaxLogFiles - 1; i >= 0; --i)
+            {
+                std::rename(fileName(i).c_str(), fileName(i + 1).c_str());
+            }
+        }
+    };
+
+    LogWriter& getWriter()
+    {
+        static LogWriter writer;
+        return writer;
+    }
+}
+
+void Logger::log(const std::string& message, Type type, Output output)
+{
+    Record record;
+    record.message = message;
+    record.timestamp = SysTime::epoch();
+    record.type = type;
+    record.output = type == Type::Error ? Output::All : output;
+
+    getWriter().submit(std::move(record));
 }
 
 std::ostream& Logger::log(Logger::Type type)
 {
-    static cro::Detail::LogStream stream;
-    switch (type)
-    {
-    default:
-    case Type::Info:
-        stream << "INFO: ";
-        break;
-    case Type::Warning:
-        stream << "WARNING: ";
-        break;
-    case Type::Error:
-        stream << "ERROR: ";
-        break;
-    }
+    //each thread has its own stream so lines from
+    //different threads are never interleaved
+    thread_local cro::Detail::LogStream stream;
+    stream.setType(type);
     return stream;
 }
 
+void Logger::flush()
+{
+    getWriter().flush();
+}
+
 //private
-void Logger::updateOutString(std::size_t maxBuffer)
+void Logger::printToConsole()
 {
-    static size_t count = 0;
-    m_output.append(m_buffer.back());
-    m_output.append("\n");
-    count++;
+    getWriter().printToConsole();
+}
 
-    if (count > maxBuffer)
-    {
-        m_output = m_output.substr(m_output.find_first_of('\n') + 1, m_output.size());
-        count--;
-    }
+void Logger::finalise()
+{
+    getWriter().stop();
 }
 
 using namespace Detail;
 //log buffer class
 LogBuf::LogBuf()
+    : m_type(Logger::Type::Info)
 {
     static const std::size_t BuffSize = 128;
     char* buffer = new char[BuffSize];
@@ -164,9 +554,23 @@ LogBuf::LogBuf()
 LogBuf::~LogBuf()
 {
     sync();
+    if (!m_line.empty())
+    {
+        submitLine();
+    }
     delete[] pbase();
 }
 
+void LogBuf::setType(Logger::Type type)
+{
+    sync();
+    if (!m_line.empty())
+    {
+        submitLine();
+    }
+    m_type = type;
+}
+
 //private
 int LogBuf::overflow(int character)
 {
@@ -191,36 +595,37 @@ int LogBuf::sync()
 {
     if (pbase() != pptr())
     {
-        //print the contents of the write buffer into the logger
-        std::size_t size = static_cast<int>(pptr() - pbase());
-
-        std::stringstream ss; //TODO this should be a member to buffer truncated messages between flushes
-        ss.write(pbase(), size);
+        m_line.append(pbase(), pptr() - pbase());
+        setp(pbase(), epptr());
 
-        std::string outline;
-        while (std::getline(ss, outline))
+        //submit complete lines, any remainder is kept until the next flush
+        auto pos = m_line.find('\n');
+        while (pos != std::string::npos)
         {
-            outline += '\n';
-            Console::print(outline);
-            std::fwrite(outline.data(), 1, outline.size(), stdout);
+            auto remainder = m_line.substr(pos + 1);
+            m_line.resize(pos);
+            submitLine();
+            m_line = std::move(remainder);
 
-#ifdef __ANDROID__
-            //use logcat
-            __android_log_print(ANDROID_LOG_VERBOSE, "CroApp", outline.c_str(), 1);
-#endif //__ANDROID__
-
-#ifdef _MSC_VER
-            outline += "\n";
-            OutputDebugStringA(outline.c_str());
-#endif //_MSC_VER
+            pos = m_line.find('\n');
         }
-
-        setp(pbase(), epptr());
     }
 
     return 0;
 }
 
+void LogBuf::submitLine()
+{
+    Record record;
+    record.message = std::move(m_line);
+    record.timestamp = SysTime::epoch();
+    record.type = m_type;
+    record.output = Logger::Output::Console;
+
+    getWriter().submit(std::move(record));
+    m_line.clear();
+}
+
 //output stream
 LogStream::LogStream()
     : m_buffer  (),
@@ -234,4 +639,4 @@ LogStream::LogStream()
 //{
 //    out << str.toAnsiString();
 //    return out;
-//}
\ No newline at end of file
+//}
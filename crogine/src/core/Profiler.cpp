@@ -0,0 +1,688 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include <crogine/core/Profiler.hpp>
+#include <crogine/core/App.hpp>
+#include <crogine/core/FileSystem.hpp>
+#include <crogine/core/Log.hpp>
+#include <crogine/core/SysTime.hpp>
+#include <crogine/detail/Types.hpp>
+#include <crogine/gui/Gui.hpp>
+
+#include <SDL_timer.h>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace cro;
+
+namespace
+{
+    constexpr std::size_t BufferSize = 8192; //must be a power of 2
+    constexpr std::size_t MaxDepth = 64;
+    constexpr std::size_t MaxCaptureRecords = 4000000;
+    constexpr float UpdateRate = 0.5f; //same as the SystemManager sample rate
+
+    struct ZoneRecord final
+    {
+        const char* name = nullptr;
+        std::uint64_t start = 0;
+        std::uint64_t end = 0;
+        std::uint64_t path = 0;
+        std::uint64_t parent = 0;
+        std::uint32_t depth = 0;
+    };
+
+    //single producer (the owning thread) single consumer (Profiler::collect())
+    struct ThreadBuffer final
+    {
+        std::array<ZoneRecord, BufferSize> records = {};
+        std::atomic<std::uint64_t> head = 0;
+        std::atomic<std::uint64_t> tail = 0;
+        std::atomic<std::uint32_t> dropped = 0;
+        std::atomic_bool inUse = true;
+
+        std::uint32_t index = 0;
+        std::string name; //guarded by the registry mutex
+
+        //only ever touched by the owning thread
+        std::array<std::uint64_t, MaxDepth> pathStack = {};
+        std::uint32_t depth = 0;
+    };
+
+    std::mutex registryMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers;
+
+    ThreadBuffer* acquireBuffer()
+    {
+        std::scoped_lock lock(registryMutex);
+
+        //reuse buffers from threads which have since quit, once they're drained
+        for (auto& buffer : threadBuffers)
+        {
+            if (!buffer->inUse
+                && buffer->head.load() == buffer->tail.load())
+            {
+                buffer->inUse = true;
+                buffer->depth = 0;
+                buffer->name = "Thread " + std::to_string(buffer->index);
+                return buffer.get();
+            }
+        }
+
+        auto& buffer = threadBuffers.emplace_back(std::make_unique<ThreadBuffer>());
+        buffer->index = static_cast<std::uint32_t>(threadBuffers.size() - 1);
+        buffer->name = "Thread " + std::to_string(buffer->index);
+        return buffer.get();
+    }
+
+    struct BufferHandle final
+    {
+        ThreadBuffer* buffer = nullptr;
+
+        ~BufferHandle()
+        {
+            if (buffer)
+            {
+                buffer->inUse = false;
+            }
+        }
+
+        ThreadBuffer& get()
+        {
+            if (!buffer)
+            {
+                buffer = acquireBuffer();
+            }
+            return *buffer;
+        }
+    };
+    thread_local BufferHandle localBuffer;
+
+    std::uint64_t hashPath(std::uint64_t parent, const char* name)
+    {
+        //FNV-1a style combine of the name pointer into the parent path
+        static constexpr std::uint64_t Prime = 1099511628211ull;
+        return (parent ^ reinterpret_cast<std::uintptr_t>(name)) * Prime;
+    }
+
+
+    //everything below here belongs to the main thread
+    struct Node final
+    {
+        const char* name = nullptr;
+        std::uint64_t parent = 0;
+        std::uint32_t depth = 0;
+        std::uint64_t totalTicks = 0;
+        std::uint64_t maxTicks = 0;
+        std::uint32_t calls = 0;
+    };
+
+    struct DisplayNode final
+    {
+        const char* name = nullptr;
+        std::uint64_t path = 0;
+        float averageMs = 0.f; //per frame
+        float maxMs = 0.f;
+        float calls = 0.f; //per frame
+    };
+
+    struct ThreadStats final
+    {
+        std::string name;
+        std::unordered_map<std::uint64_t, Node> nodes;
+
+        std::unordered_map<std::uint64_t, std::vector<DisplayNode>> children;
+        std::uint32_t dropped = 0;
+    };
+    std::map<std::uint32_t, ThreadStats> threadStats;
+
+    struct CaptureRecord final
+    {
+        const char* name = nullptr;
+        std::uint64_t start = 0;
+        std::uint64_t end = 0;
+        std::uint32_t thread = 0;
+    };
+
+    struct CollectorState final
+    {
+        bool userEnabled = false;
+        bool windowVisible = false;
+
+        bool capturing = false;
+        std::uint32_t captureFrames = 0; //if non-zero capture ends automatically
+        std::uint64_t captureStart = 0;
+        std::vector<CaptureRecord> captureRecords;
+        std::map<std::uint32_t, std::string> captureThreadNames;
+        std::string lastCapturePath;
+
+        std::uint32_t frameCount = 0;
+        std::uint64_t lastUpdate = 0;
+
+        bool summarising = false;
+        std::uint32_t summaryFrames = 0;
+        std::map<std::uint32_t, std::unordered_map<std::uint64_t, Node>> summaryNodes;
+    }state;
+
+    void addRecord(Node& node, const ZoneRecord& record)
+    {
+        const auto ticks = record.end - record.start;
+
+        node.name = record.name;
+        node.parent = record.parent;
+        node.depth = record.depth;
+        node.totalTicks += ticks;
+        node.maxTicks = std::max(node.maxTicks, ticks);
+        node.calls++;
+    }
+
+    void updateEnabled()
+    {
+        Profiler::setEnabled(state.userEnabled || state.windowVisible || state.capturing || state.summarising);
+    }
+
+    std::string escape(const char* str)
+    {
+        std::string ret;
+        for (; *str != 0; ++str)
+        {
+            switch (*str)
+            {
+            default:
+                if (static_cast<unsigned char>(*str) >= 0x20)
+                {
+                    ret.push_back(*str);
+                }
+                break;
+            case '"':
+                ret += "\\\"";
+                break;
+            case '\\':
+                ret += "\\\\";
+                break;
+            }
+        }
+        return ret;
+    }
+
+    void drawNodes(const ThreadStats& stats, std::uint64_t parent)
+    {
+        if (stats.children.count(parent) == 0)
+        {
+            return;
+        }
+
+        for (const auto& node : stats.children.at(parent))
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+
+            const bool leaf = stats.children.count(node.path) == 0;
+            const auto flags = leaf ? ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen | ImGuiTreeNodeFlags_SpanFullWidth
+                : ImGuiTreeNodeFlags_DefaultOpen | ImGuiTreeNodeFlags_SpanFullWidth;
+
+            ImGui::PushID(reinterpret_cast<void*>(static_cast<std::uintptr_t>(node.path)));
+            const bool open = ImGui::TreeNodeEx(node.name, flags);
+            ImGui::TableNextColumn();
+            ImGui::Text("%2.3f", node.averageMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%2.3f", node.maxMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%2.1f", node.calls);
+            ImGui::PopID();
+
+            if (open && !leaf)
+            {
+                drawNodes(stats, node.path);
+                ImGui::TreePop();
+            }
+        }
+    }
+}
+
+std::atomic_bool Profiler::m_enabled = false;
+
+void Profiler::setEnabled(bool enabled)
+{
+    m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Profiler::setThreadName(const std::string& name)
+{
+    auto& buffer = localBuffer.get();
+
+    std::scoped_lock lock(registryMutex);
+    buffer.name = name;
+}
+
+void Profiler::beginCapture()
+{
+    state.captureRecords.clear();
+    state.captureThreadNames.clear();
+    state.captureStart = SDL_GetPerformanceCounter();
+    state.captureFrames = 0;
+    state.capturing = true;
+
+    updateEnabled();
+}
+
+bool Profiler::endCapture(const std::string& path)
+{
+    if (!state.capturing)
+    {
+        return false;
+    }
+
+    state.capturing = false;
+    state.captureFrames = 0;
+    updateEnabled();
+
+    //timestamps are written in microseconds
+    const double frequency = static_cast<double>(SDL_GetPerformanceFrequency()) / 1000000.0;
+
+    std::string out;
+    out.reserve(state.captureRecords.size() * 96);
+    out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    //entries are each followed by ",\n" so the last one has to be trimmed
+    const bool hasEntries = !state.captureThreadNames.empty() || !state.captureRecords.empty();
+
+    for (const auto& [index, name] : state.captureThreadNames)
+    {
+        out += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" + std::to_string(index)
+            + ",\"args\":{\"name\":\"" + escape(name.c_str()) + "\"}},\n";
+        out += "{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":0,\"tid\":" + std::to_string(index)
+            + ",\"args\":{\"sort_index\":" + std::to_string(index) + "}},\n";
+    }
+
+    for (const auto& record : state.captureRecords)
+    {
+        //zones which started before the capture are clamped to its start
+        const auto start = std::max(record.start, state.captureStart) - state.captureStart;
+        const auto duration = record.end - std::max(record.start, state.captureStart);
+
+        out += "{\"name\":\"" + escape(record.name) + "\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":0,\"tid\":" + std::to_string(record.thread)
+            + ",\"ts\":" + std::to_string(static_cast<double>(start) / frequency)
+            + ",\"dur\":" + std::to_string(static_cast<double>(duration) / frequency) + "},\n";
+    }
+
+    if (hasEntries)
+    {
+        out.resize(out.size() - 2);
+        out += "\n";
+    }
+    out += "]}\n";
+
+    state.captureRecords.clear();
+    state.captureRecords.shrink_to_fit();
+
+    RaiiRWops file;
+    file.file = SDL_RWFromFile(path.c_str(), "w");
+    if (file.file)
+    {
+        SDL_RWwrite(file.file, out.data(), out.size(), 1);
+        state.lastCapturePath = path;
+
+        LogI << "Wrote profile capture to " << path << std::endl;
+        return true;
+    }
+
+    LogE << "Failed opening " << path << " for writing profile capture: " << SDL_GetError() << std::endl;
+    return false;
+}
+
+void Profiler::captureFrames(std::uint32_t frameCount)
+{
+    if (frameCount == 0)
+    {
+        return;
+    }
+
+    beginCapture();
+    state.captureFrames = frameCount;
+}
+
+bool Profiler::isCapturing()
+{
+    return state.capturing;
+}
+
+void Profiler::beginSummary()
+{
+    state.summaryNodes.clear();
+    state.summaryFrames = 0;
+    state.summarising = true;
+
+    updateEnabled();
+}
+
+std::vector<Profiler::SummaryZone> Profiler::endSummary()
+{
+    std::vector<SummaryZone> retVal;
+    if (!state.summarising)
+    {
+        return retVal;
+    }
+
+    state.summarising = false;
+    updateEnabled();
+
+    if (state.summaryFrames == 0)
+    {
+        return retVal;
+    }
+
+    const float toMs = 1000.f / SDL_GetPerformanceFrequency();
+    const float frames = static_cast<float>(state.summaryFrames);
+
+    for (const auto& [index, nodes] : state.summaryNodes)
+    {
+        using Child = std::pair<std::uint64_t, const Node*>; //path, node
+        std::unordered_map<std::uint64_t, std::vector<Child>> children;
+        for (const auto& [path, node] : nodes)
+        {
+            children[node.parent].emplace_back(path, &node);
+        }
+
+        for (auto& [_, c] : children)
+        {
+            std::sort(c.begin(), c.end(),
+                [](const Child& a, const Child& b)
+                {
+                    return a.second->totalTicks > b.second->totalTicks;
+                });
+        }
+
+        const std::string threadName = threadStats.count(index) ? threadStats.at(index).name : std::to_string(index);
+
+        //depth first so the output reads like the profiler window
+        const std::function<void(std::uint64_t)> addChildren =
+            [&](std::uint64_t parent)
+            {
+                if (children.count(parent) == 0)
+                {
+                    return;
+                }
+
+                for (const auto& [path, node] : children.at(parent))
+                {
+                    auto& zone = retVal.emplace_back();
+                    zone.thread = threadName;
+                    zone.name = node->name;
+                    zone.depth = node->depth;
+                    zone.averageMs = (static_cast<float>(node->totalTicks) * toMs) / frames;
+                    zone.maxMs = static_cast<float>(node->maxTicks) * toMs;
+                    zone.calls = static_cast<float>(node->calls) / frames;
+
+                    addChildren(path);
+                }
+            };
+        addChildren(0);
+    }
+
+    state.summaryNodes.clear();
+    state.summaryFrames = 0;
+    return retVal;
+}
+
+void Profiler::collect()
+{
+    {
+        std::scoped_lock lock(registryMutex);
+
+        for (auto& buffer : threadBuffers)
+        {
+            auto& stats = threadStats[buffer->index];
+            stats.name = buffer->name;
+            stats.dropped += buffer->dropped.exchange(0);
+
+            if (state.capturing)
+            {
+                state.captureThreadNames[buffer->index] = buffer->name;
+            }
+
+            const auto head = buffer->head.load(std::memory_order_acquire);
+            auto tail = buffer->tail.load(std::memory_order_relaxed);
+
+            for (; tail != head; ++tail)
+            {
+                const auto& record = buffer->records[tail & (BufferSize - 1)];
+                addRecord(stats.nodes[record.path], record);
+
+                if (state.summarising)
+                {
+                    addRecord(state.summaryNodes[buffer->index][record.path], record);
+                }
+
+                if (state.capturing
+                    && record.end > state.captureStart
+                    && state.captureRecords.size() < MaxCaptureRecords)
+                {
+                    state.captureRecords.push_back({ record.name, record.start, record.end, buffer->index });
+                }
+            }
+            buffer->tail.store(tail, std::memory_order_release);
+        }
+    }
+
+    state.frameCount++;
+    if (state.summarising)
+    {
+        state.summaryFrames++;
+    }
+
+    //update the display data at a readable rate
+    const auto now = SDL_GetPerformanceCounter();
+    const auto frequency = SDL_GetPerformanceFrequency();
+    if (static_cast<float>(now - state.lastUpdate) / frequency > UpdateRate)
+    {
+        const float toMs = 1000.f / frequency;
+        const float frames = static_cast<float>(state.frameCount);
+
+        for (auto& [_, stats] : threadStats)
+        {
+            stats.children.clear();
+            for (const auto& [path, node] : stats.nodes)
+            {
+                auto& dn = stats.children[node.parent].emplace_back();
+                dn.name = node.name;
+                dn.path = path;
+                dn.averageMs = (static_cast<float>(node.totalTicks) * toMs) / frames;
+                dn.maxMs = static_cast<float>(node.maxTicks) * toMs;
+                dn.calls = static_cast<float>(node.calls) / frames;
+            }
+            stats.nodes.clear();
+
+            for (auto& [_, nodes] : stats.children)
+            {
+                std::sort(nodes.begin(), nodes.end(),
+                    [](const DisplayNode& a, const DisplayNode& b)
+                    {
+                        return a.averageMs > b.averageMs;
+                    });
+            }
+        }
+
+        state.frameCount = 0;
+        state.lastUpdate = now;
+    }
+
+    if (state.capturing
+        && state.captureFrames != 0
+        && --state.captureFrames == 0)
+    {
+        auto path = App::getPreferencePath() + "profiles/";
+        if (!FileSystem::directoryExists(path))
+        {
+            FileSystem::createDirectory(path);
+        }
+
+        auto fileName = "profile_" + SysTime::dateString() + "_" + SysTime::timeString() + ".json";
+        std::replace(fileName.begin(), fileName.end(), '/', '-');
+        std::replace(fileName.begin(), fileName.end(), ':', '-');
+
+        endCapture(path + fileName);
+    }
+}
+
+void Profiler::drawWindow()
+{
+    if (!state.windowVisible)
+    {
+        return;
+    }
+
+    ImGui::SetNextWindowSize({ 520.f, 400.f }, ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Profiler", &state.windowVisible))
+    {
+        if (state.capturing)
+        {
+            if (ImGui::Button("Stop Capture"))
+            {
+                state.captureFrames = 1; //saves on the next collect()
+            }
+            ImGui::SameLine();
+            ImGui::Text("Recording: %zu zones", state.captureRecords.size());
+        }
+        else
+        {
+            if (ImGui::Button("Start Capture"))
+            {
+                beginCapture();
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("Capture 300 Frames"))
+            {
+                captureFrames(300);
+            }
+        }
+
+        if (!state.lastCapturePath.empty())
+        {
+            ImGui::TextUnformatted(state.lastCapturePath.c_str());
+        }
+        ImGui::Separator();
+
+        ImGui::BeginChild("##threads");
+        for (const auto& [index, stats] : threadStats)
+        {
+            if (stats.children.empty())
+            {
+                continue;
+            }
+
+            ImGui::PushID(static_cast<std::int32_t>(index));
+            if (ImGui::CollapsingHeader(stats.name.c_str(), index == 0 ? ImGuiTreeNodeFlags_DefaultOpen : 0))
+            {
+                if (stats.dropped)
+                {
+                    ImGui::Text("%u zones dropped - buffer full", stats.dropped);
+                }
+
+                static constexpr auto TableFlags = ImGuiTableFlags_BordersV | ImGuiTableFlags_BordersOuterH | ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg;
+                if (ImGui::BeginTable("##zones", 4, TableFlags))
+                {
+                    ImGui::TableSetupColumn("Zone", ImGuiTableColumnFlags_NoHide);
+                    ImGui::TableSetupColumn("ms/frame", ImGuiTableColumnFlags_WidthFixed, 70.f);
+                    ImGui::TableSetupColumn("max ms", ImGuiTableColumnFlags_WidthFixed, 70.f);
+                    ImGui::TableSetupColumn("calls", ImGuiTableColumnFlags_WidthFixed, 50.f);
+                    ImGui::TableHeadersRow();
+
+                    drawNodes(stats, 0);
+
+                    ImGui::EndTable();
+                }
+            }
+            ImGui::PopID();
+        }
+        ImGui::EndChild();
+    }
+    ImGui::End();
+
+    if (!state.windowVisible)
+    {
+        updateEnabled();
+    }
+}
+
+void Profiler::setWindowVisible(bool visible)
+{
+    state.windowVisible = visible;
+    updateEnabled();
+}
+
+//zone
+void Profiler::Zone::begin()
+{
+    auto& buffer = localBuffer.get();
+    const auto parent = buffer.depth ? buffer.pathStack[std::min(buffer.depth, std::uint32_t(MaxDepth)) - 1] : 0;
+
+    if (buffer.depth < MaxDepth)
+    {
+        buffer.pathStack[buffer.depth] = hashPath(parent, m_name);
+    }
+    buffer.depth++;
+
+    m_start = SDL_GetPerformanceCounter();
+}
+
+void Profiler::Zone::end()
+{
+    const auto endTime = SDL_GetPerformanceCounter();
+
+    auto& buffer = localBuffer.get();
+    buffer.depth--;
+
+    const auto head = buffer.head.load(std::memory_order_relaxed);
+    if (head - buffer.tail.load(std::memory_order_acquire) < BufferSize)
+    {
+        const auto depth = std::min(buffer.depth, std::uint32_t(MaxDepth - 1));
+
+        auto& record = buffer.records[head & (BufferSize - 1)];
+        record.name = m_name;
+        record.start = m_start;
+        record.end = endTime;
+        record.depth = buffer.depth;
+        record.path = buffer.pathStack[depth];
+        record.parent = depth ? buffer.pathStack[depth - 1] : 0;
+
+        buffer.head.store(head + 1, std::memory_order_release);
+    }
+    else
+    {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
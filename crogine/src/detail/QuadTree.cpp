@@ -29,6 +29,7 @@ source distribution.
 
 #include <crogine/detail/QuadTree.hpp>
 #include <crogine/detail/Assert.hpp>
+#include "SpanWriter.hpp"
 
 #include <crogine/ecs/components/Drawable2D.hpp>
 #include <crogine/ecs/components/Transform.hpp>
@@ -78,6 +79,14 @@ std::vector<Entity> QuadTree::query(FloatRect queryArea) const
     return retVal;
 }
 
+std::size_t QuadTree::query(FloatRect queryArea, Entity* dst, std::size_t dstSize) const
+{
+    Detail::SpanWriter<Entity> writer(dst, dstSize);
+    query(m_rootNode.get(), m_rootArea, queryArea, writer);
+
+    return writer.count;
+}
+
 std::vector<std::pair<Entity, Entity>> QuadTree::getIntersecting() const
 {
     std::vector<std::pair<Entity, Entity>> retVal;
@@ -280,7 +289,8 @@ bool QuadTree::tryMerge(Node* node)
     return false;
 }
 
-void QuadTree::query(Node* node, FloatRect area, FloatRect queryArea, std::vector<Entity>& dst) const
+template <typename Output>
+void QuadTree::query(Node* node, FloatRect area, FloatRect queryArea, Output& dst) const
 {
     CRO_ASSERT(node, "");
     CRO_ASSERT(queryArea.intersects(area), "");
@@ -0,0 +1,55 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cstddef>
+
+namespace cro::Detail
+{
+    //used in place of a std::vector by queries which write
+    //to a caller provided array - results which don't fit are dropped
+    template <typename T>
+    struct SpanWriter final
+    {
+        SpanWriter(T* d, std::size_t s) : dst(d), size(s) {}
+
+        T* dst = nullptr;
+        std::size_t size = 0;
+        std::size_t count = 0;
+
+        void push_back(const T& t)
+        {
+            if (count < size)
+            {
+                dst[count++] = t;
+            }
+        }
+    };
+}
@@ -38,6 +38,8 @@ source distribution.
 #include <crogine/core/Clock.hpp>
 #include <crogine/core/App.hpp>
 #include <crogine/core/ConfigFile.hpp>
+#include <crogine/core/Profiler.hpp>
+#include <crogine/graphics/GPUProfiler.hpp>
 
 #include <crogine/graphics/Image.hpp>
 #include <crogine/graphics/EnvironmentMap.hpp>
@@ -227,6 +229,8 @@ Scene::~Scene()
 //public
 void Scene::simulate(float dt)
 {
+    CRO_PROFILE_SCOPE("Scene::simulate");
+
     //update the sun entity to make sure the direction is correctly rotated
     auto& sun = m_sunlight.getComponent<Sunlight>();
     sun.m_directionRotated = glm::quat_cast(m_sunlight.getComponent<Transform>().getWorldTransform()) * sun.m_direction;
@@ -624,6 +628,8 @@ void Scene::applyStars()
 
 void Scene::defaultRenderPath(const RenderTarget& rt, const Entity* cameraList, std::size_t cameraCount)
 {
+    CRO_PROFILE_SCOPE("Scene::render");
+
     CRO_ASSERT(cameraList, "Must not be nullptr");
     CRO_ASSERT(cameraCount, "Needs at least one camera");
 
@@ -703,6 +709,7 @@ void Scene::defaultRenderPath(const RenderTarget& rt, const Entity* cameraList,
         //and not other systems.... hum. Ideas on a postcard please.
         for (auto r : m_renderables)
         {
+            CRO_PROFILE_SCOPE(typeid(*r).name());
             r->render(cameraList[i], rt);
         }
     }
@@ -717,6 +724,7 @@ void Scene::postRenderPath(const RenderTarget&, const Entity* cameraList, std::s
     defaultRenderPath(m_sceneBuffer, cameraList, cameraCount);
     m_sceneBuffer.display();
 
+    CRO_GPU_SCOPE("Scene::postProcess");
     RenderTexture* inTex = &m_sceneBuffer;
     RenderTexture* outTex = nullptr;
 
@@ -28,6 +28,7 @@ source distribution.
 -----------------------------------------------------------------------*/
 
 #include <crogine/core/Clock.hpp>
+#include <crogine/core/Profiler.hpp>
 #include <crogine/core/SysTime.hpp>
 #include <crogine/ecs/InfoFlags.hpp>
 #include <crogine/ecs/Scene.hpp>
@@ -163,7 +164,10 @@ void SystemManager::process(float dt)
         
             for (auto& system : m_activeSystems)
             {
-                system->process(dt);
+                {
+                    CRO_PROFILE_SCOPE(system->getType().name());
+                    system->process(dt);
+                }
                 m_systemSamples.emplace_back(system, m_systemTimer.restart() * 1000.f);
             }
         }
@@ -171,6 +175,7 @@ void SystemManager::process(float dt)
         {
             for (auto& system : m_activeSystems)
             {
+                CRO_PROFILE_SCOPE(system->getType().name());
                 system->process(dt);
             }
         }
@@ -179,6 +184,7 @@ void SystemManager::process(float dt)
     {
         for (auto& system : m_activeSystems)
         {
+            CRO_PROFILE_SCOPE(system->getType().name());
             system->process(dt);
         }
     }
@@ -337,6 +337,9 @@ glm::vec3 Camera::pixelToCoords(glm::vec2 screenPosition, glm::vec2 targetSize)
 //private
 void Camera::updateFrustumCorners(std::size_t numSplits)
 {
+    //existing cascades no longer match the splits
+    m_shadowUpdateCount = 0;
+
     const float tanHalfFOVY = std::tan(m_verticalFOV / 2.f);
     const float tanHalfFOVX = std::tan((m_verticalFOV * m_aspectRatio) / 2.f);
 
@@ -134,6 +134,11 @@ Model::~Model()
         glCheck(glDeleteBuffers(1, &m_instanceBuffers.transformBuffer));
         m_instanceBuffers.instanceCount = 0;
     }
+
+    if (m_instanceBuffers.dataBuffer)
+    {
+        glCheck(glDeleteBuffers(1, &m_instanceBuffers.dataBuffer));
+    }
 }
 
 Model::Model(Model&& other) noexcept
@@ -214,6 +219,11 @@ Model& Model::operator=(Model&& other) noexcept
             glCheck(glDeleteBuffers(1, &m_instanceBuffers.transformBuffer));
             m_instanceBuffers.instanceCount = 0;
         }
+
+        if (m_instanceBuffers.dataBuffer)
+        {
+            glCheck(glDeleteBuffers(1, &m_instanceBuffers.dataBuffer));
+        }
         m_instanceBuffers = other.m_instanceBuffers;
         other.m_instanceBuffers = {};
 
@@ -442,6 +452,57 @@ void Model::updateInstanceTransforms(const std::vector<const std::vector<glm::ma
     m_instanceBuffers.instanceCount = instanceCount;
 }
 
+void Model::setInstanceData(const std::vector<glm::vec4>& data)
+{
+#ifdef PLATFORM_DESKTOP
+    if (m_instanceBuffers.instanceCount == 0)
+    {
+        LogW << "setInstanceTransforms() must be called before setting instance data" << std::endl;
+        return;
+    }
+
+    if (data.size() < m_instanceBuffers.instanceCount)
+    {
+        LogW << "Instance data has " << data.size() << " values, expected " << m_instanceBuffers.instanceCount << std::endl;
+        return;
+    }
+
+    const bool newBuffer = m_instanceBuffers.dataBuffer == 0;
+    if (newBuffer)
+    {
+        glCheck(glGenBuffers(1, &m_instanceBuffers.dataBuffer));
+    }
+
+    glCheck(glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffers.dataBuffer));
+    glCheck(glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(glm::vec4), data.data(), GL_DYNAMIC_DRAW));
+    glCheck(glBindBuffer(GL_ARRAY_BUFFER, 0));
+
+    //existing VAOs need to know about the new buffer
+    if (newBuffer)
+    {
+        for (auto i = 0u; i < m_meshData.submeshCount; ++i)
+        {
+            for (auto pass : { Mesh::IndexData::Final, Mesh::IndexData::Shadow })
+            {
+                if (m_materials[pass][i].attribs[Shader::AttributeID::InstanceData][Material::Data::Index] != -1)
+                {
+                    updateVAO(i, pass);
+                }
+            }
+        }
+    }
+#endif
+}
+
+std::uint32_t Model::getInstanceCount() const
+{
+#ifdef PLATFORM_DESKTOP
+    return m_instanceBuffers.instanceCount;
+#else
+    return 0;
+#endif
+}
+
 //private
 void Model::initMaterialAnimation(std::size_t index)
 {
@@ -592,6 +653,16 @@ void Model::updateVAO(std::size_t idx, std::int32_t passIndex)
             glCheck(glVertexAttribPointer(attribs[Shader::AttributeID::InstanceTransform][Material::Data::Index] + j, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(glm::vec4), reinterpret_cast<void*>(static_cast<intptr_t>(j * sizeof(glm::vec4)))));
             glCheck(glVertexAttribDivisor(attribs[Shader::AttributeID::InstanceTransform][Material::Data::Index] + j, 1));
         }
+
+        attribIndex = attribs[Shader::AttributeID::InstanceData][Material::Data::Index];
+        if (attribIndex != -1
+            && m_instanceBuffers.dataBuffer != 0)
+        {
+            glCheck(glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffers.dataBuffer));
+            glCheck(glEnableVertexAttribArray(attribIndex));
+            glCheck(glVertexAttribPointer(attribIndex, 4, GL_FLOAT, GL_FALSE, sizeof(glm::vec4), 0));
+            glCheck(glVertexAttribDivisor(attribIndex, 1));
+        }
         draw = DrawInstanced(*this);
     }
     else
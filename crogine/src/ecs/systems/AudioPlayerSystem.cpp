@@ -119,7 +119,10 @@ void AudioPlayerSystem::process(float)
         {
             //hmm these are static funcs so could be called directly by component setters, no?
             AudioRenderer::setSourcePitch(audioSource.m_ID, audioSource.m_pitch);
-            AudioRenderer::setSourceVolume(audioSource.m_ID, audioSource.m_volume * AudioMixer::m_channels[audioSource.m_mixerChannel] * AudioMixer::m_prefadeChannels[audioSource.m_mixerChannel]);
+            //renderers which mix channels themselves apply the channel volume
+            const float channelVolume = AudioRenderer::mixesChannels() ? 1.f : AudioMixer::m_channels[audioSource.m_mixerChannel] * AudioMixer::m_prefadeChannels[audioSource.m_mixerChannel];
+            AudioRenderer::setSourceChannel(audioSource.m_ID, audioSource.m_mixerChannel);
+            AudioRenderer::setSourceVolume(audioSource.m_ID, audioSource.m_volume * channelVolume);
             AudioRenderer::setSourcePosition(audioSource.m_ID, listenerPosition);
         }
         else if (audioSource.m_state == AudioEmitter::State::Stopped)
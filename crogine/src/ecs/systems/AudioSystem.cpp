@@ -124,7 +124,10 @@ void AudioSystem::process(float)
         {
             //hmm these are static funcs so could be called directly by component setters, no?
             AudioRenderer::setSourcePitch(audioSource.m_ID, audioSource.m_pitch);
-            AudioRenderer::setSourceVolume(audioSource.m_ID, audioSource.m_volume * AudioMixer::m_channels[audioSource.m_mixerChannel] * AudioMixer::m_prefadeChannels[audioSource.m_mixerChannel]);
+            //renderers which mix channels themselves apply the channel volume
+            const float channelVolume = AudioRenderer::mixesChannels() ? 1.f : AudioMixer::m_channels[audioSource.m_mixerChannel] * AudioMixer::m_prefadeChannels[audioSource.m_mixerChannel];
+            AudioRenderer::setSourceChannel(audioSource.m_ID, audioSource.m_mixerChannel);
+            AudioRenderer::setSourceVolume(audioSource.m_ID, audioSource.m_volume * channelVolume);
             AudioRenderer::setSourceRolloff(audioSource.m_ID, audioSource.m_rolloff);
             AudioRenderer::setSourceVelocity(audioSource.m_ID, audioSource.m_velocity);
 
@@ -86,10 +86,19 @@ void CameraSystem::process(float)
             //don't clear these then systems updating them can just do swaps
             //finalPass.drawList.clear();
             //reflectionPass.drawList.clear();
-            getScene()->updateDrawLists(entity);
-        }
+            if (camera.refreshDrawLists)
+            {
+                getScene()->updateDrawLists(entity);
 
-        camera.m_lastActive = camera.active;
+                //only track this when the lists are updated so that
+                //activatedThisFrame() is still seen by the renderers
+                camera.m_lastActive = true;
+            }
+        }
+        else
+        {
+            camera.m_lastActive = false;
+        }
         
         if (camera.isStatic)
         {
@@ -30,6 +30,7 @@ source distribution.
 #include "../../detail/GLCheck.hpp"
 
 #include <crogine/ecs/systems/DeferredRenderSystem.hpp>
+#include <crogine/graphics/GPUProfiler.hpp>
 
 #include <crogine/ecs/components/Model.hpp>
 #include <crogine/ecs/components/Transform.hpp>
@@ -257,6 +258,8 @@ void DeferredRenderSystem::updateDrawList(Entity camera)
 
 void DeferredRenderSystem::render(Entity camera, const RenderTarget& rt)
 {
+    CRO_GPU_SCOPE("DeferredRenderSystem");
+
 #ifdef PLATFORM_DESKTOP
     const auto& cam = camera.getComponent<Camera>();
     const auto& pass = cam.getPass(Camera::Pass::Final);
@@ -32,8 +32,46 @@ source distribution.
 #include <crogine/ecs/components/DynamicTreeComponent.hpp>
 #include <crogine/ecs/systems/DynamicTreeSystem.hpp>
 
+#include "../../detail/SpanWriter.hpp"
+
 using namespace cro;
 
+namespace
+{
+    template <typename Output>
+    void queryTree(const Detail::BalancedTree& tree, Box area, std::uint64_t filter, Output& dst)
+    {
+        Detail::FixedStack<std::int32_t, 256> stack;
+        stack.push(tree.getRoot());
+
+        while (stack.size() > 0)
+        {
+            auto treeID = stack.pop();
+            if (treeID == Detail::TreeNode::Null)
+            {
+                continue;
+            }
+
+            const auto& node = tree.getNodes()[treeID];
+            if (area.intersects(node.fatBounds))
+            {
+                //TODO it would be nice to precache the filter fetch, but it would miss changes at the component level
+                if (node.isLeaf() && node.entity.isValid()
+                    && (node.entity.getComponent<DynamicTreeComponent>().getFilterFlags() & filter)) 
+                {
+                    //we have a candidate, stash
+                    dst.push_back(node.entity);
+                }
+                else
+                {
+                    stack.push(node.childA);
+                    stack.push(node.childB);
+                }
+            }
+        }
+    }
+}
+
 DynamicTreeSystem::DynamicTreeSystem(MessageBus& mb, float unitsPerMetre)
     : System(mb, typeid(DynamicTreeSystem)),
     m_tree  (unitsPerMetre)
@@ -77,38 +115,18 @@ void DynamicTreeSystem::onEntityRemoved(Entity entity)
 
 std::vector<Entity> DynamicTreeSystem::query(Box area, std::uint64_t filter) const
 {
-    Detail::FixedStack<std::int32_t, 256> stack;
-    stack.push(m_tree.getRoot());
-
     std::vector<Entity> retVal;
     retVal.reserve(256);
 
-    while (stack.size() > 0)
-    {
-        auto treeID = stack.pop();
-        if (treeID == Detail::TreeNode::Null)
-        {
-            continue;
-        }
-
-        const auto& node = m_tree.getNodes()[treeID];
-        if (area.intersects(node.fatBounds))
-        {
-            //TODO it would be nice to precache the filter fetch, but it would miss changes at the component level
-            if (node.isLeaf() && node.entity.isValid()
-                && (node.entity.getComponent<DynamicTreeComponent>().m_filterFlags & filter)) 
-            {
-                //we have a candidate, stash
-                retVal.push_back(node.entity);
-            }
-            else
-            {
-                stack.push(node.childA);
-                stack.push(node.childB);
-            }
-        }
-    }
+    queryTree(m_tree, area, filter, retVal);
     return retVal;
 }
 
+std::size_t DynamicTreeSystem::query(Box area, Entity* dst, std::size_t dstSize, std::uint64_t filter) const
+{
+    Detail::SpanWriter<Entity> writer(dst, dstSize);
+    queryTree(m_tree, area, filter, writer);
+    return writer.count;
+}
+
 //private
\ No newline at end of file
@@ -42,6 +42,7 @@ source distribution.
 #include <crogine/ecs/systems/CameraSystem.hpp>
 #include <crogine/ecs/systems/ModelRenderer.hpp>
 
+#include <crogine/graphics/GPUProfiler.hpp>
 #include <crogine/graphics/Spatial.hpp>
 #include "../../detail/GLCheck.hpp"
 
@@ -52,7 +53,7 @@ source distribution.
 #endif
 
 #ifdef USE_PARALLEL_PROCESSING
-#include <execution>
+#include <crogine/core/JobSystem.hpp>
 #include <mutex>
 #endif
 
@@ -196,7 +197,7 @@ void LightVolumeSystem::process(float)
 {
     const auto& entities = getEntities();
 #ifdef USE_PARALLEL_PROCESSING
-    std::for_each(std::execution::par, entities.cbegin(), entities.cend(), 
+    JobSystem::forEach(entities.cbegin(), entities.cend(), 
         [](Entity entity)
 #else
     for (auto entity : entities)
@@ -239,7 +240,7 @@ void LightVolumeSystem::updateDrawList(Entity cameraEnt)
     //instead of being recalculated for every active camera
 #ifdef USE_PARALLEL_PROCESSING
     std::mutex mutex;
-    std::for_each(std::execution::par, entities.cbegin(), entities.cend(), 
+    JobSystem::forEach(entities.cbegin(), entities.cend(), 
         [&](Entity entity)
 #else
     for (auto entity : entities)
@@ -301,6 +302,8 @@ void LightVolumeSystem::updateDrawList(Entity cameraEnt)
 
 void LightVolumeSystem::updateTarget(Entity camera, RenderTexture& target)
 {
+    CRO_GPU_SCOPE("LightVolumeSystem");
+
     const auto& camComponent = camera.getComponent<Camera>();
     const auto& pass = camComponent.getPass(Camera::Pass::Final);
     //const auto& camTx = camera.getComponent<Transform>();
@@ -399,11 +402,7 @@ void LightVolumeSystem::flushEntity(Entity e)
     {
         //if (!list.empty())
         {
-#ifdef USE_PARALLEL_PROCESSING
-            list.erase(std::remove_if(std::execution::par, list.begin(), list.end(),
-#else
             list.erase(std::remove_if(list.begin(), list.end(),
-#endif
                 [e](Entity ent)
                 {
                     return e == ent;
@@ -37,9 +37,13 @@ source distribution.
 #include <crogine/core/Console.hpp>
 #include <crogine/ecs/Scene.hpp>
 #include <crogine/ecs/systems/ModelRenderer.hpp>
+#include <crogine/ecs/systems/LightVolumeSystem.hpp>
 #include <crogine/ecs/components/Camera.hpp>
 #include <crogine/ecs/components/Transform.hpp>
 #include <crogine/ecs/components/Model.hpp>
+#include <crogine/ecs/components/LightVolume.hpp>
+#include <crogine/graphics/GPUProfiler.hpp>
+#include <crogine/graphics/OcclusionBuffer.hpp>
 #include <crogine/util/Matrix.hpp>
 #include <crogine/util/Frustum.hpp>
 
@@ -53,13 +57,17 @@ source distribution.
 #include <crogine/detail/glm/gtc/matrix_inverse.hpp>
 #include <crogine/detail/glm/gtx/norm.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 //#define PARALLEL_DISABLE
 #ifdef PARALLEL_DISABLE
 #undef USE_PARALLEL_PROCESSING
 #endif
 
 #ifdef USE_PARALLEL_PROCESSING
-#include <execution>
+#include <crogine/core/JobSystem.hpp>
 #include <mutex>
 #endif
 
@@ -76,7 +84,8 @@ ModelRenderer::ModelRenderer(MessageBus& mb)
     : System                (mb, typeid(ModelRenderer)),
     m_drawLists             (),
     m_pass                  (Mesh::IndexData::Final),
-    m_lightUBO              ("LightUniforms")/*,
+    m_lightUBO              ("LightUniforms"),
+    m_clusterBlock          (std::make_unique<ClusterUniformBlock>())/*,
     m_tree          (1.f),
     m_useTreeQueries(false)*/
 {
@@ -129,12 +138,47 @@ ModelRenderer::ModelRenderer(MessageBus& mb)
                     }
                     ImGui::Text("Avg render time for camera %u: %3.3f ms", i, m_benchmarks[i].avgTime);
                 }
+
+                if (GPUProfiler::isAvailable())
+                {
+                    ImGui::Separator();
+                    if (!GPUProfiler::isEnabled())
+                    {
+                        if (ImGui::Button("Enable GPU Timing"))
+                        {
+                            GPUProfiler::setUserEnabled(true);
+                        }
+                    }
+
+                    for (const auto& result : GPUProfiler::getResults())
+                    {
+                        ImGui::Text("%*sGPU %s: %3.3f ms", result.depth * 2, "", result.name, result.inclusiveMs);
+                    }
+                }
             }
             ImGui::End();
         });
 #endif
 }
 
+ModelRenderer::~ModelRenderer()
+{
+#ifdef PLATFORM_DESKTOP
+    for (auto& clusters : m_lightClusters)
+    {
+        if (clusters.texture)
+        {
+            glCheck(glDeleteTextures(1, &clusters.texture));
+        }
+
+        if (clusters.tbo)
+        {
+            glCheck(glDeleteBuffers(1, &clusters.tbo));
+        }
+    }
+#endif
+}
+
 //public
 void ModelRenderer::updateDrawList(Entity cameraEnt)
 {
@@ -178,6 +222,35 @@ void ModelRenderer::updateDrawList(Entity cameraEnt)
                 }
             }
         }
+
+        m_lightClusters.resize(m_drawLists.size());
+        for (auto& clusters : m_lightClusters)
+        {
+            for (auto i = 0; i < 2; ++i)
+            {
+                if (!clusters.ubos[i])
+                {
+                    clusters.ubos[i] = std::make_shared<UniformBuffer<ClusterUniformBlock>>("ClusterUniforms");
+
+                    for (auto entity : getEntities())
+                    {
+                        const auto& model = entity.getComponent<Model>();
+                        for (auto j = 0u; j < model.getMeshData().submeshCount; ++j)
+                        {
+                            const auto& mat = model.getMaterialData(Mesh::IndexData::Final, j);
+                            if (mat.hasClusterUBO())
+                            {
+                                clusters.ubos[i]->addShader(mat.shader);
+                            }
+                        }
+                    }
+                }
+            }
+
+            //reflections aren't clustered so make sure they have no lights
+            m_clusterBlock->gridSize.w = 0;
+            clusters.ubos[Camera::Pass::Reflection]->setData(*m_clusterBlock);
+        }
 #endif
     }
 
@@ -198,6 +271,13 @@ void ModelRenderer::updateDrawList(Entity cameraEnt)
     //flag values make sure transparent materials are rendered last
     //with opaque going front to back and transparent back to front
     auto& drawList = m_drawLists[camIndex];
+
+#ifdef PLATFORM_DESKTOP
+    //lights are culled by the LightVolumeSystem which may not
+    //have updated yet, so the clusters are rebuilt when rendering
+    m_lightClusters[camIndex].dirty = true;
+#endif
+
     for (auto i = 0; i < passCount; ++i)
     {
 #ifdef PLATFORM_DESKTOP
@@ -218,29 +298,11 @@ void ModelRenderer::updateDrawList(Entity cameraEnt)
 #endif
 
 
-//apparently this won't work on gcc 9/10/11 (and should be disabled on lower versions anyway)
-#ifndef _MSC_VER
-#if __GNUC__ <= 14
-#ifdef USE_PARALLEL_PROCESSING
-#undef USE_PARALLEL_PROCESSING
-#define GNUC_UNSUPPORTED
-#endif //USE_PARALLEL_PROCESSING
-#endif //__GNUC__
-#endif //_MSC_VER
-
-#if defined USE_PARALLEL_PROCESSING
-        std::sort(std::execution::par, std::begin(drawList[i].renderables), std::end(drawList[i].renderables),
-#else
         std::sort(std::begin(drawList[i].renderables), std::end(drawList[i].renderables),
-#endif
             [](MaterialPair& a, MaterialPair& b)
             {
                 return a.second.flags < b.second.flags;
             });
-#ifdef GNUC_UNSUPPORTED
-#define USE_PARALLEL_PROCESSING
-#undef GNUC_UNSUPPORTED
-#endif
 
     }
 }
@@ -254,7 +316,7 @@ void ModelRenderer::process(float dt)
     auto& entities = getEntities();
 
 #ifdef USE_PARALLEL_PROCESSING
-    std::for_each(std::execution::par, entities.cbegin(), entities.cend(),
+    JobSystem::forEach(entities.cbegin(), entities.cend(),
         [&, dt](Entity entity)
 #else
     for (auto entity : entities)
@@ -299,7 +361,7 @@ void ModelRenderer::process(float dt)
         {
             auto& list = drawList[i].renderables;
 #ifdef USE_PARALLEL_PROCESSING
-            std::for_each(std::execution::par, list.begin(), list.end(),
+            JobSystem::forEach(list.begin(), list.end(),
                 [&, dt](MaterialPair& pair)
 #else
             for (MaterialPair& pair : list)
@@ -317,6 +379,8 @@ void ModelRenderer::process(float dt)
 
 void ModelRenderer::render(Entity camera, const RenderTarget& rt)
 {
+    CRO_GPU_SCOPE("ModelRenderer");
+
 #ifdef BENCHMARK
     m_timer.restart();
 #endif
@@ -327,6 +391,24 @@ void ModelRenderer::render(Entity camera, const RenderTarget& rt)
     if (camIndex < m_drawLists.size())
     {
         m_cameraUBOs[camIndex][camComponent.getActivePassIndex()]->bind();
+
+#ifdef PLATFORM_DESKTOP
+        auto& clusters = m_lightClusters[camIndex];
+        auto& clusterUBO = clusters.ubos[camComponent.getActivePassIndex()];
+        if (clusterUBO->hasShaders())
+        {
+            if (camComponent.getActivePassIndex() == Camera::Pass::Final
+                && clusters.dirty)
+            {
+                updateLightClusters(camera);
+                clusters.dirty = false;
+            }
+
+            clusterUBO->bind();
+            glCheck(glActiveTexture(GL_TEXTURE0 + ClusterTextureUnit));
+            glCheck(glBindTexture(GL_TEXTURE_BUFFER, clusters.texture));
+        }
+#endif
         
         const auto& pass = camComponent.getActivePass();
         //why did we have this offset here??
@@ -340,8 +422,8 @@ void ModelRenderer::render(Entity camera, const RenderTarget& rt)
 
 
         //DPRINT("Render count", std::to_string(m_visibleEntities.size()));
-        const auto& visibleEntities = m_drawLists[camIndex][camComponent.getActivePassIndex()].renderables;
-        for (const auto& [entity, sortData] : visibleEntities)
+        const auto& passList = m_drawLists[camIndex][camComponent.getActivePassIndex()];
+        for (const auto& [entity, sortData] : passList.renderables)
         {
             //may have been marked for deletion - though this should never be true
             //as we remove entities from draw lists when they're removed from the system
@@ -361,8 +443,9 @@ void ModelRenderer::render(Entity camera, const RenderTarget& rt)
             glCheck(glBindBuffer(GL_ARRAY_BUFFER, model.m_meshData.vbo));
 #endif //PLATFORM
 
-            for (auto i : sortData.matIDs)
+            for (auto j = 0u; j < sortData.materialCount; ++j)
             {
+                const auto i = passList.materialIDs[sortData.materialStart + j];
                 const auto& material = model.m_materials[Mesh::IndexData::Final][i];
                 const auto& uniforms = material.uniforms;
 
@@ -468,6 +551,24 @@ std::size_t ModelRenderer::getVisibleCount(std::size_t cameraIndex, std::int32_t
     return 0;
 }
 
+std::size_t ModelRenderer::getClusteredLightCount(std::size_t cameraIndex) const
+{
+    return cameraIndex < m_lightClusters.size() ? m_lightClusters[cameraIndex].lightCount : 0;
+}
+
+std::size_t ModelRenderer::getOccludedCount(std::size_t cameraIndex, std::int32_t passIndex) const
+{
+    CRO_ASSERT(cameraIndex < m_drawLists.size(), "");
+    switch (passIndex)
+    {
+    default: return 0;
+    case Camera::Pass::Final:
+    case Camera::Pass::Refraction:
+        return m_drawLists[cameraIndex][Camera::Pass::Final].occludedCount;
+    }
+    return 0;
+}
+
 const std::string& ModelRenderer::getDefaultVertexShader(std::int32_t type)
 {
     static const std::string defaultVal;
@@ -536,6 +637,20 @@ void ModelRenderer::onEntityAdded(Entity entity)
         {
             m_lightUBO.addShader(mat.shader);
         }
+
+        if (mat.hasClusterUBO())
+        {
+            for (auto& clusters : m_lightClusters)
+            {
+                for (auto& ubo : clusters.ubos)
+                {
+                    if (ubo)
+                    {
+                        ubo->addShader(mat.shader);
+                    }
+                }
+            }
+        }
     }
 
     //ofc this may all be undone if we change the material on the component...
@@ -558,6 +673,22 @@ void ModelRenderer::onEntityAdded(Entity entity)
             //that it also uses lighting...
             m_lightUBO.removeShader(oldShader);
             m_lightUBO.addShader(newShader);
+
+            const bool clustered = glGetUniformBlockIndex(newShader, "ClusterUniforms") != GL_INVALID_INDEX;
+            for (auto& clusters : m_lightClusters)
+            {
+                for (auto& ubo : clusters.ubos)
+                {
+                    if (ubo)
+                    {
+                        ubo->removeShader(oldShader);
+                        if (clustered)
+                        {
+                            ubo->addShader(newShader);
+                        }
+                    }
+                }
+            }
         };
 #endif
 }
@@ -582,6 +713,17 @@ void ModelRenderer::onEntityRemoved(Entity entity)
             }
         }
         m_lightUBO.removeShader(model.getMaterialData(Mesh::IndexData::Final, i).shader);
+
+        for (auto& clusters : m_lightClusters)
+        {
+            for (auto& ubo : clusters.ubos)
+            {
+                if (ubo)
+                {
+                    ubo->removeShader(model.getMaterialData(Mesh::IndexData::Final, i).shader);
+                }
+            }
+        }
     }
 #endif
 
@@ -597,11 +739,7 @@ void ModelRenderer::flushEntity(Entity entity)
         {
             //if (!pl.renderables.empty()) //hmm is this check even necessary?
             {
-#ifdef USE_PARALLEL_PROCESSING
-                pl.renderables.erase(std::remove_if(std::execution::par, pl.renderables.begin(), pl.renderables.end(),
-#else
                 pl.renderables.erase(std::remove_if(pl.renderables.begin(), pl.renderables.end(),
-#endif
                     [entity](const MaterialPair& p)
                     {
                         return p.first == entity;
@@ -612,6 +750,196 @@ void ModelRenderer::flushEntity(Entity entity)
 }
 
 //private
+void ModelRenderer::updateLightClusters(Entity cameraEnt)
+{
+#ifdef PLATFORM_DESKTOP
+    const auto& camComponent = cameraEnt.getComponent<Camera>();
+    auto& clusters = m_lightClusters[camComponent.getDrawListIndex()];
+    auto& block = *m_clusterBlock;
+    block.gridSize.w = 0;
+
+    const auto* lightSystem = getScene()->getSystem<LightVolumeSystem>();
+    if (lightSystem
+        && !camComponent.isOrthographic())
+    {
+        const auto& pass = camComponent.getPass(Camera::Pass::Final);
+        const auto& projection = camComponent.getProjectionMatrix();
+        const float nearPlane = camComponent.getNearPlane();
+        const float farPlane = camComponent.getFarPlane();
+
+        //depth slices are spaced exponentially so that clusters
+        //near the camera are roughly as deep as they are wide
+        const float logRatio = std::log(farPlane / nearPlane);
+        block.depthParams = glm::vec4(ClusterGridZ / logRatio, -(ClusterGridZ * std::log(nearPlane)) / logRatio, nearPlane, farPlane);
+
+        const auto getSlice = [&block](float depth)
+        {
+            const float slice = std::floor(std::log(depth) * block.depthParams.x + block.depthParams.y);
+            return static_cast<std::uint32_t>(std::clamp(slice, 0.f, static_cast<float>(ClusterGridZ - 1)));
+        };
+
+        const auto getTile = [](float ndc, std::uint32_t tileCount)
+        {
+            const float tile = std::floor(((ndc * 0.5f) + 0.5f) * tileCount);
+            return static_cast<std::uint32_t>(std::clamp(tile, 0.f, static_cast<float>(tileCount - 1)));
+        };
+
+        //find the range of clusters touched by each light
+        m_lightRanges.clear();
+        for (auto entity : lightSystem->getDrawList(camComponent.getDrawListIndex()))
+        {
+            if (block.gridSize.w == MaxClusteredLights)
+            {
+                break;
+            }
+
+            if ((entity.getComponent<Model>().getRenderFlags() & pass.renderFlags) == 0)
+            {
+                continue;
+            }
+
+            const auto& light = entity.getComponent<LightVolume>();
+            const auto worldPos = entity.getComponent<Transform>().getWorldPosition();
+            const float radius = light.radius * light.lightScale;
+
+            const auto viewPos = glm::vec3(pass.viewMatrix * glm::vec4(worldPos, 1.f));
+            const float depth = -viewPos.z;
+
+            if (depth + radius < nearPlane
+                || depth - radius > farPlane)
+            {
+                continue;
+            }
+
+            std::array<std::uint32_t, 6u> range =
+            {
+                0, 0, getSlice(std::max(nearPlane, depth - radius)),
+                ClusterGridX - 1, ClusterGridY - 1, getSlice(std::min(farPlane, depth + radius))
+            };
+
+            //if the light crosses the near plane it may cover the whole screen
+            if (depth - radius > nearPlane)
+            {
+                //the corners of the view space AABB are all in front of the
+                //camera so their projection conservatively bounds the sphere
+                glm::vec2 ndcMin(std::numeric_limits<float>::max());
+                glm::vec2 ndcMax(std::numeric_limits<float>::lowest());
+                for (auto i = 0; i < 8; ++i)
+                {
+                    const glm::vec3 corner = viewPos + glm::vec3((i & 1) ? radius : -radius,
+                                                                 (i & 2) ? radius : -radius,
+                                                                 (i & 4) ? radius : -radius);
+
+                    const auto clipPos = projection * glm::vec4(corner, 1.f);
+                    const auto ndc = glm::vec2(clipPos) / clipPos.w;
+                    ndcMin = glm::min(ndcMin, ndc);
+                    ndcMax = glm::max(ndcMax, ndc);
+                }
+
+                if (ndcMax.x < -1.f || ndcMin.x > 1.f
+                    || ndcMax.y < -1.f || ndcMin.y > 1.f)
+                {
+                    continue;
+                }
+
+                range[0] = getTile(ndcMin.x, ClusterGridX);
+                range[1] = getTile(ndcMin.y, ClusterGridY);
+                range[3] = getTile(ndcMax.x, ClusterGridX);
+                range[4] = getTile(ndcMax.y, ClusterGridY);
+            }
+
+            block.lightPositions[block.gridSize.w] = glm::vec4(worldPos, radius);
+            block.lightColours[block.gridSize.w] = light.colour.getVec4() * light.cullAttenuation;
+            block.gridSize.w++;
+
+            m_lightRanges.push_back(range);
+        }
+
+        if (!m_lightRanges.empty())
+        {
+            //the grid is stored as a header per cluster with the
+            //offset of its light indices in the upper 24 bits and
+            //the light count in the lower 8, followed by the indices
+            constexpr std::uint32_t ClusterCount = ClusterGridX * ClusterGridY * ClusterGridZ;
+            constexpr std::uint32_t MaxLightsPerCluster = 0xff;
+
+            const auto forEachCluster = [](const std::array<std::uint32_t, 6u>& range, auto&& func)
+            {
+                for (auto z = range[2]; z <= range[5]; ++z)
+                {
+                    for (auto y = range[1]; y <= range[4]; ++y)
+                    {
+                        for (auto x = range[0]; x <= range[3]; ++x)
+                        {
+                            func(x + (y * ClusterGridX) + (z * ClusterGridX * ClusterGridY));
+                        }
+                    }
+                }
+            };
+
+            m_clusterCounts.assign(ClusterCount, 0);
+            for (const auto& range : m_lightRanges)
+            {
+                forEachCluster(range, [&](std::uint32_t cluster) { m_clusterCounts[cluster]++; });
+            }
+
+            m_clusterData.resize(ClusterCount);
+            std::uint32_t offset = ClusterCount;
+            for (auto i = 0u; i < ClusterCount; ++i)
+            {
+                const auto count = std::min(m_clusterCounts[i], MaxLightsPerCluster);
+                m_clusterData[i] = (offset << 8) | count;
+                offset += count;
+
+                //reused as the insertion point below
+                m_clusterCounts[i] = 0;
+            }
+
+            m_clusterData.resize(offset);
+            for (auto i = 0u; i < m_lightRanges.size(); ++i)
+            {
+                forEachCluster(m_lightRanges[i], 
+                    [&, i](std::uint32_t cluster)
+                    {
+                        const auto header = m_clusterData[cluster];
+                        if (m_clusterCounts[cluster] < (header & MaxLightsPerCluster))
+                        {
+                            m_clusterData[(header >> 8) + m_clusterCounts[cluster]++] = i;
+                        }
+                    });
+            }
+
+            if (clusters.tbo == 0)
+            {
+                glCheck(glGenBuffers(1, &clusters.tbo));
+                glCheck(glGenTextures(1, &clusters.texture));
+
+                glCheck(glBindBuffer(GL_TEXTURE_BUFFER, clusters.tbo));
+                glCheck(glBufferData(GL_TEXTURE_BUFFER, sizeof(std::uint32_t) * ClusterCount, nullptr, GL_STREAM_DRAW));
+                clusters.tboSize = ClusterCount;
+
+                glCheck(glBindTexture(GL_TEXTURE_BUFFER, clusters.texture));
+                glCheck(glTexBuffer(GL_TEXTURE_BUFFER, GL_R32UI, clusters.tbo));
+                glCheck(glBindTexture(GL_TEXTURE_BUFFER, 0));
+            }
+
+            glCheck(glBindBuffer(GL_TEXTURE_BUFFER, clusters.tbo));
+            if (m_clusterData.size() > clusters.tboSize)
+            {
+                //grow with some headroom so we don't reallocate every time a light moves
+                clusters.tboSize = m_clusterData.size() + (m_clusterData.size() / 2);
+                glCheck(glBufferData(GL_TEXTURE_BUFFER, sizeof(std::uint32_t) * clusters.tboSize, nullptr, GL_STREAM_DRAW));
+            }
+            glCheck(glBufferSubData(GL_TEXTURE_BUFFER, 0, sizeof(std::uint32_t) * m_clusterData.size(), m_clusterData.data()));
+            glCheck(glBindBuffer(GL_TEXTURE_BUFFER, 0));
+        }
+    }
+
+    clusters.lightCount = block.gridSize.w;
+    clusters.ubos[Camera::Pass::Final]->setData(block);
+#endif
+}
+
 void ModelRenderer::updateDrawListDefault(Entity cameraEnt)
 {
     const auto& camComponent = cameraEnt.getComponent<Camera>();
@@ -634,12 +962,28 @@ void ModelRenderer::updateDrawListDefault(Entity cameraEnt)
 
         //also store the view mat so we can update model worldView mat in process()
         drawList[i].renderables.clear();
+        drawList[i].materialIDs.clear();
         drawList[i].viewMatrix = camComponent.getPass(i).viewMatrix;
+        drawList[i].occludedCount = 0;
+    }
+
+    //only the final pass is tested for occlusion
+    auto* occlusionBuffer = camComponent.occlusionBuffer;
+    if (occlusionBuffer)
+    {
+        if (occlusionBuffer->isEnabled())
+        {
+            occlusionBuffer->update(camComponent.getPass(Camera::Pass::Final).viewProjectionMatrix);
+        }
+        else
+        {
+            occlusionBuffer = nullptr;
+        }
     }
 #ifdef USE_PARALLEL_PROCESSING
     std::mutex mutex;
 
-    std::for_each(std::execution::par, entities.cbegin(), entities.cend(), 
+    JobSystem::forEach(entities.cbegin(), entities.cend(), 
         [&](Entity entity)
 #else
     for (auto entity : entities)
@@ -713,44 +1057,77 @@ void ModelRenderer::updateDrawListDefault(Entity cameraEnt)
                 model.m_visible = cro::Util::Frustum::visible(camComponent.getFrustumData(), camComponent.getPass(p).viewMatrix * tx.getWorldTransform(), model.getAABB());
             }*/
 
-            if (visible)
+            if (visible
+                && p == Camera::Pass::Final
+                && occlusionBuffer
+                && !occlusionBuffer->isVisible(model.getAABB(), tx.getWorldTransform()))
             {
-                auto opaque = std::make_pair(entity, SortData());
-                auto transparent = std::make_pair(entity, SortData());
+                visible = false;
+#ifdef USE_PARALLEL_PROCESSING
+                std::scoped_lock l(mutex);
+#endif
+                drawList[p].occludedCount++;
+            }
 
-                //foreach material
-                //add ent/index pair to alpha or opaque list
+            if (visible)
+            {
+                const auto& materials = model.m_materials[Mesh::IndexData::Final];
+                std::uint32_t transparentCount = 0;
                 for (auto i = 0u; i < model.m_meshData.submeshCount; ++i)
                 {
-                    if (model.m_materials[Mesh::IndexData::Final][i].blendMode != Material::BlendMode::None)
+                    if (materials[i].blendMode != Material::BlendMode::None)
                     {
-                        transparent.second.matIDs.push_back(static_cast<std::int32_t>(i));
-                        transparent.second.flags = static_cast<std::int64_t>(-distance * 1000000.f); //suitably large number to shift decimal point
-                        transparent.second.flags += 0x0FFF000000000000; //gaurentees embiggenment so that sorting places transparent last
-                    }
-                    else
-                    {
-                        opaque.second.matIDs.push_back(static_cast<std::int32_t>(i));
-                        opaque.second.flags = static_cast<std::int64_t>(distance * 1000000.f);
+                        transparentCount++;
                     }
                 }
+                const std::uint32_t opaqueCount = static_cast<std::uint32_t>(model.m_meshData.submeshCount) - transparentCount;
 
-                if (!opaque.second.matIDs.empty())
-                {
-                    model.m_drawlistCount++;
 #ifdef USE_PARALLEL_PROCESSING
-                    std::scoped_lock l(mutex);
+                std::scoped_lock l(mutex);
 #endif
-                    drawList[p].renderables.push_back(opaque);
+                auto& passList = drawList[p];
+
+                //foreach material
+                //add ent/index pair to alpha or opaque list
+                //the indices are stored in the pass list rather than
+                //the sort data so that nothing is allocated per frame
+                if (opaqueCount != 0)
+                {
+                    model.m_drawlistCount++;
+
+                    SortData sortData;
+                    sortData.flags = static_cast<std::int64_t>(distance * 1000000.f);
+                    sortData.materialStart = static_cast<std::uint32_t>(passList.materialIDs.size());
+                    sortData.materialCount = opaqueCount;
+
+                    for (auto i = 0u; i < model.m_meshData.submeshCount; ++i)
+                    {
+                        if (materials[i].blendMode == Material::BlendMode::None)
+                        {
+                            passList.materialIDs.push_back(static_cast<std::int32_t>(i));
+                        }
+                    }
+                    passList.renderables.emplace_back(entity, sortData);
                 }
 
-                if (!transparent.second.matIDs.empty())
+                if (transparentCount != 0)
                 {
                     model.m_drawlistCount++;
-#ifdef USE_PARALLEL_PROCESSING
-                    std::scoped_lock l(mutex);
-#endif
-                    drawList[p].renderables.push_back(transparent);
+
+                    SortData sortData;
+                    sortData.flags = static_cast<std::int64_t>(-distance * 1000000.f); //suitably large number to shift decimal point
+                    sortData.flags += 0x0FFF000000000000; //gaurentees embiggenment so that sorting places transparent last
+                    sortData.materialStart = static_cast<std::uint32_t>(passList.materialIDs.size());
+                    sortData.materialCount = transparentCount;
+
+                    for (auto i = 0u; i < model.m_meshData.submeshCount; ++i)
+                    {
+                        if (materials[i].blendMode != Material::BlendMode::None)
+                        {
+                            passList.materialIDs.push_back(static_cast<std::int32_t>(i));
+                        }
+                    }
+                    passList.renderables.emplace_back(entity, sortData);
                 }
             }
         }
@@ -1024,6 +1401,10 @@ void ModelRenderer::applyProperties(const Material::Data& material, const Model&
             glCheck(glUniformMatrix4fv(material.uniforms[Material::ReflectionMatrix], 1, GL_FALSE, &camera.getPass(Camera::Pass::Refraction).viewProjectionMatrix[0][0]));
         }
         break;
+        case Material::LightClusterGrid:
+            //bound by ModelRenderer::render()
+            glCheck(glUniform1i(material.uniforms[Material::LightClusterGrid], ClusterTextureUnit));
+            break;
         }
     }
 }
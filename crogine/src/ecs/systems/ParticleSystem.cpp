@@ -52,7 +52,7 @@ source distribution.
 #endif
 
 #ifdef USE_PARALLEL_PROCESSING
-#include <execution>
+#include <crogine/core/JobSystem.hpp>
 #include <mutex>
 #endif
 
@@ -387,7 +387,7 @@ void ParticleSystem::updateDrawList(Entity cameraEnt)
 #ifdef USE_PARALLEL_PROCESSING
     std::mutex mutex;
 
-    for_each(std::execution::par, entities.cbegin(), entities.cend(), 
+    JobSystem::forEach(entities.cbegin(), entities.cend(), 
         [&](Entity entity)
 #else
     for (auto entity : entities)
@@ -451,7 +451,7 @@ void ParticleSystem::process(float dt)
     const auto& entities = getEntities();
     const auto fallbackTextureID = m_fallbackTexture.getGLHandle();
 #ifdef USE_PARALLEL_PROCESSING
-    std::for_each(std::execution::par, entities.begin(), entities.end(), [&, dt, fallbackTextureID](Entity e)
+    JobSystem::forEach(entities.begin(), entities.end(), [&, dt, fallbackTextureID](Entity e)
 #else
     for (auto e : entities/*m_potentiallyVisible*/)
 #endif
@@ -858,11 +858,7 @@ void ParticleSystem::flushEntity(Entity e)
         {
             //if (!p.empty())
             {
-#ifdef USE_PARALLEL_PROCESSING
-                p.erase(std::remove_if(std::execution::par, p.begin(), p.end(),
-#else
                 p.erase(std::remove_if(p.begin(), p.end(),
-#endif
                     [e](Entity ent)
                     {
                         return e == ent;
@@ -31,6 +31,7 @@ source distribution.
 #include <crogine/ecs/components/Drawable2D.hpp>
 #include <crogine/ecs/components/Transform.hpp>
 #include <crogine/ecs/components/Camera.hpp>
+#include <crogine/graphics/GPUProfiler.hpp>
 #include <crogine/graphics/Texture.hpp>
 #include <crogine/graphics/RenderTarget.hpp>
 #include <crogine/util/Rectangle.hpp>
@@ -55,7 +56,7 @@ source distribution.
 
 #ifdef USE_PARALLEL_PROCESSING
 #include <mutex>
-#include <execution>
+#include <crogine/core/JobSystem.hpp>
 #endif
 
 namespace
@@ -125,7 +126,7 @@ void RenderSystem2D::updateDrawList(Entity camEnt)
 
 #ifdef USE_PARALLEL_PROCESSING
     std::mutex mutex;
-    std::for_each(std::execution::par, entities.cbegin(), entities.cend(), 
+    JobSystem::forEach(entities.cbegin(), entities.cend(), 
         [&](Entity entity)
 #else
     for (auto entity : entities)
@@ -173,11 +174,7 @@ void RenderSystem2D::updateDrawList(Entity camEnt)
 
     if (m_needsSort)
     {
-#ifdef USE_PARALLEL_PROCESSING
-        std::sort(std::execution::par, drawlist.begin(), drawlist.end(),
-#else
         std::sort(drawlist.begin(), drawlist.end(),
-#endif
             [](Entity a, Entity b)
             {
                 return a.getComponent<Drawable2D>().m_sortCriteria < b.getComponent<Drawable2D>().m_sortCriteria;
@@ -256,6 +253,8 @@ void RenderSystem2D::process(float)
 
 void RenderSystem2D::render(Entity cameraEntity, const RenderTarget& rt)
 {
+    CRO_GPU_SCOPE("RenderSystem2D");
+
     const auto& camComponent = cameraEntity.getComponent<Camera>();
     if (camComponent.getDrawListIndex() < m_drawLists.size())
     {
@@ -506,11 +505,7 @@ void RenderSystem2D::flushEntity(Entity e)
     {
         //if (!list.empty())
         {
-#ifdef USE_PARALLEL_PROCESSING
-            list.erase(std::remove_if(std::execution::par, list.begin(), list.end(),
-#else
             list.erase(std::remove_if(list.begin(), list.end(),
-#endif
                 [e](Entity ent)
                 {
                     return e == ent;
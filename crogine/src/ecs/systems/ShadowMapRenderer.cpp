@@ -36,8 +36,10 @@ source distribution.
 #include <crogine/ecs/components/Skeleton.hpp>
 #include <crogine/ecs/Scene.hpp>
 
+#include <crogine/graphics/GPUProfiler.hpp>
 #include <crogine/graphics/Spatial.hpp>
 #include <crogine/core/Clock.hpp>
+#include <crogine/core/FrameAllocator.hpp>
 #include <crogine/util/Frustum.hpp>
 
 #include "../../detail/GLCheck.hpp"
@@ -53,7 +55,7 @@ source distribution.
 #endif
 
 #ifdef USE_PARALLEL_PROCESSING
-#include <execution>
+#include <crogine/core/JobSystem.hpp>
 #include <mutex>
 #endif
 
@@ -212,6 +214,7 @@ void ShadowMapRenderer::process(float)
         }
         
         m_activeCameras.clear();
+        m_cascadeMasks.clear();
     }
 
     //check buffer resource for updated refs and remove any now at zero
@@ -346,18 +349,43 @@ void ShadowMapRenderer::updateDrawList(Entity camEnt)
 
 
         //store the results here to use in frustum culling
-        std::vector<glm::vec3> lightPositions;
-        std::vector<Box> frustums; //frustae
+        const auto cascadeCount = camera.getCascadeCount();
+        FrameVector<glm::vec3> lightPositions(cascadeCount);
+        FrameVector<Box> frustums(cascadeCount); //frustae
+        FrameVector<float> texelSizes(cascadeCount);
 #ifdef CRO_DEBUG_
-        camera.lightCorners.clear();
+        camera.lightCorners.resize(cascadeCount);
+        camera.lightPositions.resize(cascadeCount);
 #endif
 
+        //the nearest cascade is always updated, the rest are staggered
+        //over the camera's update interval unless everything needs refreshing
+        const bool updateAll = camera.m_shadowUpdateCount == 0 || camera.activatedThisFrame();
+        std::uint32_t cascadeMask = 0;
+        for (auto i = 0u; i < cascadeCount; ++i)
+        {
+            if (i == 0 || updateAll
+                || ((camera.m_shadowUpdateCount + i) % camera.m_cascadeInterval) == 0)
+            {
+                cascadeMask |= (1 << i);
+            }
+        }
+        camera.m_shadowUpdateCount++;
+        m_cascadeMasks.push_back(cascadeMask);
+
         const auto worldMat = camEnt.getComponent<cro::Transform>().getWorldTransform();
         auto corners = camera.getFrustumSplits(); //copy this as we'll transform it into world coords
         glm::vec3 lightDir = -getScene()->getSunlight().getComponent<Sunlight>().getDirection();
+        const auto mapSize = glm::vec2(camera.shadowMapBuffer.getSize());
 
         for (auto i = 0u; i < corners.size(); ++i)
         {
+            if ((cascadeMask & (1 << i)) == 0)
+            {
+                //keep the existing matrices so they still match the map contents
+                continue;
+            }
+
             glm::vec3 centre = glm::vec3(0.f);
 
             for (auto& c : corners[i])
@@ -369,7 +397,7 @@ void ShadowMapRenderer::updateDrawList(Entity camEnt)
 
             //position light source
             auto lightPos = centre + lightDir;
-            lightPositions.push_back(lightPos);
+            lightPositions[i] = lightPos;
 
             const auto lightView = glm::lookAt(lightPos, centre, cro::Transform::Y_AXIS);
             camera.m_shadowViewMatrices[i] = lightView;
@@ -389,13 +417,46 @@ void ShadowMapRenderer::updateDrawList(Entity camEnt)
                 maxPos.y = std::max(maxPos.y, p.y);
                 maxPos.z = std::max(maxPos.z, p.z);
             }
-            
-            //padding the X and Y allows some overlap of cascades
-            //even when the light is perfectly parallel
-            minPos.x -= CascadeOverlap;
-            minPos.y -= CascadeOverlap;
-            maxPos.x += CascadeOverlap;
-            maxPos.y += CascadeOverlap;
+
+            if (camera.m_stableShadows)
+            {
+                //fit a sphere around the split so that the size of the
+                //projection doesn't change as the camera rotates. Rounding
+                //the radius stops float error changing the size every frame
+                float radius = 0.f;
+                for (const auto& c : corners[i])
+                {
+                    radius = std::max(radius, glm::length(glm::vec3(c) - centre));
+                }
+                radius = (std::ceil(radius * 16.f) / 16.f) + CascadeOverlap;
+
+                //the light is 1 unit from the centre, so it sits on the z axis in light space
+                minPos.x = -radius;
+                minPos.y = -radius;
+                maxPos.x = radius;
+                maxPos.y = radius;
+
+                //then snap the projection to the texel grid, anchored to the
+                //world origin, so that the world doesn't move in shadow map space
+                const glm::vec2 texelSize = glm::vec2(radius * 2.f) / mapSize;
+                const glm::vec2 origin = glm::vec2(lightView[3]);
+                const glm::vec2 snapped = origin + (glm::floor((glm::vec2(minPos) - origin) / texelSize) * texelSize);
+
+                minPos.x = snapped.x;
+                minPos.y = snapped.y;
+                maxPos.x = snapped.x + (radius * 2.f);
+                maxPos.y = snapped.y + (radius * 2.f);
+            }
+            else
+            {
+                //padding the X and Y allows some overlap of cascades
+                //even when the light is perfectly parallel
+                minPos.x -= CascadeOverlap;
+                minPos.y -= CascadeOverlap;
+                maxPos.x += CascadeOverlap;
+                maxPos.y += CascadeOverlap;
+            }
+            texelSizes[i] = (maxPos.x - minPos.x) / mapSize.x;
 
             //skewing this means we end up with more depth resolution as we're nearer near plane
             //how much to skew is up for debate.
@@ -406,9 +467,10 @@ void ShadowMapRenderer::updateDrawList(Entity camEnt)
             camera.m_shadowProjectionMatrices[i] = lightProj;
             camera.m_shadowViewProjectionMatrices[i] = lightProj * lightView;
 
-            frustums.emplace_back(minPos, maxPos);
+            frustums[i] = Box(minPos, maxPos);
 #ifdef CRO_DEBUG_
-            camera.lightCorners.emplace_back() =
+            camera.lightPositions[i] = lightPos;
+            camera.lightCorners[i] =
             {
                 //near
                 glm::vec4(maxPos.x, maxPos.y, minPos.z, 1.f),
@@ -433,7 +495,7 @@ void ShadowMapRenderer::updateDrawList(Entity camEnt)
         //use depth frusta to cull entities
         auto& entities = getEntities();
 #ifdef USE_PARALLEL_PROCESSING
-        std::for_each(std::execution::par, entities.cbegin(), entities.cend(),
+        JobSystem::forEach(entities.cbegin(), entities.cend(),
             [&](Entity entity)
 #else
         for (auto entity : entities)
@@ -481,10 +543,16 @@ void ShadowMapRenderer::updateDrawList(Entity camEnt)
 
             sphere.radius *= ((scale.x + scale.y + scale.z) / 3.f);
 
-            std::vector<std::pair<std::size_t, std::size_t>> drawListOffsets;
-
-            for (auto i = 0u; i < camera.getCascadeCount(); ++i)
+            for (auto i = 0u; i < cascadeCount; ++i)
             {
+                //skip cascades which aren't being redrawn, and casters
+                //too small to cover a texel of this cascade
+                if ((cascadeMask & (1 << i)) == 0
+                    || (sphere.radius * 2.f) < texelSizes[i])
+                {
+                    continue;
+                }
+
                 float distance = glm::dot(-lightDir, sphere.centre - lightPositions[i]);
 
                 //put sphere into lightspace and do an AABB test on the ortho projection
@@ -511,15 +579,10 @@ void ShadowMapRenderer::updateDrawList(Entity camEnt)
 
         //sort back to front
 #ifdef USE_PARALLEL_PROCESSING
-        std::for_each(std::execution::par, drawList.begin(), drawList.end(),
+        JobSystem::forEach(drawList.begin(), drawList.end(),
             [&](std::vector<ShadowMapRenderer::Drawable>& cascade)
         {
-#ifdef _WIN32
-                std::sort(std::execution::par, cascade.begin(), cascade.end(),
-#else
-                //gcc complains about no appropriate ctor - not sure why it needs a ctor for parallel sorting??
-                std::sort(cascade.begin(), cascade.end(),
-#endif
+            std::sort(cascade.begin(), cascade.end(),
 #else
         for (auto& cascade : drawList)
         {
@@ -534,11 +597,6 @@ void ShadowMapRenderer::updateDrawList(Entity camEnt)
             );
 #endif
 
-#ifdef CRO_DEBUG_
-        //used for debug drawing of light positions
-        camera.lightPositions.swap(lightPositions);
-#endif
-
         //if (camera.activatedThisFrame())
         //{
         //    //do an immediate update on the map
@@ -550,6 +608,8 @@ void ShadowMapRenderer::updateDrawList(Entity camEnt)
 //private
 void ShadowMapRenderer::render()
 {
+    CRO_GPU_SCOPE("ShadowMapRenderer");
+
 #ifdef CRO_DEBUG_
     renderCount = 0;
 #endif
@@ -570,6 +630,12 @@ void ShadowMapRenderer::render()
 
         for (auto d = 0u; d < m_drawLists[c].size(); ++d)
         {
+            if ((m_cascadeMasks[c] & (1 << d)) == 0)
+            {
+                //not scheduled this frame - leave the existing contents
+                continue;
+            }
+
 #ifdef PLATFORM_DESKTOP
             shadowMapBuffer.clear(d);
 #else
@@ -690,9 +756,8 @@ void ShadowMapRenderer::render()
             shadowMapBuffer.display();
 
 
-            //if blur enabled
-            //for each requested cascade
-            for (auto i = 0u; i < camera.m_blurPasses && m_drawLists[c].size(); ++i)
+            //if blur enabled for this cascade
+            if (d < camera.m_blurPasses)
             {
                 //TODO we could optimise this a bit by setting up the OpenGL explicitly for
                 //the render quads - but only if this damages perf too much
@@ -713,7 +778,7 @@ void ShadowMapRenderer::render()
                 
                 //we need to select the layer in the shader
                 glUseProgram(m_blurShaderA.getGLHandle());
-                glUniform1f(cascadeUniform, i);
+                glUniform1f(cascadeUniform, static_cast<float>(d));
 
                 m_inputQuad.setTexture(shadowMapBuffer.getTexture(), passSize);
                 m_blurBuffer.clear();
@@ -721,7 +786,7 @@ void ShadowMapRenderer::render()
                 m_blurBuffer.display();
 
                 //render back to shadowmap
-                shadowMapBuffer.clear(i);
+                shadowMapBuffer.clear(d);
                 m_outputQuad.draw();
                 shadowMapBuffer.display();
             }
@@ -764,11 +829,7 @@ void ShadowMapRenderer::flushEntity(Entity e)
         {
             //if (!b.empty())
             {
-#ifdef USE_PARALLEL_PROCESSING
-                b.erase(std::remove_if(std::execution::par, b.begin(), b.end(),
-#else
                 b.erase(std::remove_if(b.begin(), b.end(),
-#endif
                     [e](const Drawable& d)
                     {
                         return d.entity == e;
@@ -28,6 +28,7 @@ source distribution.
 -----------------------------------------------------------------------*/
 
 #include <crogine/core/Clock.hpp>
+#include <crogine/core/FrameAllocator.hpp>
 #include <crogine/core/App.hpp>
 
 #include <crogine/gui/Gui.hpp>
@@ -48,7 +49,7 @@ source distribution.
 #endif
 
 #ifdef USE_PARALLEL_PROCESSING
-#include <execution>
+#include <crogine/core/JobSystem.hpp>
 #endif
 
 using namespace cro;
@@ -91,11 +92,9 @@ void SkeletalAnimator::process(float dt)
 
 
     const auto& entities = getEntities();
-    
-    //const auto policy = entities.size() > 5 ? std::execution::par : std::execution::seq;
 
 #ifdef USE_PARALLEL_PROCESSING
-    std::for_each(std::execution::par, entities.cbegin(), entities.cend(), 
+    JobSystem::forEach(entities.cbegin(), entities.cend(), 
         [&](cro::Entity entity)
 #else
     for (auto entity : entities)
@@ -330,7 +329,7 @@ void SkeletalAnimator::interpolateAnimation(SkeletalAnim& source, std::size_t ta
     //we mix all the joints first to prevent it happening multiple times
     //when we create the world transforms.
 
-    std::vector<glm::mat4> mixBuffer(skeleton.m_frameSize);
+    FrameVector<glm::mat4> mixBuffer(skeleton.m_frameSize);
     for (auto i = 0u; i < skeleton.m_frameSize; ++i)
     {
         mixBuffer[i] = mixJoint(skeleton.m_frames[startA + i], skeleton.m_frames[startB + i], time, source.interpolationOutput[i]);
@@ -360,7 +359,7 @@ void SkeletalAnimator::interpolateAnimation(SkeletalAnim& source, std::size_t ta
 void SkeletalAnimator::blendAnimations(const SkeletalAnim& a, const SkeletalAnim& b, float time, Skeleton& skeleton) const
 {
     Joint temp; //we need something to pass as a func param
-    std::vector<glm::mat4> mixBuffer(skeleton.m_frameSize);
+    FrameVector<glm::mat4> mixBuffer(skeleton.m_frameSize);
 
     for (auto i = 0u; i < skeleton.m_frameSize; ++i)
     {
@@ -385,7 +384,8 @@ void SkeletalAnimator::blendAnimations(const SkeletalAnim& a, const SkeletalAnim
 void SkeletalAnimator::updateBoundsFromCurrentFrame(Skeleton& dest, const Mesh::Data& source) const
 {
     //store these in case we want to update the bounds
-    std::vector<glm::vec3> positions;
+    FrameVector<glm::vec3> positions;
+    positions.reserve(dest.m_frameSize);
     for (auto i = 0u; i < dest.m_frameSize; ++i)
     {
         positions.push_back(glm::vec3(dest.m_currentFrame[i] * glm::inverse(dest.m_invBindPose[i]) * glm::vec4(0.f, 0.f, 0.f, 1.f)));
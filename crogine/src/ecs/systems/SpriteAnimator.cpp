@@ -41,7 +41,7 @@ source distribution.
 
 #ifdef USE_PARALLEL_PROCESSING
 #include <mutex>
-#include <execution>
+#include <crogine/core/JobSystem.hpp>
 #endif
 
 using namespace cro;
@@ -70,7 +70,7 @@ void SpriteAnimator::process(float dt)
 #ifdef USE_PARALLEL_PROCESSING
     std::mutex mutex;
 
-    std::for_each(std::execution::par, entities.cbegin(), entities.cend(),
+    JobSystem::forEach(entities.cbegin(), entities.cend(),
         [&, dt](Entity entity)
 #else
     for (auto entity : entities)
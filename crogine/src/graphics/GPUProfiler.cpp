@@ -0,0 +1,536 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include <crogine/graphics/GPUProfiler.hpp>
+#include <crogine/core/Log.hpp>
+#include <crogine/detail/Types.hpp>
+#include <crogine/gui/Gui.hpp>
+
+#include "../detail/GLCheck.hpp"
+
+#include <SDL_timer.h>
+
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+
+using namespace cro;
+
+namespace
+{
+    constexpr float UpdateRate = 0.5f;
+
+    struct PassEntry final
+    {
+        const char* name = nullptr;
+        std::uint64_t path = 0;
+        std::int32_t parent = -1;
+        std::uint32_t depth = 0;
+        std::uint64_t exclusive = 0; //ns
+        std::uint64_t inclusive = 0;
+    };
+
+    struct Segment final
+    {
+        std::uint32_t query = 0;
+        std::uint32_t pass = 0;
+    };
+
+    struct Frame final
+    {
+        std::vector<PassEntry> passes;
+        std::vector<Segment> segments;
+        std::uint64_t frameNumber = 0;
+    };
+
+    struct Accumulator final
+    {
+        const char* name = nullptr;
+        std::uint32_t depth = 0;
+        std::uint32_t order = 0;
+        std::uint64_t exclusive = 0;
+        std::uint64_t inclusive = 0;
+    };
+
+    struct ProfilerState final
+    {
+        std::array<Frame, GPUProfiler::FrameLatency> frames;
+        std::size_t currentFrame = 0;
+        std::uint64_t frameNumber = 0;
+
+        std::vector<std::uint32_t> freeQueries;
+        std::vector<std::uint32_t> passStack;
+
+        std::unordered_map<std::uint64_t, Accumulator> accumulators;
+        std::uint32_t accumulatedFrames = 0;
+        std::uint32_t droppedFrames = 0;
+        std::uint64_t lastUpdate = 0;
+        std::vector<GPUProfiler::Result> results;
+
+        bool summarising = false;
+        std::unordered_map<std::uint64_t, Accumulator> summary;
+        std::uint32_t summaryFrames = 0;
+
+        bool userEnabled = false;
+        bool windowVisible = false;
+        RaiiRWops csvFile;
+    }state;
+
+    void updateEnabled()
+    {
+        GPUProfiler::setEnabled(state.userEnabled || state.windowVisible || state.summarising || state.csvFile.file != nullptr);
+    }
+
+    void accumulate(std::unordered_map<std::uint64_t, Accumulator>& dst, const PassEntry& pass)
+    {
+        auto& acc = dst[pass.path];
+        if (acc.name == nullptr)
+        {
+            acc.name = pass.name;
+            acc.depth = pass.depth;
+            acc.order = static_cast<std::uint32_t>(dst.size());
+        }
+        acc.exclusive += pass.exclusive;
+        acc.inclusive += pass.inclusive;
+    }
+
+    std::vector<GPUProfiler::Result> getAverages(const std::unordered_map<std::uint64_t, Accumulator>& accumulators, std::uint32_t frameCount)
+    {
+        std::vector<const Accumulator*> sorted;
+        for (const auto& [_, acc] : accumulators)
+        {
+            sorted.push_back(&acc);
+        }
+        std::sort(sorted.begin(), sorted.end(),
+            [](const Accumulator* a, const Accumulator* b)
+            {
+                return a->order < b->order;
+            });
+
+        const double toMs = 1.0 / (1000000.0 * frameCount);
+
+        std::vector<GPUProfiler::Result> results;
+        for (const auto* acc : sorted)
+        {
+            auto& result = results.emplace_back();
+            result.name = acc->name;
+            result.depth = acc->depth;
+            result.inclusiveMs = static_cast<float>(acc->inclusive * toMs);
+            result.exclusiveMs = static_cast<float>(acc->exclusive * toMs);
+        }
+        return results;
+    }
+
+#ifdef PLATFORM_DESKTOP
+    std::uint32_t acquireQuery()
+    {
+        if (state.freeQueries.empty())
+        {
+            std::array<GLuint, 16u> queries = {};
+            glCheck(glGenQueries(static_cast<GLsizei>(queries.size()), queries.data()));
+            state.freeQueries.insert(state.freeQueries.end(), queries.begin(), queries.end());
+        }
+
+        auto q = state.freeQueries.back();
+        state.freeQueries.pop_back();
+        return q;
+    }
+
+    void beginSegment(std::uint32_t passIndex)
+    {
+        auto& frame = state.frames[state.currentFrame];
+        auto& segment = frame.segments.emplace_back();
+        segment.query = acquireQuery();
+        segment.pass = passIndex;
+
+        glCheck(glBeginQuery(GL_TIME_ELAPSED, segment.query));
+    }
+
+    //returns false if the results are not yet available
+    bool readFrame(Frame& frame)
+    {
+        if (frame.segments.empty())
+        {
+            return true;
+        }
+
+        GLint available = 0;
+        glCheck(glGetQueryObjectiv(frame.segments.back().query, GL_QUERY_RESULT_AVAILABLE, &available));
+        if (!available)
+        {
+            return false;
+        }
+
+        for (const auto& segment : frame.segments)
+        {
+            GLuint64 elapsed = 0;
+            glCheck(glGetQueryObjectui64v(segment.query, GL_QUERY_RESULT, &elapsed));
+            frame.passes[segment.pass].exclusive += elapsed;
+        }
+
+        //parents always precede their children so walk backwards
+        //to accumulate inclusive times up the hierarchy
+        for (auto& pass : frame.passes)
+        {
+            pass.inclusive = pass.exclusive;
+        }
+        for (auto i = static_cast<std::int32_t>(frame.passes.size()) - 1; i >= 0; --i)
+        {
+            const auto& pass = frame.passes[i];
+            if (pass.parent > -1)
+            {
+                frame.passes[pass.parent].inclusive += pass.inclusive;
+            }
+        }
+        return true;
+    }
+#endif
+
+    void recycleFrame(Frame& frame)
+    {
+        for (const auto& segment : frame.segments)
+        {
+            state.freeQueries.push_back(segment.query);
+        }
+        frame.segments.clear();
+        frame.passes.clear();
+    }
+
+    void logFrame(const Frame& frame)
+    {
+        if (state.csvFile.file)
+        {
+            std::string line;
+            for (const auto& pass : frame.passes)
+            {
+                line += std::to_string(frame.frameNumber) + "," + pass.name + "," + std::to_string(pass.depth) + ","
+                    + std::to_string(static_cast<double>(pass.inclusive) / 1000000.0) + ","
+                    + std::to_string(static_cast<double>(pass.exclusive) / 1000000.0) + "\n";
+            }
+            SDL_RWwrite(state.csvFile.file, line.data(), line.size(), 1);
+        }
+    }
+
+    void accumulateFrame(const Frame& frame)
+    {
+        for (const auto& pass : frame.passes)
+        {
+            accumulate(state.accumulators, pass);
+        }
+        state.accumulatedFrames++;
+
+        if (state.summarising)
+        {
+            for (const auto& pass : frame.passes)
+            {
+                accumulate(state.summary, pass);
+            }
+            state.summaryFrames++;
+        }
+    }
+
+    void updateResults()
+    {
+        const auto now = SDL_GetPerformanceCounter();
+        if (static_cast<float>(now - state.lastUpdate) / SDL_GetPerformanceFrequency() < UpdateRate
+            || state.accumulatedFrames == 0)
+        {
+            return;
+        }
+        state.lastUpdate = now;
+
+        state.results = getAverages(state.accumulators, state.accumulatedFrames);
+
+        state.accumulators.clear();
+        state.accumulatedFrames = 0;
+    }
+}
+
+bool GPUProfiler::m_enabled = false;
+
+void GPUProfiler::setEnabled(bool enabled)
+{
+    m_enabled = enabled && isAvailable();
+}
+
+void GPUProfiler::setUserEnabled(bool enabled)
+{
+    state.userEnabled = enabled;
+    updateEnabled();
+}
+
+bool GPUProfiler::isAvailable()
+{
+#ifdef PLATFORM_DESKTOP
+    return true;
+#else
+    return false;
+#endif
+}
+
+const std::vector<GPUProfiler::Result>& GPUProfiler::getResults()
+{
+    return state.results;
+}
+
+bool GPUProfiler::beginCSVLog(const std::string& path)
+{
+    endCSVLog();
+
+    if (!isAvailable())
+    {
+        LogW << "GPU timing is not available on this platform" << std::endl;
+        return false;
+    }
+
+    state.csvFile.file = SDL_RWFromFile(path.c_str(), "w");
+    if (!state.csvFile.file)
+    {
+        LogE << "Failed opening " << path << " for GPU timing log: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    static const std::string Header = "frame,pass,depth,inclusive_ms,exclusive_ms\n";
+    SDL_RWwrite(state.csvFile.file, Header.data(), Header.size(), 1);
+
+    LogI << "Logging GPU pass timings to " << path << std::endl;
+    updateEnabled();
+    return true;
+}
+
+void GPUProfiler::endCSVLog()
+{
+    state.csvFile.close();
+    updateEnabled();
+}
+
+bool GPUProfiler::isLogging()
+{
+    return state.csvFile.file != nullptr;
+}
+
+void GPUProfiler::beginSummary()
+{
+    state.summary.clear();
+    state.summaryFrames = 0;
+    state.summarising = true;
+
+    updateEnabled();
+}
+
+std::vector<GPUProfiler::Result> GPUProfiler::endSummary()
+{
+    std::vector<Result> retVal;
+    if (state.summarising
+        && state.summaryFrames != 0)
+    {
+        retVal = getAverages(state.summary, state.summaryFrames);
+    }
+
+    state.summarising = false;
+    state.summary.clear();
+    state.summaryFrames = 0;
+    updateEnabled();
+
+    return retVal;
+}
+
+void GPUProfiler::frameEnd()
+{
+#ifdef PLATFORM_DESKTOP
+    //shouldn't happen - but close any pass left open
+    if (!state.passStack.empty())
+    {
+        glCheck(glEndQuery(GL_TIME_ELAPSED));
+        state.passStack.clear();
+    }
+
+    const bool hasPasses = !state.frames[state.currentFrame].segments.empty();
+    state.frames[state.currentFrame].frameNumber = state.frameNumber++;
+    state.currentFrame = (state.currentFrame + 1) % FrameLatency;
+
+    //this is the oldest frame which we're about to reuse
+    auto& frame = state.frames[state.currentFrame];
+    if (!frame.segments.empty())
+    {
+        if (readFrame(frame))
+        {
+            logFrame(frame);
+            accumulateFrame(frame);
+        }
+        else
+        {
+            //rather than stall we drop the results and reuse the queries
+            state.droppedFrames++;
+        }
+    }
+    recycleFrame(frame);
+
+    if (hasPasses)
+    {
+        updateResults();
+    }
+#endif
+}
+
+void GPUProfiler::finalise()
+{
+    endCSVLog();
+    state.summarising = false;
+    setEnabled(false);
+
+#ifdef PLATFORM_DESKTOP
+    if (!state.passStack.empty())
+    {
+        glCheck(glEndQuery(GL_TIME_ELAPSED));
+        state.passStack.clear();
+    }
+
+    //return any in-flight queries to the free list so they're all deleted together
+    for (auto& frame : state.frames)
+    {
+        recycleFrame(frame);
+    }
+
+    if (!state.freeQueries.empty())
+    {
+        glCheck(glDeleteQueries(static_cast<GLsizei>(state.freeQueries.size()), state.freeQueries.data()));
+        state.freeQueries.clear();
+    }
+#endif
+}
+
+void GPUProfiler::drawWindow()
+{
+    if (!state.windowVisible)
+    {
+        return;
+    }
+
+    ImGui::SetNextWindowSize({ 420.f, 320.f }, ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("GPU Timing", &state.windowVisible))
+    {
+        if (!isAvailable())
+        {
+            ImGui::TextUnformatted("Timer queries are not available on this platform");
+        }
+        else
+        {
+            ImGui::Text("Results delayed by %zu frames, %u frames dropped", FrameLatency, state.droppedFrames);
+            if (isLogging())
+            {
+                ImGui::TextUnformatted("Logging to CSV");
+            }
+
+            static constexpr auto TableFlags = ImGuiTableFlags_BordersV | ImGuiTableFlags_BordersOuterH | ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg;
+            if (ImGui::BeginTable("##passes", 3, TableFlags))
+            {
+                ImGui::TableSetupColumn("Pass", ImGuiTableColumnFlags_NoHide);
+                ImGui::TableSetupColumn("total ms", ImGuiTableColumnFlags_WidthFixed, 70.f);
+                ImGui::TableSetupColumn("self ms", ImGuiTableColumnFlags_WidthFixed, 70.f);
+                ImGui::TableHeadersRow();
+
+                for (const auto& result : state.results)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Indent(static_cast<float>(result.depth) * 10.f);
+                    ImGui::TextUnformatted(result.name);
+                    ImGui::Unindent(static_cast<float>(result.depth) * 10.f);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%2.3f", result.inclusiveMs);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%2.3f", result.exclusiveMs);
+                }
+                ImGui::EndTable();
+            }
+        }
+    }
+    ImGui::End();
+
+    if (!state.windowVisible)
+    {
+        updateEnabled();
+    }
+}
+
+void GPUProfiler::setWindowVisible(bool visible)
+{
+    state.windowVisible = visible;
+    updateEnabled();
+}
+
+//pass
+void GPUProfiler::Pass::begin(const char* name)
+{
+#ifdef PLATFORM_DESKTOP
+    auto& frame = state.frames[state.currentFrame];
+
+    //only one TIME_ELAPSED query can be active at once
+    //so suspend the parent pass while this one is active
+    std::int32_t parent = -1;
+    std::uint64_t parentPath = 0;
+    if (!state.passStack.empty())
+    {
+        glCheck(glEndQuery(GL_TIME_ELAPSED));
+        parent = static_cast<std::int32_t>(state.passStack.back());
+        parentPath = frame.passes[parent].path;
+    }
+
+    const auto index = static_cast<std::uint32_t>(frame.passes.size());
+    auto& pass = frame.passes.emplace_back();
+    pass.name = name;
+    pass.parent = parent;
+    pass.depth = static_cast<std::uint32_t>(state.passStack.size());
+    pass.path = (parentPath ^ reinterpret_cast<std::uintptr_t>(name)) * 1099511628211ull;
+
+    state.passStack.push_back(index);
+    beginSegment(index);
+#endif
+}
+
+void GPUProfiler::Pass::end()
+{
+#ifdef PLATFORM_DESKTOP
+    if (state.passStack.empty())
+    {
+        //frameEnd() was called while this pass was active
+        return;
+    }
+
+    glCheck(glEndQuery(GL_TIME_ELAPSED));
+    state.passStack.pop_back();
+
+    //resume the parent
+    if (!state.passStack.empty())
+    {
+        beginSegment(state.passStack.back());
+    }
+#endif
+}
@@ -0,0 +1,366 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+#include <crogine/graphics/GPUReadback.hpp>
+#include <crogine/core/Log.hpp>
+#include <crogine/detail/Assert.hpp>
+
+#include "../detail/GLCheck.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+using namespace cro;
+
+namespace
+{
+    //buffers are kept for re-use so that regular readbacks
+    //such as a per-hole normal map don't reallocate every time
+    constexpr std::size_t MaxFreeBuffers = 8;
+
+    struct FormatInfo final
+    {
+        GLenum format = GL_RGBA;
+        GLenum type = GL_UNSIGNED_BYTE;
+        std::uint32_t pixelSize = 4;
+    };
+
+    FormatInfo getFormatInfo(GPUReadback::Format format)
+    {
+        switch (format)
+        {
+        default:
+        case GPUReadback::Format::RGBA8:
+            return { GL_RGBA, GL_UNSIGNED_BYTE, 4 };
+        case GPUReadback::Format::RGB8:
+            return { GL_RGB, GL_UNSIGNED_BYTE, 3 };
+        case GPUReadback::Format::RGBA32F:
+            return { GL_RGBA, GL_FLOAT, 4 * sizeof(float) };
+        case GPUReadback::Format::R32F:
+            return { GL_RED, GL_FLOAT, sizeof(float) };
+        }
+    }
+
+#ifdef PLATFORM_DESKTOP
+    struct PixelBuffer final
+    {
+        std::uint32_t handle = 0;
+        std::size_t size = 0;
+    };
+
+    struct Request final
+    {
+        GPUReadback::ID id = 0;
+        PixelBuffer buffer;
+        std::size_t dataSize = 0;
+        GLsync fence = nullptr;
+        std::uint64_t frame = 0;
+        GPUReadback::Callback callback;
+    };
+
+    struct ReadbackState final
+    {
+        std::vector<Request> requests;
+        std::vector<PixelBuffer> freeBuffers;
+        GPUReadback::ID nextID = 1;
+        std::uint64_t frameNumber = 0;
+    }state;
+
+    PixelBuffer acquireBuffer(std::size_t size)
+    {
+        //smallest free buffer large enough to hold the data
+        auto result = state.freeBuffers.end();
+        for (auto it = state.freeBuffers.begin(); it != state.freeBuffers.end(); ++it)
+        {
+            if (it->size >= size
+                && (result == state.freeBuffers.end() || it->size < result->size))
+            {
+                result = it;
+            }
+        }
+
+        if (result != state.freeBuffers.end())
+        {
+            auto buffer = *result;
+            state.freeBuffers.erase(result);
+            return buffer;
+        }
+
+        PixelBuffer buffer;
+        glCheck(glGenBuffers(1, &buffer.handle));
+        glCheck(glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.handle));
+        glCheck(glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ));
+        glCheck(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+        buffer.size = size;
+
+        return buffer;
+    }
+
+    void releaseBuffer(PixelBuffer buffer)
+    {
+        if (state.freeBuffers.size() == MaxFreeBuffers)
+        {
+            //prefer keeping the larger buffers
+            auto smallest = std::min_element(state.freeBuffers.begin(), state.freeBuffers.end(),
+                [](const PixelBuffer& a, const PixelBuffer& b) { return a.size < b.size; });
+
+            if (smallest->size > buffer.size)
+            {
+                glCheck(glDeleteBuffers(1, &buffer.handle));
+                return;
+            }
+            glCheck(glDeleteBuffers(1, &smallest->handle));
+            state.freeBuffers.erase(smallest);
+        }
+        state.freeBuffers.push_back(buffer);
+    }
+
+    void destroyRequest(Request& request)
+    {
+        glCheck(glDeleteSync(request.fence));
+        releaseBuffer(request.buffer);
+    }
+
+    void deliver(Request& request)
+    {
+        glCheck(glBindBuffer(GL_PIXEL_PACK_BUFFER, request.buffer.handle));
+        auto* data = static_cast<const std::byte*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, request.dataSize, GL_MAP_READ_BIT));
+
+        if (data)
+        {
+            request.callback(data, request.dataSize);
+            glCheck(glBindBuffer(GL_PIXEL_PACK_BUFFER, request.buffer.handle)); //in case the callback changed it
+            glCheck(glUnmapBuffer(GL_PIXEL_PACK_BUFFER));
+        }
+        else
+        {
+            LogE << "Failed to map GPU readback buffer" << std::endl;
+        }
+        glCheck(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+        destroyRequest(request);
+    }
+
+    template <typename ReadFunc>
+    GPUReadback::ID queueRequest(std::size_t dataSize, GPUReadback::Callback&& callback, const ReadFunc& readFunc)
+    {
+        if (dataSize == 0)
+        {
+            LogE << "GPU readback requested with zero size" << std::endl;
+            return 0;
+        }
+
+        Request request;
+        request.id = state.nextID++;
+        request.buffer = acquireBuffer(dataSize);
+        request.dataSize = dataSize;
+        request.frame = state.frameNumber;
+        request.callback = std::move(callback);
+
+        if (state.nextID == 0)
+        {
+            state.nextID = 1;
+        }
+
+        //with a pack buffer bound the read writes to the buffer
+        //at the given offset and returns without waiting for the GPU
+        glCheck(glBindBuffer(GL_PIXEL_PACK_BUFFER, request.buffer.handle));
+        glCheck(glPixelStorei(GL_PACK_ALIGNMENT, 1));
+        readFunc();
+        glCheck(glPixelStorei(GL_PACK_ALIGNMENT, 4));
+        glCheck(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+        request.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        state.requests.push_back(std::move(request));
+        return state.requests.back().id;
+    }
+
+    std::vector<Request>::iterator findRequest(GPUReadback::ID id)
+    {
+        return std::find_if(state.requests.begin(), state.requests.end(),
+            [id](const Request& r) { return r.id == id; });
+    }
+#endif
+}
+
+GPUReadback::ID GPUReadback::readTexture(std::uint32_t textureID, glm::uvec2 size, Format format, Callback callback)
+{
+    CRO_ASSERT(callback, "");
+    const auto info = getFormatInfo(format);
+    const std::size_t dataSize = std::size_t(size.x) * size.y * info.pixelSize;
+
+#ifdef PLATFORM_DESKTOP
+    return queueRequest(dataSize, std::move(callback), [&]()
+        {
+            glCheck(glBindTexture(GL_TEXTURE_2D, textureID));
+            glCheck(glGetTexImage(GL_TEXTURE_2D, 0, info.format, info.type, nullptr));
+            glCheck(glBindTexture(GL_TEXTURE_2D, 0));
+        });
+#else
+    //we don't have glGetTexImage on GLES
+    GLuint frameBuffer = 0;
+    glCheck(glGenFramebuffers(1, &frameBuffer));
+    if (frameBuffer)
+    {
+        GLint previousFrameBuffer;
+        glCheck(glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFrameBuffer));
+
+        glCheck(glBindFramebuffer(GL_FRAMEBUFFER, frameBuffer));
+        glCheck(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textureID, 0));
+        readFramebuffer({ 0, 0, size.x, size.y }, format, std::move(callback));
+        glCheck(glDeleteFramebuffers(1, &frameBuffer));
+
+        glCheck(glBindFramebuffer(GL_FRAMEBUFFER, previousFrameBuffer));
+    }
+    return 0;
+#endif
+}
+
+GPUReadback::ID GPUReadback::readFramebuffer(URect area, Format format, Callback callback)
+{
+    CRO_ASSERT(callback, "");
+    const auto info = getFormatInfo(format);
+    const std::size_t dataSize = std::size_t(area.width) * area.height * info.pixelSize;
+
+#ifdef PLATFORM_DESKTOP
+    return queueRequest(dataSize, std::move(callback), [&]()
+        {
+            glCheck(glReadPixels(area.left, area.bottom, area.width, area.height, info.format, info.type, nullptr));
+        });
+#else
+    std::vector<std::byte> buffer(dataSize);
+    glCheck(glPixelStorei(GL_PACK_ALIGNMENT, 1));
+    glCheck(glReadPixels(area.left, area.bottom, area.width, area.height, info.format, info.type, buffer.data()));
+    glCheck(glPixelStorei(GL_PACK_ALIGNMENT, 4));
+    callback(buffer.data(), buffer.size());
+    return 0;
+#endif
+}
+
+bool GPUReadback::isPending(ID id)
+{
+#ifdef PLATFORM_DESKTOP
+    return id != 0 && findRequest(id) != state.requests.end();
+#else
+    return false;
+#endif
+}
+
+void GPUReadback::complete(ID id)
+{
+#ifdef PLATFORM_DESKTOP
+    if (auto result = findRequest(id); result != state.requests.end())
+    {
+        //remove it first in case the callback queues another request
+        auto request = std::move(*result);
+        state.requests.erase(result);
+
+        glClientWaitSync(request.fence, GL_SYNC_FLUSH_COMMANDS_BIT, std::numeric_limits<GLuint64>::max());
+        deliver(request);
+    }
+#endif
+}
+
+void GPUReadback::cancel(ID id)
+{
+#ifdef PLATFORM_DESKTOP
+    if (auto result = findRequest(id); result != state.requests.end())
+    {
+        destroyRequest(*result);
+        state.requests.erase(result);
+    }
+#endif
+}
+
+std::size_t GPUReadback::getPendingCount()
+{
+#ifdef PLATFORM_DESKTOP
+    return state.requests.size();
+#else
+    return 0;
+#endif
+}
+
+void GPUReadback::frameEnd()
+{
+#ifdef PLATFORM_DESKTOP
+    state.frameNumber++;
+
+    if (state.requests.empty())
+    {
+        return;
+    }
+
+    //requests are always at least a frame old so the fence
+    //has a chance to be flushed along with the buffer swap
+    std::vector<Request> ready;
+    for (auto i = 0u; i < state.requests.size();)
+    {
+        auto& request = state.requests[i];
+        if (request.frame < state.frameNumber - 1)
+        {
+            auto result = glClientWaitSync(request.fence, 0, 0);
+            if (result == GL_ALREADY_SIGNALED
+                || result == GL_CONDITION_SATISFIED)
+            {
+                ready.push_back(std::move(request));
+                state.requests.erase(state.requests.begin() + i);
+                continue;
+            }
+        }
+        ++i;
+    }
+
+    //callbacks may queue new requests, so the list
+    //must be updated before any of them are executed
+    for (auto& request : ready)
+    {
+        deliver(request);
+    }
+#endif
+}
+
+void GPUReadback::finalise()
+{
+#ifdef PLATFORM_DESKTOP
+    for (auto& request : state.requests)
+    {
+        glCheck(glDeleteSync(request.fence));
+        glCheck(glDeleteBuffers(1, &request.buffer.handle));
+    }
+    state.requests.clear();
+
+    for (auto& buffer : state.freeBuffers)
+    {
+        glCheck(glDeleteBuffers(1, &buffer.handle));
+    }
+    state.freeBuffers.clear();
+#endif
+}
@@ -387,6 +387,11 @@ void Data::setShader(const Shader& s)
             uniforms[Material::SkyBox] = handle.first;
             optionalUniforms[optionalUniformCount++] = Material::SkyBox;
         }
+        else if (uniform == "u_lightClusterGrid")
+        {
+            uniforms[Material::LightClusterGrid] = handle.first;
+            optionalUniforms[optionalUniformCount++] = Material::LightClusterGrid;
+        }
         //else these are user settable uniforms - ie optional, but set by user such as textures
         else
         {
@@ -409,6 +414,7 @@ void Data::setShader(const Shader& s)
     //blocks available if the shader supposrts it
     m_hasCameraUBO = (glGetUniformBlockIndex(shader, "CameraUniforms") != GL_INVALID_INDEX);
     m_hasLightUBO = (glGetUniformBlockIndex(shader, "LightUniforms") != GL_INVALID_INDEX);
+    m_hasClusterUBO = (glGetUniformBlockIndex(shader, "ClusterUniforms") != GL_INVALID_INDEX);
 }
 
 //private
@@ -0,0 +1,287 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include <crogine/graphics/OcclusionBuffer.hpp>
+#include <crogine/core/Profiler.hpp>
+#include <crogine/detail/Assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace cro;
+
+namespace
+{
+    constexpr float NoOccluder = std::numeric_limits<float>::max();
+
+    //twice the signed area of the triangle abp, positive if counter-clockwise
+    float edge(glm::vec2 a, glm::vec2 b, glm::vec2 p)
+    {
+        return ((b.x - a.x) * (p.y - a.y)) - ((b.y - a.y) * (p.x - a.x));
+    }
+}
+
+OcclusionBuffer::OcclusionBuffer(glm::uvec2 size)
+    : m_size        (size),
+    m_enabled       (true),
+    m_dirty         (true),
+    m_viewProjection(1.f)
+{
+    CRO_ASSERT(size.x > 0 && size.y > 0, "");
+
+    //each level is half the size of the previous, down to a single texel
+    do
+    {
+        auto& level = m_levels.emplace_back();
+        level.size = size;
+        level.depth.resize(size.x * size.y, NoOccluder);
+
+        size = glm::max(glm::uvec2(1u), (size + 1u) / 2u);
+    } while (m_levels.back().size.x > 1 || m_levels.back().size.y > 1);
+}
+
+//public
+void OcclusionBuffer::setOccluders(std::vector<glm::vec3> vertices, std::vector<std::uint32_t> indices)
+{
+    CRO_ASSERT(indices.size() % 3 == 0, "indices must be triangles");
+
+    m_vertices.swap(vertices);
+    m_indices.swap(indices);
+    m_dirty = true;
+}
+
+void OcclusionBuffer::clearOccluders()
+{
+    m_vertices.clear();
+    m_indices.clear();
+    m_dirty = true;
+}
+
+void OcclusionBuffer::update(const glm::mat4& viewProjection)
+{
+    if (!m_dirty
+        && viewProjection == m_viewProjection)
+    {
+        return;
+    }
+
+    CRO_PROFILE_SCOPE("OcclusionBuffer::update");
+
+    m_viewProjection = viewProjection;
+    m_dirty = false;
+
+    rasterise();
+    buildPyramid();
+}
+
+bool OcclusionBuffer::isVisible(const Box& box, const glm::mat4& worldTransform) const
+{
+    if (!m_enabled
+        || m_indices.empty())
+    {
+        return true;
+    }
+
+    const auto transform = m_viewProjection * worldTransform;
+
+    glm::vec2 minPos(std::numeric_limits<float>::max());
+    glm::vec2 maxPos(std::numeric_limits<float>::lowest());
+    float nearest = std::numeric_limits<float>::max();
+
+    for (auto i = 0; i < 8; ++i)
+    {
+        const glm::vec3 corner((i & 1) ? box[1].x : box[0].x,
+                                (i & 2) ? box[1].y : box[0].y,
+                                (i & 4) ? box[1].z : box[0].z);
+
+        auto pos = transform * glm::vec4(corner, 1.f);
+        if (pos.w <= 0.f)
+        {
+            //crosses the camera plane so we can't tell
+            return true;
+        }
+
+        pos /= pos.w;
+        if (pos.z < -1.f)
+        {
+            return true;
+        }
+
+        minPos = glm::min(minPos, glm::vec2(pos));
+        maxPos = glm::max(maxPos, glm::vec2(pos));
+        nearest = std::min(nearest, pos.z);
+    }
+
+    const glm::vec2 size(m_size);
+    minPos = ((minPos * 0.5f) + 0.5f) * size;
+    maxPos = ((maxPos * 0.5f) + 0.5f) * size;
+
+    if (maxPos.x < 0.f || maxPos.y < 0.f
+        || minPos.x >= size.x || minPos.y >= size.y)
+    {
+        //off screen boxes are left to the frustum test
+        return true;
+    }
+
+    const auto x0 = static_cast<std::uint32_t>(std::max(0.f, std::floor(minPos.x)));
+    const auto y0 = static_cast<std::uint32_t>(std::max(0.f, std::floor(minPos.y)));
+    const auto x1 = std::min(m_size.x - 1, static_cast<std::uint32_t>(std::floor(maxPos.x)));
+    const auto y1 = std::min(m_size.y - 1, static_cast<std::uint32_t>(std::floor(maxPos.y)));
+
+    //use the most detailed level at which the box covers no more than 8x8 texels
+    std::size_t l = 0;
+    while (l < m_levels.size() - 1
+        && (((x1 >> l) - (x0 >> l)) > 7 || ((y1 >> l) - (y0 >> l)) > 7))
+    {
+        l++;
+    }
+
+    const auto& level = m_levels[l];
+    for (auto y = y0 >> l; y <= (y1 >> l); ++y)
+    {
+        for (auto x = x0 >> l; x <= (x1 >> l); ++x)
+        {
+            if (level.depth[y * level.size.x + x] >= nearest)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+//private
+void OcclusionBuffer::rasterise()
+{
+    auto& depth = m_levels[0].depth;
+    std::fill(depth.begin(), depth.end(), NoOccluder);
+
+    if (m_indices.empty())
+    {
+        return;
+    }
+
+    const glm::vec2 size(m_size);
+    m_projected.resize(m_vertices.size());
+    for (auto i = 0u; i < m_vertices.size(); ++i)
+    {
+        auto pos = m_viewProjection * glm::vec4(m_vertices[i], 1.f);
+        if (pos.w > 0.f)
+        {
+            pos /= pos.w;
+
+            //anything in front of the near plane is clipped
+            m_projected[i] = pos.z < -1.f ? glm::vec4(0.f) : glm::vec4(((glm::vec2(pos) * 0.5f) + 0.5f) * size, pos.z, 1.f);
+        }
+        else
+        {
+            m_projected[i] = glm::vec4(0.f);
+        }
+    }
+
+    for (auto i = 0u; i < m_indices.size(); i += 3)
+    {
+        auto a = m_projected[m_indices[i]];
+        auto b = m_projected[m_indices[i + 1]];
+        auto c = m_projected[m_indices[i + 2]];
+
+        //clipping is skipped, the triangle just isn't drawn
+        if (a.w == 0 || b.w == 0 || c.w == 0)
+        {
+            continue;
+        }
+
+        auto area = edge(glm::vec2(a), glm::vec2(b), glm::vec2(c));
+        if (std::abs(area) < 0.0001f)
+        {
+            continue;
+        }
+
+        //occluders may face either way
+        if (area < 0)
+        {
+            std::swap(b, c);
+        }
+
+        const auto minX = std::max(0.f, std::floor(std::min({ a.x, b.x, c.x })));
+        const auto minY = std::max(0.f, std::floor(std::min({ a.y, b.y, c.y })));
+        const auto maxX = std::min(size.x - 1.f, std::ceil(std::max({ a.x, b.x, c.x })));
+        const auto maxY = std::min(size.y - 1.f, std::ceil(std::max({ a.y, b.y, c.y })));
+
+        if (minX > maxX || minY > maxY)
+        {
+            continue;
+        }
+
+        //the furthest point is used for the whole triangle
+        const float triDepth = std::max({ a.z, b.z, c.z });
+        const glm::vec2 pa(a), pb(b), pc(c);
+
+        for (auto y = static_cast<std::uint32_t>(minY); y <= static_cast<std::uint32_t>(maxY); ++y)
+        {
+            for (auto x = static_cast<std::uint32_t>(minX); x <= static_cast<std::uint32_t>(maxX); ++x)
+            {
+                const glm::vec2 p(x + 0.5f, y + 0.5f);
+                if (edge(pb, pc, p) >= 0
+                    && edge(pc, pa, p) >= 0
+                    && edge(pa, pb, p) >= 0)
+                {
+                    auto& d = depth[y * m_size.x + x];
+                    d = std::min(d, triDepth);
+                }
+            }
+        }
+    }
+}
+
+void OcclusionBuffer::buildPyramid()
+{
+    for (auto i = 1u; i < m_levels.size(); ++i)
+    {
+        const auto& src = m_levels[i - 1];
+        auto& dst = m_levels[i];
+
+        for (auto y = 0u; y < dst.size.y; ++y)
+        {
+            const auto y0 = y * 2;
+            const auto y1 = std::min(y0 + 1, src.size.y - 1);
+
+            for (auto x = 0u; x < dst.size.x; ++x)
+            {
+                const auto x0 = x * 2;
+                const auto x1 = std::min(x0 + 1, src.size.x - 1);
+
+                dst.depth[y * dst.size.x + x] = std::max({ src.depth[y0 * src.size.x + x0], src.depth[y0 * src.size.x + x1],
+                                                            src.depth[y1 * src.size.x + x0], src.depth[y1 * src.size.x + x1] });
+            }
+        }
+    }
+}
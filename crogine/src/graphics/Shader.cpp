@@ -35,6 +35,8 @@ source distribution.
 
 #include "../detail/GLCheck.hpp"
 
+#include <SDL_video.h>
+
 #include <vector>
 #include <cstring>
 
@@ -77,6 +79,13 @@ namespace
 
     std::string vendorDef;
     std::string vendorInfo;
+
+    //GL_KHR_parallel_shader_compile isn't part of the loader
+    //so the enums and entry point are looked up at runtime
+    constexpr GLenum GL_MAX_SHADER_COMPILER_THREADS_KHR = 0x91B0;
+    constexpr GLenum GL_COMPLETION_STATUS_KHR = 0x91B1;
+    using MaxCompilerThreadsFunc = void(APIENTRYP)(GLuint);
+    bool parallelCompile = false;
 }
 
 Shader::Shader()
@@ -109,6 +118,29 @@ Shader::Shader()
             vendorDef = "#define GPU_UNKNOWN\n";
         }
         LOG("Shader " + vendorDef, Logger::Type::Info);
+
+#ifdef PLATFORM_DESKTOP
+        MaxCompilerThreadsFunc maxThreads = nullptr;
+        if (SDL_GL_ExtensionSupported("GL_KHR_parallel_shader_compile"))
+        {
+            maxThreads = reinterpret_cast<MaxCompilerThreadsFunc>(SDL_GL_GetProcAddress("glMaxShaderCompilerThreadsKHR"));
+        }
+        else if (SDL_GL_ExtensionSupported("GL_ARB_parallel_shader_compile"))
+        {
+            maxThreads = reinterpret_cast<MaxCompilerThreadsFunc>(SDL_GL_GetProcAddress("glMaxShaderCompilerThreadsARB"));
+        }
+
+        if (maxThreads)
+        {
+            //let the driver decide how many threads to use
+            maxThreads(0xFFFFFFFF);
+            parallelCompile = true;
+
+            GLint threadCount = 0;
+            glCheck(glGetIntegerv(GL_MAX_SHADER_COMPILER_THREADS_KHR, &threadCount));
+            LogI << "Parallel shader compilation enabled, max threads: " << threadCount << std::endl;
+        }
+#endif
     }
 
     resetAttribMap();
@@ -117,10 +149,12 @@ Shader::Shader()
 Shader::Shader(Shader&& other) noexcept
 {
     m_handle = other.m_handle;
+    m_pending = other.m_pending;
     m_attribMap = other.m_attribMap;
     m_uniformMap = other.m_uniformMap;
 
     other.m_handle = 0;
+    other.m_pending = {};
     other.m_attribMap = {};
     other.m_uniformMap.clear();
 }
@@ -131,14 +165,17 @@ Shader& Shader::operator=(Shader&& other) noexcept
     {
         Shader temp;
         std::swap(m_handle, temp.m_handle);
+        std::swap(m_pending, temp.m_pending);
         std::swap(m_attribMap, temp.m_attribMap);
         std::swap(m_uniformMap, temp.m_uniformMap);
 
         m_handle = other.m_handle;
+        m_pending = other.m_pending;
         m_attribMap = other.m_attribMap;
         m_uniformMap = other.m_uniformMap;
 
         other.m_handle = 0;
+        other.m_pending = {};
         other.m_attribMap = {};
         other.m_uniformMap.clear();
     }
@@ -152,6 +189,7 @@ Shader::~Shader()
     {
         glCheck(glDeleteProgram(m_handle));
     }
+    deletePending();
 }
 
 //public
@@ -212,6 +250,86 @@ bool Shader::loadFromString(const std::string& vertex, const std::string& geomet
     return loadFromSource(vertex.c_str(), geometry.c_str(), fragment.c_str(), defines.c_str());
 }
 
+bool Shader::beginLoadFromString(const std::string& vertex, const std::string& fragment, const std::string& defines)
+{
+    return issueSource(vertex.c_str(), nullptr, fragment.c_str(), defines.c_str());
+}
+
+bool Shader::beginLoadFromString(const std::string& vertex, const std::string& geometry, const std::string& fragment, const std::string& defines)
+{
+    return issueSource(vertex.c_str(), geometry.c_str(), fragment.c_str(), defines.c_str());
+}
+
+bool Shader::isLoadComplete() const
+{
+    if (m_pending.program == 0
+        || !parallelCompile)
+    {
+        return true;
+    }
+
+    GLint result = GL_FALSE;
+    glCheck(glGetProgramiv(m_pending.program, GL_COMPLETION_STATUS_KHR, &result));
+    return result == GL_TRUE;
+}
+
+bool Shader::finishLoad()
+{
+    if (m_pending.program == 0)
+    {
+        return m_handle != 0;
+    }
+
+    //these block until the driver has finished compiling
+    if (!checkCompileStatus(m_pending.vertID, "vertex")
+        || (m_pending.geomID && !checkCompileStatus(m_pending.geomID, "geometry"))
+        || !checkCompileStatus(m_pending.fragID, "fragment"))
+    {
+        deletePending();
+        return false;
+    }
+
+    GLint result = GL_FALSE;
+    int resultLength = 0;
+    glCheck(glGetProgramiv(m_pending.program, GL_LINK_STATUS, &result));
+    glCheck(glGetProgramiv(m_pending.program, GL_INFO_LOG_LENGTH, &resultLength));
+    if (result == GL_FALSE)
+    {
+        std::string str;
+        str.resize(resultLength + 1);
+        glCheck(glGetProgramInfoLog(m_pending.program, resultLength, nullptr, &str[0]));
+        Logger::log(vendorInfo, Logger::Type::Error, Logger::Output::All);
+        Logger::log("Failed to link shader program: " + std::to_string(result) + ", " + str, Logger::Type::Error, Logger::Output::All);
+
+        deletePending();
+        return false;
+    }
+
+    //tidy
+    glCheck(glDetachShader(m_pending.program, m_pending.vertID));
+    if (m_pending.geomID)
+    {
+        glCheck(glDetachShader(m_pending.program, m_pending.geomID));
+    }
+    glCheck(glDetachShader(m_pending.program, m_pending.fragID));
+
+    m_handle = m_pending.program;
+    m_pending.program = 0;
+    deletePending();
+
+    //grab attributes
+    if (!fillAttribMap())
+    {
+        glCheck(glDeleteProgram(m_handle));
+        m_handle = 0;
+        return false;
+    }
+
+    fillUniformMap();
+
+    return true;
+}
+
 std::uint32_t Shader::getGLHandle() const
 {
     return m_handle;
@@ -250,6 +368,15 @@ std::uint32_t Shader::getUniformType(const std::string& name) const
 
 //private
 bool Shader::loadFromSource(const char* vertex, const char* geometry, const char* fragment, const char* defines)
+{
+    if (!issueSource(vertex, geometry, fragment, defines))
+    {
+        return false;
+    }
+    return finishLoad();
+}
+
+bool Shader::issueSource(const char* vertex, const char* geometry, const char* fragment, const char* defines)
 {
     if (m_handle)
     {
@@ -259,176 +386,102 @@ bool Shader::loadFromSource(const char* vertex, const char* geometry, const char
         resetAttribMap();
         resetUniformMap();
     }
-
-    //compile vert shader
-    GLuint vertID = glCreateShader(GL_VERTEX_SHADER);
+    deletePending();
 
 #ifdef __ANDROID__
     std::string version = "#version 100\n#define MOBILE\n" + vendorDef;
-    const char* src[] = { version.c_str(), precision.c_str(), defines, vertex};
+    const char* src[] = { version.c_str(), precision.c_str(), defines ? defines : "", vertex};
 #else
 #if defined GL41 || defined __APPLE__
     std::string version = "#version 410 core\n" + vendorDef;
 #else
     std::string version = "#version 460 core\n" + vendorDef;
 #endif // GL41
-    const char* src[] = { version.c_str(), precision.c_str(), defines, vertex};
+    const char* src[] = { version.c_str(), precision.c_str(), defines ? defines : "", vertex};
 #endif //__ANDROID__
 
-    glCheck(glShaderSource(vertID, 4, src, nullptr));
-    glCheck(glCompileShader(vertID));
+    //compile and link without querying the results, so that
+    //the driver is free to do the work on its own threads
+    m_pending.vertID = glCreateShader(GL_VERTEX_SHADER);
+    glCheck(glShaderSource(m_pending.vertID, 4, src, nullptr));
+    glCheck(glCompileShader(m_pending.vertID));
 
-    GLint result = GL_FALSE;
-    int resultLength = 0;
-
-    glCheck(glGetShaderiv(vertID, GL_COMPILE_STATUS, &result));
-    glCheck(glGetShaderiv(vertID, GL_INFO_LOG_LENGTH, &resultLength));
-    if (result == GL_FALSE)
-    {
-        //failed compilation
-        std::string str;
-        str.resize(resultLength + 1);
-        glCheck(glGetShaderInfoLog(vertID, resultLength, nullptr, &str[0]));
-        Logger::log(vendorInfo, Logger::Type::Error, Logger::Output::All);
-        Logger::log("Failed compiling vertex shader: " + std::to_string(result) + ", " + str, Logger::Type::Error, Logger::Output::All);
-
-        glCheck(glDeleteShader(vertID));
-        return false;
-    }
-
-    GLuint geomID = 0;
 #ifdef PLATFORM_DESKTOP
-    //compile geom shader if not nullptr
     if (geometry != nullptr)
     {
-        geomID = glCreateShader(GL_GEOMETRY_SHADER);
+        m_pending.geomID = glCreateShader(GL_GEOMETRY_SHADER);
         src[3] = geometry;
-        glCheck(glShaderSource(geomID, 4, src, nullptr));
-        glCheck(glCompileShader(geomID));
-
-        result = GL_FALSE;
-        resultLength = 0;
+        glCheck(glShaderSource(m_pending.geomID, 4, src, nullptr));
+        glCheck(glCompileShader(m_pending.geomID));
+    }
+#endif
 
-        glCheck(glGetShaderiv(geomID, GL_COMPILE_STATUS, &result));
-        glCheck(glGetShaderiv(geomID, GL_INFO_LOG_LENGTH, &resultLength));
-        if (result == GL_FALSE)
-        {
-            std::string str;
-            str.resize(resultLength + 1);
-            glCheck(glGetShaderInfoLog(geomID, resultLength, nullptr, &str[0]));
-            Logger::log(vendorInfo, Logger::Type::Error);
-            Logger::log("Failed compiling geometry shader: " + std::to_string(result) + ", " + str, Logger::Type::Error);
+    m_pending.fragID = glCreateShader(GL_FRAGMENT_SHADER);
+    src[3] = fragment;
+    glCheck(glShaderSource(m_pending.fragID, 4, src, nullptr));
+    glCheck(glCompileShader(m_pending.fragID));
 
-            glCheck(glDeleteShader(vertID));
-            glCheck(glDeleteShader(geomID));
+    m_pending.program = glCreateProgram();
+    if (m_pending.program == 0)
+    {
+        deletePending();
+        return false;
+    }
 
-            return false;
-        }
+    glCheck(glAttachShader(m_pending.program, m_pending.vertID));
+    if (m_pending.geomID)
+    {
+        glCheck(glAttachShader(m_pending.program, m_pending.geomID));
     }
-#endif
+    glCheck(glAttachShader(m_pending.program, m_pending.fragID));
+    glCheck(glLinkProgram(m_pending.program));
 
-    //compile frag shader
-    GLuint fragID = glCreateShader(GL_FRAGMENT_SHADER);
-    src[3] = fragment;
-    glCheck(glShaderSource(fragID, 4, src, nullptr));
-    glCheck(glCompileShader(fragID));
+    return true;
+}
 
-    result = GL_FALSE;
-    resultLength = 0;
+bool Shader::checkCompileStatus(std::uint32_t shaderID, const std::string& type) const
+{
+    GLint result = GL_FALSE;
+    int resultLength = 0;
 
-    glCheck(glGetShaderiv(fragID, GL_COMPILE_STATUS, &result));
-    glCheck(glGetShaderiv(fragID, GL_INFO_LOG_LENGTH, &resultLength));
+    glCheck(glGetShaderiv(shaderID, GL_COMPILE_STATUS, &result));
+    glCheck(glGetShaderiv(shaderID, GL_INFO_LOG_LENGTH, &resultLength));
     if (result == GL_FALSE)
     {
+        //failed compilation
         std::string str;
         str.resize(resultLength + 1);
-        glCheck(glGetShaderInfoLog(fragID, resultLength, nullptr, &str[0]));
+        glCheck(glGetShaderInfoLog(shaderID, resultLength, nullptr, &str[0]));
         Logger::log(vendorInfo, Logger::Type::Error, Logger::Output::All);
-        Logger::log("Failed compiling fragment shader: " + std::to_string(result) + ", " + str, Logger::Type::Error, Logger::Output::All);
-
-        glCheck(glDeleteShader(vertID));
-        glCheck(glDeleteShader(fragID));
-
-        if (geomID)
-        {
-            glCheck(glDeleteShader(geomID));
-        }
+        Logger::log("Failed compiling " + type + " shader: " + std::to_string(result) + ", " + str, Logger::Type::Error, Logger::Output::All);
         return false;
     }
+    return true;
+}
 
-    //link shaders to program
-    m_handle = glCreateProgram();
-    if (m_handle)
+void Shader::deletePending()
+{
+    if (m_pending.program)
     {
-        glCheck(glAttachShader(m_handle, vertID));
-        if (geomID)
-        {
-            glCheck(glAttachShader(m_handle, geomID));
-        }
-        glCheck(glAttachShader(m_handle, fragID));
-        glCheck(glLinkProgram(m_handle));
-
-        result = GL_FALSE;
-        resultLength = 0;
-        glCheck(glGetProgramiv(m_handle, GL_LINK_STATUS, &result));
-        glCheck(glGetProgramiv(m_handle, GL_INFO_LOG_LENGTH, &resultLength));
-        if (result == GL_FALSE)
-        {
-            std::string str;
-            str.resize(resultLength + 1);
-            glCheck(glGetProgramInfoLog(m_handle, resultLength, nullptr, &str[0]));
-            Logger::log(vendorInfo, Logger::Type::Error, Logger::Output::All);
-            Logger::log("Failed to link shader program: " + std::to_string(result) + ", " + str, Logger::Type::Error, Logger::Output::All);
-
-            glCheck(glDetachShader(m_handle, vertID));
-            if (geomID)
-            {
-                glCheck(glDetachShader(m_handle, geomID));
-            }
-            glCheck(glDetachShader(m_handle, fragID));
-
-            glCheck(glDeleteShader(vertID));
-            if (geomID)
-            {
-                glCheck(glDeleteShader(geomID));
-            }
-            glCheck(glDeleteShader(fragID));
-            glCheck(glDeleteProgram(m_handle));
-            m_handle = 0;
-            return false;
-        }
-        else
-        {
-            //tidy
-            glCheck(glDetachShader(m_handle, vertID));
-            if (geomID)
-            {
-                glCheck(glDetachShader(m_handle, geomID));
-            }
-            glCheck(glDetachShader(m_handle, fragID));
-
-            glCheck(glDeleteShader(vertID));
-            if (geomID)
-            {
-                glCheck(glDeleteShader(geomID));
-            }
-            glCheck(glDeleteShader(fragID));
+        glCheck(glDeleteProgram(m_pending.program));
+    }
 
-            //grab attributes
-            if (!fillAttribMap())
-            {
-                glCheck(glDeleteProgram(m_handle));
-                m_handle = 0;
-                return false;
-            }
+    if (m_pending.vertID)
+    {
+        glCheck(glDeleteShader(m_pending.vertID));
+    }
 
-            fillUniformMap();
+    if (m_pending.geomID)
+    {
+        glCheck(glDeleteShader(m_pending.geomID));
+    }
 
-            return true;
-        }
+    if (m_pending.fragID)
+    {
+        glCheck(glDeleteShader(m_pending.fragID));
     }
 
-    return false;
+    m_pending = {};
 }
 
 bool Shader::fillAttribMap()
@@ -497,6 +550,10 @@ bool Shader::fillAttribMap()
                 {
                     m_attribMap[AttributeID::InstanceNormal] = attribLocation;
                 }
+                else if (name == "a_instanceData")
+                {
+                    m_attribMap[AttributeID::InstanceData] = attribLocation;
+                }
                 else
                 {
                     if (name.find("gl_") != 0)
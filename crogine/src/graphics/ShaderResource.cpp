@@ -28,6 +28,7 @@ source distribution.
 -----------------------------------------------------------------------*/
 
 #include <crogine/graphics/ShaderResource.hpp>
+#include <crogine/core/ConfigFile.hpp>
 
 #include "shaders/Default.hpp"
 #include "shaders/Unlit.hpp"
@@ -41,6 +42,8 @@ source distribution.
 #endif
 #include "../detail/GLCheck.hpp"
 
+#include <algorithm>
+
 using namespace cro;
 
 namespace
@@ -60,6 +63,7 @@ ShaderResource::ShaderResource()
     addInclude("WVP_UNIFORMS", WVPMatrices.c_str());
     addInclude("CAMERA_UBO", CameraUBO.c_str());
     addInclude("LIGHT_UBO", LightUBO.c_str());
+    addInclude("CLUSTERED_LIGHTS", ClusteredLights.c_str());
 
     addInclude("INSTANCE_ATTRIBS", InstanceAttribs.c_str());
     addInclude("INSTANCE_MATRICES", InstanceMatrices.c_str());
@@ -105,23 +109,22 @@ bool ShaderResource::loadFromString(std::int32_t ID, const std::string& vertex,
     }
 
     auto pair = std::make_pair(ID, Shader());
-    if (!m_includes.empty())
-    {
-        auto v = parseIncludes(vertex);
-        auto f = parseIncludes(fragment);
+    const auto& v = m_includes.empty() ? vertex : parseIncludes(vertex);
+    const auto& f = m_includes.empty() ? fragment : parseIncludes(fragment);
 
-        if (!pair.second.loadFromString(v, f, defines))
+    if (m_batchActive)
+    {
+        //finished when either get() or endBatch() is called
+        if (!pair.second.beginLoadFromString(v, f, defines))
         {
             return false;
         }
     }
-    else
+    else if (!pair.second.loadFromString(v, f, defines))
     {
-        if (!pair.second.loadFromString(vertex, fragment, defines))
-        {
-            return false;
-        }
+        return false;
     }
+
     m_shaders.insert(std::move(pair));
     return true;
 }
@@ -135,29 +138,38 @@ bool ShaderResource::loadFromString(std::int32_t ID, const std::string& vertex,
     }
 
     auto pair = std::make_pair(ID, Shader());
-    if (!m_includes.empty())
-    {
-        auto v = parseIncludes(vertex);
-        auto g = parseIncludes(geom);
-        auto f = parseIncludes(fragment);
+    const auto& v = m_includes.empty() ? vertex : parseIncludes(vertex);
+    const auto& g = m_includes.empty() ? geom : parseIncludes(geom);
+    const auto& f = m_includes.empty() ? fragment : parseIncludes(fragment);
 
-        if (!pair.second.loadFromString(v, g, f, defines))
+    if (m_batchActive)
+    {
+        if (!pair.second.beginLoadFromString(v, g, f, defines))
         {
             return false;
         }
     }
-    else
+    else if (!pair.second.loadFromString(v, g, f, defines))
     {
-        if (!pair.second.loadFromString(vertex, geom, fragment, defines))
-        {
-            return false;
-        }
+        return false;
     }
+
     m_shaders.insert(std::move(pair));
     return true;
 }
 
 std::int32_t ShaderResource::loadBuiltIn(BuiltIn type, std::int32_t flags)
+{
+    const auto id = createBuiltIn(type, flags);
+    if (id != -1
+        && std::find(m_builtInIDs.begin(), m_builtInIDs.end(), id) == m_builtInIDs.end())
+    {
+        m_builtInIDs.push_back(id);
+    }
+    return id;
+}
+
+std::int32_t ShaderResource::createBuiltIn(BuiltIn type, std::int32_t flags)
 {
 #ifdef PLATFORM_DESKTOP
     CRO_ASSERT(type >= BuiltIn::PBRDeferred && flags > 0, "Invalid type of flags value");
@@ -305,11 +317,83 @@ std::int32_t ShaderResource::loadBuiltIn(BuiltIn type, std::int32_t flags)
         break;
     }
 
-    if (success)
+    return success ? id : -1;
+}
+
+void ShaderResource::beginBatch()
+{
+    m_batchActive = true;
+}
+
+bool ShaderResource::endBatch()
+{
+    m_batchActive = false;
+
+    bool success = true;
+    for (auto it = m_shaders.begin(); it != m_shaders.end();)
     {
-        return id;
+        if (it->second.isLoadPending()
+            && !it->second.finishLoad())
+        {
+            LogE << "Shader ID " << it->first << " failed to build and was removed" << std::endl;
+            m_builtInIDs.erase(std::remove(m_builtInIDs.begin(), m_builtInIDs.end(), it->first), m_builtInIDs.end());
+            it = m_shaders.erase(it);
+            success = false;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    return success;
+}
+
+bool ShaderResource::saveBuiltInManifest(const std::string& path) const
+{
+    ConfigFile cfg("shader_manifest");
+    for (auto id : m_builtInIDs)
+    {
+        cfg.addProperty("built_in").setValue(static_cast<std::uint32_t>(id));
+    }
+    return cfg.save(path);
+}
+
+std::size_t ShaderResource::loadBuiltInManifest(const std::string& path)
+{
+    ConfigFile cfg;
+    if (!cfg.loadFromFile(path, false))
+    {
+        return 0;
+    }
+
+    std::size_t count = 0;
+    for (const auto& prop : cfg.getProperties())
+    {
+        if (prop.getName() == "built_in")
+        {
+            //IDs are the type in the top byte ORd with the feature flags
+            const auto id = static_cast<std::int32_t>(prop.getValue<std::uint32_t>());
+            const auto type = id & 0xFF000000;
+            const auto flags = id & 0x00FFFFFF;
+
+#ifdef PLATFORM_DESKTOP
+            if (type >= BuiltIn::PBRDeferred
+#else
+            if (type >= BuiltIn::Unlit
+#endif
+                && type <= BuiltIn::PBR
+                && flags != 0
+                && createBuiltIn(static_cast<BuiltIn>(type), flags) != -1)
+            {
+                count++;
+            }
+            else
+            {
+                LogW << path << ": skipped invalid built in shader ID " << id << std::endl;
+            }
+        }
     }
-    return -1;
+    return count;
 }
 
 Shader& ShaderResource::get(std::int32_t ID)
@@ -319,7 +403,16 @@ Shader& ShaderResource::get(std::int32_t ID)
         Logger::log("Could not find shader with ID " + std::to_string(ID) + ", returning default shader", Logger::Type::Warning);
         return m_defaultShader;
     }
-    return m_shaders.at(ID);// .second;
+
+    auto& shader = m_shaders.at(ID);
+    if (shader.isLoadPending()
+        && !shader.finishLoad())
+    {
+        LogE << "Shader ID " << ID << " failed to build, returning default shader" << std::endl;
+        removeShader(ID);
+        return m_defaultShader;
+    }
+    return shader;
 }
 
 Shader& ShaderResource::get(const std::string& stringID)
@@ -365,6 +458,13 @@ bool ShaderResource::mapStringID(const std::string& stringID, std::int32_t shade
 }
 
 //private
+void ShaderResource::removeShader(std::int32_t ID)
+{
+    //so failed built in variants aren't retried next run
+    m_builtInIDs.erase(std::remove(m_builtInIDs.begin(), m_builtInIDs.end(), ID), m_builtInIDs.end());
+    m_shaders.erase(ID);
+}
+
 std::string ShaderResource::parseIncludes(const std::string& src) const
 {
     std::string ret;
@@ -37,6 +37,7 @@ source distribution.
 #include <crogine/core/FileSystem.hpp>
 #include <crogine/gui/Gui.hpp>
 
+#include <cstring>
 #include <string>
 
 namespace
@@ -101,9 +102,7 @@ using namespace cro;
 void cro::videoCallback(plm_t* mpg, plm_frame_t* frame, void* user)
 {
     auto* videoPlayer = static_cast<VideoPlayer*>(user);
-    videoPlayer->updateTexture(videoPlayer->m_y.getGLHandle(), &frame->y);
-    videoPlayer->updateTexture(videoPlayer->m_cb.getGLHandle(), &frame->cb);
-    videoPlayer->updateTexture(videoPlayer->m_cr.getGLHandle(), &frame->cr);
+    videoPlayer->pushFrame(frame);
 }
 
 void cro::audioCallback(plm_t*, plm_samples_t* samples, void* user)
@@ -117,7 +116,13 @@ VideoPlayer::VideoPlayer()
     m_looped            (false),
     m_timeAccumulator   (0.f),
     m_frameTime         (0.f),
-    m_state             (State::Stopped)
+    m_duration          (0.f),
+    m_position          (0.f),
+    m_state             (State::Stopped),
+    m_queueHead         (0),
+    m_queueCount        (0),
+    m_decoding          (false),
+    m_ended             (false)
 {
     //TODO we don't really want to create a shader for EVERY instance
     //but on the other hand why would I play a lot of videos at once?
@@ -134,6 +139,10 @@ VideoPlayer::VideoPlayer()
         glUniform1i(m_shader.getUniformID("u_textureCR"), 1);
         glUniform1i(m_shader.getUniformID("u_textureCB"), 2);
     }
+
+#ifdef PLATFORM_DESKTOP
+    glCheck(glGenBuffers(static_cast<GLsizei>(m_pbos.size()), m_pbos.data()));
+#endif
 }
 
 //VideoPlayer::VideoPlayer(VideoPlayer&& other)
@@ -154,6 +163,13 @@ VideoPlayer::~VideoPlayer()
 
         plm_destroy(m_plm);
     }
+
+#ifdef PLATFORM_DESKTOP
+    if (m_pbos[0])
+    {
+        glCheck(glDeleteBuffers(static_cast<GLsizei>(m_pbos.size()), m_pbos.data()));
+    }
+#endif
 }
 
 bool VideoPlayer::loadFromFile(const std::string& path)
@@ -161,7 +177,7 @@ bool VideoPlayer::loadFromFile(const std::string& path)
     auto fullPath = cro::FileSystem::getResourcePath() + path;
 
     //remove existing file first
-    if (m_state == State::Playing)
+    if (m_state != State::Stopped)
     {
         stop();
     }   
@@ -212,6 +228,11 @@ bool VideoPlayer::loadFromFile(const std::string& path)
     
     m_frameTime = 1.f / frameRate;
 
+    //this reads to the end of the file so it's not
+    //safe to query once the decoder thread is running
+    m_duration = static_cast<float>(plm_get_duration(m_plm));
+    m_position = 0.f;
+
     //the plane sizes aren't actually the same
     //but this sets the texture property used
     //by the output sprite so that it matches
@@ -220,6 +241,7 @@ bool VideoPlayer::loadFromFile(const std::string& path)
     m_cr.create(width, height, cro::ImageFormat::A);
     m_cb.create(width, height, cro::ImageFormat::A);
     m_outputBuffer.create(width, height, false);
+    m_textureSizes = {};
 
     m_quad.setTexture(m_y);
     m_quad.setShader(m_shader);
@@ -260,20 +282,38 @@ void VideoPlayer::update(float dt)
     if (m_plm)
     {
         CRO_ASSERT(m_frameTime > 0, "");
+
+        //skip any frames we're too late to display
+        bool newFrame = false;
         while (m_timeAccumulator > m_frameTime)
         {
             m_timeAccumulator -= m_frameTime;
 
             if (m_state == State::Playing)
             {
-                plm_decode(m_plm, m_frameTime);
+                newFrame = popFrame() || newFrame;
+            }
+        }
 
-                updateBuffer();
+        if (newFrame)
+        {
+            m_position = m_currentFrame.time;
+
+            for (auto i = 0u; i < m_currentFrame.planes.size(); ++i)
+            {
+                updateTexture(i, m_currentFrame.planes[i]);
+            }
+            updateBuffer();
+        }
 
-                if (plm_has_ended(m_plm))
-                {
-                    stop();
-                }
+        if (m_state == State::Playing
+            && m_ended)
+        {
+            std::scoped_lock lock(m_queueMutex);
+            if (m_queueCount == 0)
+            {
+                m_ended = false;
+                stop();
             }
         }
     }
@@ -299,6 +339,7 @@ void VideoPlayer::play()
 
     m_timeAccumulator = 0.f;
     m_state = State::Playing;
+    startDecoding();
     
     if (m_audioStream.hasAudio)
     {
@@ -312,6 +353,10 @@ void VideoPlayer::pause()
     {
         m_state = State::Paused;
         m_audioStream.pause();
+
+        //the queue will fill up and the decoder stall
+        //so we might as well not hold on to the thread
+        stopDecoding();
     }
 }
 
@@ -322,10 +367,16 @@ void VideoPlayer::stop()
         m_state = State::Stopped;
         m_audioStream.stop();
 
+        stopDecoding();
+        clearQueue();
+        m_ended = false;
+        m_position = 0.f;
+
         if (m_plm)
         {
             //rewind the file
             plm_seek(m_plm, 0, FALSE);
+            clearQueue(); //seeking decodes a frame
 
             //clear the buffer else we repeat the last frame
             m_outputBuffer.clear();
@@ -338,49 +389,221 @@ void VideoPlayer::seek(float position)
 {
     if (m_plm)
     {
+        const bool wasDecoding = m_decoding;
+        stopDecoding();
+        clearQueue();
+
+        //this decodes the frame at the new position
+        //which is pushed into the (now empty) queue
         plm_seek(m_plm, position, FALSE);
 
-        if (m_state != State::Playing)
+        if (m_state != State::Playing
+            && popFrame())
         {
+            m_position = m_currentFrame.time;
+
+            for (auto i = 0u; i < m_currentFrame.planes.size(); ++i)
+            {
+                updateTexture(i, m_currentFrame.planes[i]);
+            }
             updateBuffer();
         }
+
+        if (wasDecoding)
+        {
+            startDecoding();
+        }
     }
 }
 
 float VideoPlayer::getDuration() const
 {
-    if (m_plm)
-    {
-        return static_cast<float>(plm_get_duration(m_plm));
-    }
-    return 0.f;
+    return m_plm ? m_duration : 0.f;
 }
 
 float VideoPlayer::getPosition() const
 {
-    if (m_plm)
-    {
-        return static_cast<float>(plm_get_time(m_plm));
-    }
-    return 0.f;
+    return m_plm ? m_position : 0.f;
 }
 
 void VideoPlayer::setLooped(bool looped)
 {
     m_looped = looped;
 
-    if (m_plm)
+    //the decoder thread applies this itself while running
+    if (m_plm
+        && !m_decoding)
     {
         plm_set_loop(m_plm, looped ? 1 : 0);
     }
 }
 
 //private
-void VideoPlayer::updateTexture(std::uint32_t textureID, plm_plane_t* plane)
+void VideoPlayer::startDecoding()
 {
-    CRO_ASSERT(textureID != 0, "");
-    glBindTexture(GL_TEXTURE_2D, textureID);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, plane->width, plane->height, 0, GL_RED, GL_UNSIGNED_BYTE, plane->data);
+    if (!m_decoding)
+    {
+        m_ended = false;
+        m_decoding = true;
+        m_decodeThread = std::thread(&VideoPlayer::decodeThreadFunc, this);
+    }
+}
+
+void VideoPlayer::stopDecoding()
+{
+    if (m_decoding)
+    {
+        {
+            std::scoped_lock lock(m_queueMutex);
+            m_decoding = false;
+        }
+        m_queueCondition.notify_all();
+    }
+
+    if (m_decodeThread.joinable())
+    {
+        m_decodeThread.join();
+    }
+}
+
+void VideoPlayer::decodeThreadFunc()
+{
+    while (m_decoding)
+    {
+        {
+            //wait for space so we don't run too far ahead
+            std::unique_lock lock(m_queueMutex);
+            m_queueCondition.wait(lock, [&]() { return !m_decoding || m_queueCount < FrameQueueSize; });
+        }
+
+        if (!m_decoding)
+        {
+            break;
+        }
+
+        plm_set_loop(m_plm, m_looped ? 1 : 0);
+        plm_decode(m_plm, m_frameTime);
+
+        if (plm_has_ended(m_plm))
+        {
+            m_ended = true;
+            break;
+        }
+    }
+}
+
+void VideoPlayer::pushFrame(plm_frame_t* frame)
+{
+    std::unique_lock lock(m_queueMutex);
+
+    //a single decode may occasionally output more than one frame,
+    //in which case we wait for space (unless we're being stopped)
+    m_queueCondition.wait(lock, [&]() { return !m_decoding || m_queueCount < FrameQueueSize; });
+    if (m_queueCount == FrameQueueSize)
+    {
+        return;
+    }
+
+    auto& dst = m_frameQueue[(m_queueHead + m_queueCount) % FrameQueueSize];
+    lock.unlock();
+
+    //the slot is only ours until it's counted below so it's safe to copy unlocked
+    const std::array<plm_plane_t*, 3u> src = { &frame->y, &frame->cb, &frame->cr };
+    for (auto i = 0u; i < src.size(); ++i)
+    {
+        auto& plane = dst.planes[i];
+        plane.width = src[i]->width;
+        plane.height = src[i]->height;
+        plane.data.assign(src[i]->data, src[i]->data + (plane.width * plane.height));
+    }
+    dst.time = static_cast<float>(frame->time);
+
+    lock.lock();
+    m_queueCount++;
+}
+
+bool VideoPlayer::popFrame()
+{
+    {
+        std::scoped_lock lock(m_queueMutex);
+        if (m_queueCount == 0)
+        {
+            return false;
+        }
+
+        std::swap(m_currentFrame, m_frameQueue[m_queueHead]);
+        m_queueHead = (m_queueHead + 1) % FrameQueueSize;
+        m_queueCount--;
+    }
+    m_queueCondition.notify_all();
+
+    return true;
+}
+
+void VideoPlayer::clearQueue()
+{
+    {
+        std::scoped_lock lock(m_queueMutex);
+        m_queueHead = 0;
+        m_queueCount = 0;
+    }
+    m_queueCondition.notify_all();
+}
+
+void VideoPlayer::updateTexture(std::size_t index, const Plane& plane)
+{
+    const std::array<std::uint32_t, 3u> textureIDs = { m_y.getGLHandle(), m_cb.getGLHandle(), m_cr.getGLHandle() };
+    CRO_ASSERT(textureIDs[index] != 0, "");
+
+    glCheck(glBindTexture(GL_TEXTURE_2D, textureIDs[index]));
+
+    //the planes are padded to the macroblock size so (re)allocate
+    //the texture storage when it doesn't match, and update the sub
+    //image otherwise
+    const std::pair<std::uint32_t, std::uint32_t> size(plane.width, plane.height);
+    const bool resize = m_textureSizes[index] != size;
+    m_textureSizes[index] = size;
+
+    glCheck(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
+#ifdef PLATFORM_DESKTOP
+    //orphaning the buffer means the driver can copy the previous
+    //contents to the texture while we fill the new storage
+    const auto byteCount = static_cast<GLsizeiptr>(plane.data.size());
+    glCheck(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pbos[index]));
+    glCheck(glBufferData(GL_PIXEL_UNPACK_BUFFER, byteCount, nullptr, GL_STREAM_DRAW));
+
+    void* dst = nullptr;
+    glCheck(dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, byteCount, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+    if (dst)
+    {
+        std::memcpy(dst, plane.data.data(), plane.data.size());
+        glCheck(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+
+        if (resize)
+        {
+            glCheck(glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, plane.width, plane.height, 0, GL_RED, GL_UNSIGNED_BYTE, nullptr));
+        }
+        else
+        {
+            glCheck(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, plane.width, plane.height, GL_RED, GL_UNSIGNED_BYTE, nullptr));
+        }
+        glCheck(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+        glCheck(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+        return;
+    }
+    glCheck(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+#endif
+
+    if (resize)
+    {
+        glCheck(glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, plane.width, plane.height, 0, GL_RED, GL_UNSIGNED_BYTE, plane.data.data()));
+    }
+    else
+    {
+        glCheck(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, plane.width, plane.height, GL_RED, GL_UNSIGNED_BYTE, plane.data.data()));
+    }
+    glCheck(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
 }
 
 void VideoPlayer::updateBuffer()
@@ -443,13 +666,24 @@ void VideoPlayer::AudioStream::init(std::uint32_t channels, std::uint32_t sample
 
 void VideoPlayer::AudioStream::pushData(float* data)
 {
+    const std::size_t bufferIn = m_bufferIn;
+    const std::size_t used = (bufferIn + m_inBuffer.size() - m_bufferOut) % m_inBuffer.size();
+
+    //one sample is always left free, else a full buffer looks empty to onGetData().
+    //If decoding has run this far ahead of playback the samples are dropped rather
+    //than overwriting those which haven't been played yet
+    if (m_inBuffer.size() - 1 - used < AudioBufferSize)
+    {
+        return;
+    }
+
     for (auto i = 0u; i < AudioBufferSize; ++i)
     {
-        auto index = (m_bufferIn + i) % m_inBuffer.size();
+        auto index = (bufferIn + i) % m_inBuffer.size();
 
         std::int16_t sample = data[i] * std::numeric_limits<std::int16_t>::max();
         m_inBuffer[index] = sample;
     }
 
-    m_bufferIn = (m_bufferIn + AudioBufferSize) % m_inBuffer.size();
+    m_bufferIn = static_cast<std::uint32_t>((bufferIn + AudioBufferSize) % m_inBuffer.size());
 }
\ No newline at end of file
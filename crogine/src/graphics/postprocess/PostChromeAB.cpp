@@ -30,6 +30,7 @@ source distribution.
 #include <crogine/graphics/postprocess/PostChromeAB.hpp>
 #include <crogine/graphics/postprocess/PostVertex.hpp>
 #include <crogine/graphics/RenderTexture.hpp>
+#include <crogine/graphics/GPUProfiler.hpp>
 #include "../../detail/GLCheck.hpp"
 
 using namespace cro;
@@ -56,6 +57,7 @@ PostChromeAB::PostChromeAB()
 //public
 void PostChromeAB::apply(const RenderTexture& input)
 {
+    CRO_GPU_SCOPE("PostChromeAB");
     glCheck(glUseProgram(m_postShader.getGLHandle()));
     glCheck(glActiveTexture(GL_TEXTURE0));
     glCheck(glBindTexture(GL_TEXTURE_2D, input.getTexture().getGLHandle()));
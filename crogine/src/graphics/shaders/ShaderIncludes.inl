@@ -102,6 +102,64 @@ layout (std140) uniform LightUniforms
 #endif
 )";
 
+//#include CLUSTERED_LIGHTS
+//requires CAMERA_UBO. Grid data is supplied per camera by the ModelRenderer
+//from any lights visible to a LightVolumeSystem in the same Scene.
+static inline const std::string ClusteredLights =
+R"(
+#if !defined(MOBILE)
+#define CLUSTERED_LIGHTS
+#define MAX_CLUSTERED_LIGHTS 256
+
+layout (std140) uniform ClusterUniforms
+{
+    uvec4 u_clusterGridSize; //xyz grid dimensions, w light count
+    vec4 u_clusterDepthParams; //log scale, log bias, near, far
+    vec4 u_clusterLightPosition[MAX_CLUSTERED_LIGHTS]; //world position, radius
+    vec4 u_clusterLightColour[MAX_CLUSTERED_LIGHTS];
+};
+
+uniform usamplerBuffer u_lightClusterGrid;
+
+vec3 getClusteredLighting(vec3 worldPos, vec3 normal)
+{
+    vec3 result = vec3(0.0);
+    if (u_clusterGridSize.w == 0u)
+    {
+        return result;
+    }
+
+    vec4 clipPos = u_viewProjectionMatrix * vec4(worldPos, 1.0);
+    if (clipPos.w < u_clusterDepthParams.z)
+    {
+        return result;
+    }
+
+    vec2 uv = clamp(((clipPos.xy / clipPos.w) * 0.5) + 0.5, 0.0, 0.9999);
+    uvec3 cluster = uvec3(uv * vec2(u_clusterGridSize.xy),
+        uint(clamp(log(clipPos.w) * u_clusterDepthParams.x + u_clusterDepthParams.y, 0.0, float(u_clusterGridSize.z - 1u))));
+
+    uint clusterIndex = cluster.x + (cluster.y * u_clusterGridSize.x) + (cluster.z * u_clusterGridSize.x * u_clusterGridSize.y);
+    uint header = texelFetch(u_lightClusterGrid, int(clusterIndex)).r;
+    uint offset = header >> 8u;
+    uint count = header & 0xffu;
+
+    for (uint i = 0u; i < count; ++i)
+    {
+        uint lightIndex = texelFetch(u_lightClusterGrid, int(offset + i)).r;
+        vec4 light = u_clusterLightPosition[lightIndex];
+
+        vec3 lightDir = light.xyz - worldPos;
+        float attenuation = 1.0 - min(dot(lightDir, lightDir) / (light.w * light.w), 1.0);
+        float amount = max(dot(normal, normalize(lightDir)), 0.0);
+
+        result += u_clusterLightColour[lightIndex].rgb * amount * attenuation;
+    }
+    return result;
+}
+#endif
+)";
+
 //#include INSTANCE_ATTRIBS
 static inline const std::string InstanceAttribs =
 R"(
@@ -0,0 +1,220 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include "../detail/enet/enet/enet.h"
+
+#include "NetBatcher.hpp"
+#include "PacketPool.hpp"
+
+#include <crogine/core/Log.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+using namespace cro;
+using namespace cro::Detail;
+
+namespace
+{
+    constexpr std::size_t MessageHeaderSize = sizeof(std::uint8_t) + sizeof(std::uint16_t);
+}
+
+NetBatcher::~NetBatcher()
+{
+    for (auto i = m_nextReceived; i < m_received.size(); ++i)
+    {
+        PacketPool::release(m_received[i].packet);
+    }
+}
+
+//public
+bool NetBatcher::add(ENetPeer* peer, std::uint8_t channel, std::uint8_t id, const void* data, std::size_t size)
+{
+    auto result = std::find_if(m_batches.begin(), m_batches.end(),
+        [peer, channel](const Batch& b) {return b.peer == peer && b.channel == channel; });
+
+    if (size > std::numeric_limits<std::uint16_t>::max()
+        || size + MessageHeaderSize + sizeof(BatchID) > MaxBatchSize)
+    {
+        //maintain the order in which messages are sent
+        if (result != m_batches.end())
+        {
+            send(*result);
+        }
+        return false;
+    }
+
+    if (result == m_batches.end())
+    {
+        result = m_batches.insert(m_batches.end(), Batch());
+        result->peer = peer;
+        result->channel = channel;
+        result->data.reserve(MaxBatchSize);
+        result->data.push_back(BatchID);
+    }
+    else if (result->data.size() + MessageHeaderSize + size > MaxBatchSize)
+    {
+        send(*result);
+    }
+
+    const auto messageSize = static_cast<std::uint16_t>(size);
+    const auto offset = result->data.size();
+    result->data.resize(offset + MessageHeaderSize + size);
+    result->data[offset] = id;
+    std::memcpy(&result->data[offset + sizeof(id)], &messageSize, sizeof(messageSize));
+    std::memcpy(&result->data[offset + MessageHeaderSize], data, size);
+    result->messageCount++;
+
+    return true;
+}
+
+void NetBatcher::flush()
+{
+    for (auto& batch : m_batches)
+    {
+        send(batch);
+    }
+}
+
+void NetBatcher::flush(ENetPeer* peer)
+{
+    for (auto& batch : m_batches)
+    {
+        if (batch.peer == peer)
+        {
+            send(batch);
+        }
+    }
+}
+
+void NetBatcher::flush(ENetPeer* peer, std::uint8_t channel)
+{
+    auto result = std::find_if(m_batches.begin(), m_batches.end(),
+        [peer, channel](const Batch& b) {return b.peer == peer && b.channel == channel; });
+
+    if (result != m_batches.end())
+    {
+        send(*result);
+    }
+}
+
+void NetBatcher::removePeer(ENetPeer* peer)
+{
+    m_batches.erase(std::remove_if(m_batches.begin(), m_batches.end(),
+        [peer](const Batch& b) {return b.peer == peer; }), m_batches.end());
+}
+
+bool NetBatcher::unpack(ENetPeer* peer, ENetPacket* packet)
+{
+    if (packet->dataLength == 0
+        || packet->data[0] != BatchID)
+    {
+        return false;
+    }
+
+    std::size_t offset = sizeof(BatchID);
+    while (offset + MessageHeaderSize <= packet->dataLength)
+    {
+        const auto id = packet->data[offset];
+        std::uint16_t size = 0;
+        std::memcpy(&size, &packet->data[offset + sizeof(id)], sizeof(size));
+        offset += MessageHeaderSize;
+
+        if (offset + size > packet->dataLength)
+        {
+            LogE << "Received malformed packet batch" << std::endl;
+            break;
+        }
+
+        //copying the ID over the end of the size field places it directly
+        //before the message data, so the message can be viewed as if it
+        //were a packet in its own right without copying it
+        packet->data[offset - sizeof(id)] = id;
+
+        PacketPool::retain(packet);
+        m_received.push_back({ peer, packet, offset - sizeof(id), sizeof(id) + size });
+
+        offset += size;
+    }
+
+    //releases the reference held while unpacking, which
+    //destroys the batch if it contained no valid messages
+    PacketPool::release(packet);
+    return true;
+}
+
+bool NetBatcher::pollReceived(Received& dst)
+{
+    if (m_nextReceived == m_received.size())
+    {
+        if (!m_received.empty())
+        {
+            m_received.clear();
+            m_nextReceived = 0;
+        }
+        return false;
+    }
+
+    dst = m_received[m_nextReceived++];
+    return true;
+}
+
+//private
+void NetBatcher::send(Batch& batch)
+{
+    if (batch.messageCount == 0)
+    {
+        return;
+    }
+
+    ENetPacket* packet = nullptr;
+    if (batch.messageCount == 1)
+    {
+        //no point in the batch overhead, and keeps single messages
+        //readable by hosts/clients which don't understand batches
+        const auto size = batch.data.size() - (sizeof(BatchID) + MessageHeaderSize);
+        packet = enet_packet_create(nullptr, sizeof(std::uint8_t) + size, ENET_PACKET_FLAG_RELIABLE);
+        packet->data[0] = batch.data[sizeof(BatchID)];
+        std::memcpy(&packet->data[sizeof(std::uint8_t)], &batch.data[sizeof(BatchID) + MessageHeaderSize], size);
+    }
+    else
+    {
+        packet = enet_packet_create(batch.data.data(), batch.data.size(), ENET_PACKET_FLAG_RELIABLE);
+    }
+
+    if (enet_peer_send(batch.peer, batch.channel, packet) != 0)
+    {
+        //peer probably disconnected
+        enet_packet_destroy(packet);
+    }
+
+    batch.data.resize(sizeof(BatchID));
+    batch.messageCount = 0;
+}
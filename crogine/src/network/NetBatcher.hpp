@@ -0,0 +1,112 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+struct _ENetPacket;
+struct _ENetPeer;
+
+namespace cro::Detail
+{
+    /*
+    Accumulates reliable messages sent to each peer/channel pair so that
+    they can be sent as a single ENet packet, and unpacks received batches
+    back into individual packets. Batches are tagged with BatchID followed
+    by each message as a uint8 ID, a uint16 size and the message data.
+    */
+    class NetBatcher final
+    {
+    public:
+        static constexpr std::uint8_t BatchID = 0xff;
+        static constexpr std::size_t MaxBatchSize = 1200; //keeps batches within a typical MTU
+
+        /*
+        Adds a message to the batch for the given peer/channel.
+        Returns false if the message is too large to batch, in
+        which case any pending batch has already been flushed
+        and the message should be sent immediately.
+        */
+        bool add(_ENetPeer*, std::uint8_t channel, std::uint8_t id, const void* data, std::size_t size);
+
+        //sends all pending batches
+        void flush();
+
+        //sends any pending batches for the given peer
+        void flush(_ENetPeer*);
+
+        //sends a pending batch for the given peer/channel
+        void flush(_ENetPeer*, std::uint8_t channel);
+
+        //discards any pending batches for the given peer
+        void removePeer(_ENetPeer*);
+
+        /*
+        If the given packet is a batch its messages are added to the
+        received queue and returns true. Received messages reference
+        the batch memory rather than copying it, and the batch is
+        destroyed once all of them have been released.
+        Else returns false and the packet is untouched.
+        */
+        bool unpack(_ENetPeer*, _ENetPacket*);
+
+        struct Received final
+        {
+            _ENetPeer* peer = nullptr;
+            _ENetPacket* packet = nullptr;
+            std::size_t offset = 0; //of the message ID within the packet
+            std::size_t size = 0; //including the ID
+        };
+
+        //returns true if there was a pending unpacked message
+        bool pollReceived(Received&);
+
+        ~NetBatcher();
+
+    private:
+        struct Batch final
+        {
+            _ENetPeer* peer = nullptr;
+            std::uint8_t channel = 0;
+            std::uint32_t messageCount = 0;
+            std::vector<std::uint8_t> data;
+        };
+        std::vector<Batch> m_batches;
+
+        //a vector is reused rather than a deque to avoid
+        //allocating blocks as messages are pushed and popped
+        std::vector<Received> m_received;
+        std::size_t m_nextReceived = 0;
+
+        void send(Batch&);
+    };
+}
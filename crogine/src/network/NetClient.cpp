@@ -30,6 +30,7 @@ source distribution.
 #include "../detail/enet/enet/enet.h"
 
 #include "NetConf.hpp"
+#include "NetBatcher.hpp"
 
 #include <crogine/network/NetClient.hpp>
 #include <crogine/core/Log.hpp>
@@ -40,8 +41,10 @@ source distribution.
 using namespace cro;
 
 NetClient::NetClient()
-    : m_client      (nullptr),
-    m_threadRunning (false)
+    : m_client          (nullptr),
+    m_batchingEnabled   (false),
+    m_batcher           (std::make_unique<Detail::NetBatcher>()),
+    m_threadRunning     (false)
 {
     if (!NetConf::instance)
     {
@@ -158,6 +161,9 @@ void NetClient::disconnect()
 
     if (m_peer.m_peer)
     {
+        m_batcher->flush(m_peer.m_peer);
+        m_batcher->removePeer(m_peer.m_peer);
+
         ENetEvent evt;
         enet_peer_disconnect(m_peer.m_peer, 0);
 
@@ -189,6 +195,18 @@ bool NetClient::pollEvent(NetEvent& evt)
 {
     if (!m_client) return false;
 
+    //messages unpacked from a previous batch come first
+    Detail::NetBatcher::Received received;
+    if (m_batcher->pollReceived(received))
+    {
+        evt.type = NetEvent::PacketReceived;
+        evt.packet.setPacketData(received.packet, received.offset, received.size);
+        evt.peer.m_peer = received.peer;
+        return true;
+    }
+
+    m_batcher->flush();
+
     ENetEvent hostEvt;
     if (enet_host_service(m_client, &hostEvt, 0) > 0)
     //if (!m_activeBuffer.empty())
@@ -205,9 +223,25 @@ bool NetClient::pollEvent(NetEvent& evt)
             evt.type = NetEvent::ClientConnect;
             break;
         case ENET_EVENT_TYPE_DISCONNECT:
-            evt.type = NetEvent::ClientDisconnect;            
+            evt.type = NetEvent::ClientDisconnect;
+            m_batcher->removePeer(hostEvt.peer);
             break;
         case ENET_EVENT_TYPE_RECEIVE:
+            //only check for batches if we opted in, else packet ID 0xff
+            //would be reserved for everyone using NetHost/NetClient
+            if (m_batchingEnabled
+                && m_batcher->unpack(hostEvt.peer, hostEvt.packet))
+            {
+                //the batch packet has been destroyed
+                evt.type = NetEvent::None;
+                if (m_batcher->pollReceived(received))
+                {
+                    evt.type = NetEvent::PacketReceived;
+                    evt.packet.setPacketData(received.packet, received.offset, received.size);
+                }
+                break;
+            }
+
             evt.type = NetEvent::PacketReceived;
             evt.packet.setPacketData(hostEvt.packet);
             //our event takes ownership
@@ -229,6 +263,19 @@ void NetClient::sendPacket(std::uint8_t id, const void* data, std::size_t size,
 {
     if (m_peer.m_peer)
     {
+        if (m_batchingEnabled
+            && flags == NetFlag::Reliable)
+        {
+            if (m_batcher->add(m_peer.m_peer, channel, id, data, size))
+            {
+                return;
+            }
+        }
+        else
+        {
+            m_batcher->flush(m_peer.m_peer, channel);
+        }
+
         std::int32_t packetFlags = 0;
         if (flags == NetFlag::Reliable)
         {
@@ -251,6 +298,20 @@ void NetClient::sendPacket(std::uint8_t id, const void* data, std::size_t size,
     }
 }
 
+void NetClient::setBatchingEnabled(bool enabled)
+{
+    if (!enabled)
+    {
+        m_batcher->flush();
+    }
+    m_batchingEnabled = enabled;
+}
+
+void NetClient::flush()
+{
+    m_batcher->flush();
+}
+
 //private
 void NetClient::threadFunc()
 {
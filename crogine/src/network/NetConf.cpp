@@ -28,6 +28,7 @@ source distribution.
 -----------------------------------------------------------------------*/
 
 #include "NetConf.hpp"
+#include "PacketPool.hpp"
 
 #include "../detail/enet/enet/enet.h"
 #include <crogine/core/Log.hpp>
@@ -39,7 +40,12 @@ std::unique_ptr<NetConf> NetConf::instance;
 NetConf::NetConf()
     : m_initOK(false)
 {
-    if (enet_initialize() == 0)
+    ENetCallbacks callbacks;
+    callbacks.malloc = Detail::PacketPool::allocate;
+    callbacks.free = Detail::PacketPool::deallocate;
+    callbacks.no_memory = nullptr;
+
+    if (enet_initialize_with_callbacks(ENET_VERSION, &callbacks) == 0)
     {
         m_initOK = true;
     }
@@ -54,5 +60,6 @@ NetConf::~NetConf()
     if (m_initOK)
     {
         enet_deinitialize();
+        Detail::PacketPool::trim();
     }
 }
\ No newline at end of file
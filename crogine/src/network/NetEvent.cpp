@@ -26,16 +26,18 @@ and must not be misrepresented as being the original software.
 source distribution.
 
 -----------------------------------------------------------------------*/
-
 #include "../detail/enet/enet/enet.h"
+#include "PacketPool.hpp"
 
 #include <crogine/network/NetData.hpp>
 
 using namespace cro;
 
 NetEvent::Packet::Packet()
-    : m_packet(nullptr),
-    m_id(0)
+    : m_packet  (nullptr),
+    m_id        (0),
+    m_offset    (0),
+    m_size      (0)
 {
 
 }
@@ -44,32 +46,41 @@ NetEvent::Packet::~Packet()
 {
     if (m_packet)
     {
-        enet_packet_destroy(m_packet);
+        Detail::PacketPool::release(m_packet);
     }
 }
 
 NetEvent::Packet::Packet(Packet&& other) noexcept
-    : m_packet(other.m_packet),
-    m_id(other.m_id)
+    : m_packet  (other.m_packet),
+    m_id        (other.m_id),
+    m_offset    (other.m_offset),
+    m_size      (other.m_size)
 {
     other.m_packet = nullptr;
     other.m_id = 0;
+    other.m_offset = 0;
+    other.m_size = 0;
 }
 
 NetEvent::Packet& NetEvent::Packet::operator=(NetEvent::Packet&& other) noexcept
 {
-    if (m_packet)
+    if (&other != this)
     {
-        enet_packet_destroy(m_packet);
+        if (m_packet)
+        {
+            Detail::PacketPool::release(m_packet);
+        }
+
+        m_packet = other.m_packet;
+        m_id = other.m_id;
+        m_offset = other.m_offset;
+        m_size = other.m_size;
+
+        other.m_packet = nullptr;
+        other.m_id = 0;
+        other.m_offset = 0;
+        other.m_size = 0;
     }
-
-    m_packet = other.m_packet;
-    m_id = other.m_id;
-
-
-    other.m_packet = nullptr;
-    other.m_id = 0;
-
     return *this;
 }
 
@@ -83,37 +94,54 @@ std::uint8_t NetEvent::Packet::getID() const
 const void* NetEvent::Packet::getData() const
 {
     CRO_ASSERT(m_packet, "Not a valid packet instance");
-    return &m_packet->data[sizeof(std::uint8_t)];
+    return &m_packet->data[m_offset + sizeof(std::uint8_t)];
 }
 
 std::size_t NetEvent::Packet::getSize() const
 {
     CRO_ASSERT(m_packet, "Not a valid packet instance");
-    return m_packet->dataLength - sizeof(std::uint8_t);
+    return m_size - sizeof(std::uint8_t);
 }
 
 std::vector<std::byte> NetEvent::Packet::getDataRaw() const
 {
     CRO_ASSERT(m_packet, "Not a valid packet instance");
-    std::vector<std::byte> ret(m_packet->dataLength);
-    
-    const auto* data = reinterpret_cast<std::byte*>(m_packet->data);
-    std::copy(data, data + m_packet->dataLength, ret.data());
-    return ret;
+    const auto* data = getRawData();
+    return std::vector<std::byte>(data, data + m_size);
+}
+
+const std::byte* NetEvent::Packet::getRawData() const
+{
+    CRO_ASSERT(m_packet, "Not a valid packet instance");
+    return reinterpret_cast<const std::byte*>(&m_packet->data[m_offset]);
+}
+
+std::size_t NetEvent::Packet::getRawSize() const
+{
+    CRO_ASSERT(m_packet, "Not a valid packet instance");
+    return m_size;
 }
 
 //private
 void NetEvent::Packet::setPacketData(ENetPacket* packet)
+{
+    setPacketData(packet, 0, packet ? packet->dataLength : 0);
+}
+
+void NetEvent::Packet::setPacketData(ENetPacket* packet, std::size_t offset, std::size_t size)
 {
     if (m_packet)
     {
-        enet_packet_destroy(m_packet);
+        Detail::PacketPool::release(m_packet);
     }
 
     m_packet = packet;
+    m_offset = offset;
+    m_size = size;
 
     if (m_packet)
     {
-        std::memcpy(&m_id, m_packet->data, sizeof(std::uint8_t));
+        CRO_ASSERT(offset + size <= m_packet->dataLength, "");
+        std::memcpy(&m_id, &m_packet->data[m_offset], sizeof(std::uint8_t));
     }
-}
\ No newline at end of file
+}
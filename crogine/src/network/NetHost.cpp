@@ -32,6 +32,7 @@ source distribution.
 #include "../detail/enet/enet/enet.h"
 
 #include "NetConf.hpp"
+#include "NetBatcher.hpp"
 #include <crogine/network/NetHost.hpp>
 #include <crogine/core/Log.hpp>
 #include <crogine/detail/Assert.hpp>
@@ -65,7 +66,9 @@ namespace
 }
 
 NetHost::NetHost()
-    : m_host    (nullptr)
+    : m_host            (nullptr),
+    m_batchingEnabled   (false),
+    m_batcher           (std::make_unique<Detail::NetBatcher>())
 {
     if (!NetConf::instance)
     {
@@ -129,6 +132,8 @@ void NetHost::stop()
 {
     if (m_host)
     {
+        m_batcher->flush();
+
         if (m_host->connectedPeers > 0)
         {
             for (auto i = 0u; i < m_host->connectedPeers; ++i)
@@ -171,6 +176,18 @@ bool NetHost::pollEvent(NetEvent& evt)
 {
     if (!m_host) return false;
 
+    //messages unpacked from a previous batch come first
+    Detail::NetBatcher::Received received;
+    if (m_batcher->pollReceived(received))
+    {
+        evt.type = NetEvent::PacketReceived;
+        evt.packet.setPacketData(received.packet, received.offset, received.size);
+        evt.peer.m_peer = received.peer;
+        return true;
+    }
+
+    m_batcher->flush();
+
     ENetEvent hostEvt;
     if (enet_host_service(m_host, &hostEvt, 0) > 0)
     {
@@ -184,8 +201,24 @@ bool NetHost::pollEvent(NetEvent& evt)
             break;
         case ENET_EVENT_TYPE_DISCONNECT:
             evt.type = NetEvent::ClientDisconnect;
+            m_batcher->removePeer(hostEvt.peer);
             break;
         case ENET_EVENT_TYPE_RECEIVE:
+            //only check for batches if we opted in, else packet ID 0xff
+            //would be reserved for everyone using NetHost/NetClient
+            if (m_batchingEnabled
+                && m_batcher->unpack(hostEvt.peer, hostEvt.packet))
+            {
+                //the batch packet has been destroyed
+                evt.type = NetEvent::None;
+                if (m_batcher->pollReceived(received))
+                {
+                    evt.type = NetEvent::PacketReceived;
+                    evt.packet.setPacketData(received.packet, received.offset, received.size);
+                }
+                break;
+            }
+
             evt.type = NetEvent::PacketReceived;
             evt.packet.setPacketData(hostEvt.packet);
             //our event takes ownership and promises to clean up the packet
@@ -202,6 +235,33 @@ void NetHost::broadcastPacket(std::uint8_t id, const void* data, std::size_t siz
 {
     if (m_host)
     {
+        if (m_batchingEnabled
+            && flags == NetFlag::Reliable)
+        {
+            //add to each peer's batch so the order of
+            //broadcast and directly sent messages is kept
+            bool batched = true;
+            for (auto i = 0u; i < m_host->peerCount; ++i)
+            {
+                if (m_host->peers[i].state == ENET_PEER_STATE_CONNECTED)
+                {
+                    batched = m_batcher->add(&m_host->peers[i], channel, id, data, size) && batched;
+                }
+            }
+
+            if (batched)
+            {
+                return;
+            }
+        }
+        else
+        {
+            for (auto i = 0u; i < m_host->peerCount; ++i)
+            {
+                m_batcher->flush(&m_host->peers[i], channel);
+            }
+        }
+
         enet_host_broadcast(m_host, channel, createPacket(id, data, size, flags));
     }
 }
@@ -210,6 +270,19 @@ void NetHost::sendPacket(const NetPeer& peer, std::uint8_t id, const void* data,
 {
     if (peer.m_peer)
     {
+        if (m_batchingEnabled
+            && flags == NetFlag::Reliable)
+        {
+            if (m_batcher->add(peer.m_peer, channel, id, data, size))
+            {
+                return;
+            }
+        }
+        else
+        {
+            m_batcher->flush(peer.m_peer, channel);
+        }
+
         enet_peer_send(peer.m_peer, channel, createPacket(id, data, size, flags));
     }
 }
@@ -218,6 +291,8 @@ void NetHost::disconnect(NetPeer& peer)
 {
     if (m_host && peer.m_peer)
     {
+        m_batcher->flush(peer.m_peer);
+        m_batcher->removePeer(peer.m_peer);
         enet_peer_disconnect(peer.m_peer, 0);
         peer.m_peer = nullptr;
     }
@@ -227,7 +302,24 @@ void NetHost::disconnectLater(NetPeer& peer)
 {
     if (m_host && peer.m_peer)
     {
+        //make sure any pending messages, such as errors, go first
+        m_batcher->flush(peer.m_peer);
+        m_batcher->removePeer(peer.m_peer);
         enet_peer_disconnect_later(peer.m_peer, 0);
         peer.m_peer = nullptr;
     }
+}
+
+void NetHost::setBatchingEnabled(bool enabled)
+{
+    if (!enabled)
+    {
+        m_batcher->flush();
+    }
+    m_batchingEnabled = enabled;
+}
+
+void NetHost::flush()
+{
+    m_batcher->flush();
 }
\ No newline at end of file
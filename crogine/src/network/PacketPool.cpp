@@ -0,0 +1,171 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include "../detail/enet/enet/enet.h"
+
+#include "PacketPool.hpp"
+
+#include <crogine/util/Network.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+
+namespace
+{
+    //keeps the user memory aligned to max_align_t
+    constexpr std::size_t HeaderSize = alignof(std::max_align_t) > sizeof(std::size_t) ? alignof(std::max_align_t) : sizeof(std::size_t);
+
+    constexpr std::size_t MinBlockSize = 32;
+    constexpr std::size_t ClassCount = 8; //32b - 4kb
+    constexpr std::size_t Unpooled = ClassCount;
+
+    struct FreeBlock final
+    {
+        FreeBlock* next = nullptr;
+    };
+
+    struct Pool final
+    {
+        std::mutex mutex;
+        std::array<FreeBlock*, ClassCount> freeLists = {};
+
+        std::atomic<std::uint64_t> allocationCount = 0;
+        std::atomic<std::uint64_t> systemAllocationCount = 0;
+        std::atomic<std::uint64_t> activeCount = 0;
+    }pool;
+
+    std::size_t getSizeClass(std::size_t size)
+    {
+        auto blockSize = MinBlockSize;
+        for (auto i = 0u; i < ClassCount; ++i)
+        {
+            if (size <= blockSize)
+            {
+                return i;
+            }
+            blockSize *= 2;
+        }
+        return Unpooled;
+    }
+}
+
+void* cro::Detail::PacketPool::allocate(std::size_t size)
+{
+    pool.allocationCount++;
+    pool.activeCount++;
+
+    const auto sizeClass = getSizeClass(size);
+    if (sizeClass != Unpooled)
+    {
+        std::scoped_lock lock(pool.mutex);
+        if (auto* block = pool.freeLists[sizeClass]; block != nullptr)
+        {
+            pool.freeLists[sizeClass] = block->next;
+            return block;
+        }
+        size = MinBlockSize << sizeClass;
+    }
+
+    pool.systemAllocationCount++;
+    auto* memory = static_cast<std::byte*>(std::malloc(size + HeaderSize));
+    if (!memory)
+    {
+        return nullptr;
+    }
+
+    *reinterpret_cast<std::size_t*>(memory) = sizeClass;
+    return memory + HeaderSize;
+}
+
+void cro::Detail::PacketPool::deallocate(void* memory)
+{
+    if (!memory)
+    {
+        return;
+    }
+
+    pool.activeCount--;
+
+    auto* header = static_cast<std::byte*>(memory) - HeaderSize;
+    const auto sizeClass = *reinterpret_cast<std::size_t*>(header);
+
+    if (sizeClass == Unpooled)
+    {
+        std::free(header);
+        return;
+    }
+
+    auto* block = static_cast<FreeBlock*>(memory);
+    std::scoped_lock lock(pool.mutex);
+    block->next = pool.freeLists[sizeClass];
+    pool.freeLists[sizeClass] = block;
+}
+
+void cro::Detail::PacketPool::retain(ENetPacket* packet)
+{
+    packet->referenceCount++;
+}
+
+void cro::Detail::PacketPool::release(ENetPacket* packet)
+{
+    //received packets are handed over with no references
+    if (packet->referenceCount == 0)
+    {
+        enet_packet_destroy(packet);
+    }
+    else
+    {
+        packet->referenceCount--;
+    }
+}
+
+void cro::Detail::PacketPool::trim()
+{
+    std::scoped_lock lock(pool.mutex);
+    for (auto& list : pool.freeLists)
+    {
+        while (list)
+        {
+            auto* next = list->next;
+            std::free(reinterpret_cast<std::byte*>(list) - HeaderSize);
+            list = next;
+        }
+    }
+}
+
+cro::Util::Net::AllocationStats cro::Util::Net::getAllocationStats()
+{
+    AllocationStats stats;
+    stats.allocationCount = pool.allocationCount;
+    stats.systemAllocationCount = pool.systemAllocationCount;
+    stats.activeCount = pool.activeCount;
+    return stats;
+}
@@ -0,0 +1,57 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cstddef>
+
+struct _ENetPacket;
+
+namespace cro::Detail::PacketPool
+{
+    /*
+    Allocation callbacks installed into ENet. Requests are rounded up
+    to a power of two size class and recycled through a free list, so
+    once the pool has warmed up sending and receiving packets no longer
+    touches the system allocator. Larger requests fall back to malloc.
+    */
+    void* allocate(std::size_t);
+    void deallocate(void*);
+
+    /*
+    Packets unpacked from a batch share the batch's memory. They take
+    a reference via the packet's reference count, and this destroys
+    the packet only once the last reference has been released.
+    */
+    void retain(_ENetPacket*);
+    void release(_ENetPacket*);
+
+    //frees any unused blocks held by the pool
+    void trim();
+}
@@ -0,0 +1,100 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include "CheckApp.hpp"
+#include "FrameCheckState.hpp"
+#include "StateIDs.hpp"
+
+#include <crogine/core/AllocationCounter.hpp>
+
+CheckApp::CheckApp()
+    : m_stateStack({*this, getWindow()})
+{
+    m_stateStack.registerState<FrameCheckState>(States::ID::FrameCheck, m_result);
+}
+
+//public
+void CheckApp::handleEvent(const cro::Event& evt)
+{
+    if (evt.type == SDL_KEYUP
+        && evt.key.keysym.sym == SDLK_ESCAPE)
+    {
+        App::quit();
+    }
+
+    m_stateStack.handleEvent(evt);
+}
+
+void CheckApp::handleMessage(const cro::Message& msg)
+{
+    m_stateStack.handleMessage(msg);
+}
+
+void CheckApp::simulate(float dt)
+{
+    m_stateStack.simulate(dt);
+}
+
+void CheckApp::render()
+{
+    m_stateStack.render();
+}
+
+bool CheckApp::initialise()
+{
+    if (!cro::AllocationCounter::isAvailable())
+    {
+        LogE << "crogine was built without USE_ALLOCATION_COUNTING - the check cannot run." << std::endl;
+        return false;
+    }
+
+    getWindow().setTitle("Allocation Check");
+    m_stateStack.pushState(States::FrameCheck);
+
+    return true;
+}
+
+void CheckApp::finalise()
+{
+    m_stateStack.clearStates();
+    m_stateStack.simulate(0.f);
+
+    if (!m_result.completed)
+    {
+        LogE << "Allocation check was interrupted before it completed." << std::endl;
+    }
+    else if (m_result.allocationCount != 0)
+    {
+        LogE << "FAILED: " << m_result.allocationCount << " allocations in " << m_result.frameCount << " frames after warm-up." << std::endl;
+    }
+    else
+    {
+        LogI << "PASSED: no allocations in " << m_result.frameCount << " frames after warm-up." << std::endl;
+    }
+}
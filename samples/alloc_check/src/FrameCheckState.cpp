@@ -0,0 +1,295 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include "FrameCheckState.hpp"
+
+#include <crogine/core/AllocationCounter.hpp>
+#include <crogine/core/App.hpp>
+
+#include <crogine/ecs/components/Camera.hpp>
+#include <crogine/ecs/components/Drawable2D.hpp>
+#include <crogine/ecs/components/DynamicTreeComponent.hpp>
+#include <crogine/ecs/components/Model.hpp>
+#include <crogine/ecs/components/ParticleEmitter.hpp>
+#include <crogine/ecs/components/Transform.hpp>
+
+#include <crogine/ecs/systems/CameraSystem.hpp>
+#include <crogine/ecs/systems/DynamicTreeSystem.hpp>
+#include <crogine/ecs/systems/ModelRenderer.hpp>
+#include <crogine/ecs/systems/ParticleSystem.hpp>
+#include <crogine/ecs/systems/RenderSystem2D.hpp>
+#include <crogine/ecs/systems/ShadowMapRenderer.hpp>
+
+#include <crogine/graphics/CubeBuilder.hpp>
+
+#include <crogine/util/Constants.hpp>
+
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    constexpr std::uint64_t WarmupFrames = 180;
+    constexpr std::uint64_t CheckFrames = 600;
+
+    constexpr std::int32_t ModelRows = 10;
+    constexpr float ModelSpacing = 2.5f;
+
+    constexpr std::int32_t QuadRows = 16;
+    constexpr float QuadSize = 32.f;
+    constexpr cro::FloatRect QuadArea(0.f, 0.f, QuadRows * QuadSize * 2.f, QuadRows * QuadSize * 2.f);
+}
+
+FrameCheckState::FrameCheckState(cro::StateStack& stack, cro::State::Context context, CheckResult& result)
+    : cro::State    (stack, context),
+    m_result        (result),
+    m_gameScene     (context.appInstance.getMessageBus()),
+    m_uiScene       (context.appInstance.getMessageBus()),
+    m_quadTree      (QuadArea),
+    m_frameCount    (0),
+    m_startCount    (0),
+    m_elapsed       (0.f)
+{
+    addSystems();
+    createScene();
+    createUI();
+}
+
+//public
+bool FrameCheckState::handleEvent(const cro::Event& evt)
+{
+    m_gameScene.forwardEvent(evt);
+    m_uiScene.forwardEvent(evt);
+    return true;
+}
+
+void FrameCheckState::handleMessage(const cro::Message& msg)
+{
+    m_gameScene.forwardMessage(msg);
+    m_uiScene.forwardMessage(msg);
+}
+
+bool FrameCheckState::simulate(float dt)
+{
+    //counts the allocations made by the previous pass through
+    //the App loop, including any frames rendered since then
+    m_frameCount++;
+    if (m_frameCount == WarmupFrames)
+    {
+        m_startCount = cro::AllocationCounter::getCount();
+    }
+    else if (m_frameCount == WarmupFrames + CheckFrames)
+    {
+        m_result.allocationCount = cro::AllocationCounter::getCount() - m_startCount;
+        m_result.frameCount = CheckFrames;
+        m_result.completed = true;
+        cro::App::quit();
+    }
+
+    m_elapsed += dt;
+
+    for (auto e : m_models)
+    {
+        e.getComponent<cro::Transform>().rotate(cro::Transform::Y_AXIS, dt);
+    }
+
+    cullScene();
+
+    m_gameScene.simulate(dt);
+    m_uiScene.simulate(dt);
+    return true;
+}
+
+void FrameCheckState::render()
+{
+    m_gameScene.render();
+    m_uiScene.render();
+}
+
+//private
+void FrameCheckState::addSystems()
+{
+    auto& mb = getContext().appInstance.getMessageBus();
+    m_gameScene.addSystem<cro::DynamicTreeSystem>(mb);
+    m_gameScene.addSystem<cro::CameraSystem>(mb);
+    m_gameScene.addSystem<cro::ShadowMapRenderer>(mb);
+    m_gameScene.addSystem<cro::ModelRenderer>(mb);
+    m_gameScene.addSystem<cro::ParticleSystem>(mb);
+
+    m_uiScene.addSystem<cro::CameraSystem>(mb);
+    m_uiScene.addSystem<cro::RenderSystem2D>(mb);
+}
+
+void FrameCheckState::createScene()
+{
+    auto shaderID = m_resources.shaders.loadBuiltIn(cro::ShaderResource::VertexLit, cro::ShaderResource::DiffuseColour | cro::ShaderResource::RxShadows);
+    auto materialID = m_resources.materials.add(m_resources.shaders.get(shaderID));
+
+    shaderID = m_resources.shaders.loadBuiltIn(cro::ShaderResource::ShadowMap, cro::ShaderResource::DepthMap);
+    auto shadowMaterialID = m_resources.materials.add(m_resources.shaders.get(shaderID));
+
+    auto meshID = m_resources.meshes.loadMesh(cro::CubeBuilder());
+
+    const glm::vec3 offset(-((ModelRows - 1) * ModelSpacing) / 2.f, 0.5f, -((ModelRows - 1) * ModelSpacing) / 2.f);
+    for (auto z = 0; z < ModelRows; ++z)
+    {
+        for (auto x = 0; x < ModelRows; ++x)
+        {
+            auto material = m_resources.materials.get(materialID);
+            material.setProperty("u_colour", cro::Colour(static_cast<float>(x) / ModelRows, 0.5f, static_cast<float>(z) / ModelRows));
+
+            auto entity = m_gameScene.createEntity();
+            entity.addComponent<cro::Transform>().setPosition(offset + glm::vec3(x * ModelSpacing, 0.f, z * ModelSpacing));
+            entity.addComponent<cro::Model>(m_resources.meshes.getMesh(meshID), material);
+            entity.getComponent<cro::Model>().setShadowMaterial(0, m_resources.materials.get(shadowMaterialID));
+            entity.addComponent<cro::DynamicTreeComponent>().setArea(m_resources.meshes.getMesh(meshID).boundingBox);
+            m_models.push_back(entity);
+        }
+    }
+
+    auto material = m_resources.materials.get(materialID);
+    material.setProperty("u_colour", cro::Colour(0.2f, 0.6f, 0.2f));
+    meshID = m_resources.meshes.loadMesh(cro::CubeBuilder(glm::vec3(ModelRows * ModelSpacing * 2.f, 0.1f, ModelRows * ModelSpacing * 2.f)));
+    auto entity = m_gameScene.createEntity();
+    entity.addComponent<cro::Transform>().setPosition({ 0.f, -0.05f, 0.f });
+    entity.addComponent<cro::Model>(m_resources.meshes.getMesh(meshID), material);
+
+    cro::EmitterSettings particles;
+    particles.emitRate = 60.f;
+    particles.lifetime = 1.f;
+    particles.size = 0.1f;
+    particles.spread = 30.f;
+    particles.initialVelocity = glm::vec3(0.f, 4.f, 0.f);
+    particles.gravity = glm::vec3(0.f, -9.f, 0.f);
+    particles.colour = cro::Colour::Yellow;
+
+    const std::array EmitterPositions =
+    {
+        glm::vec3(-6.f, 0.f, -6.f),
+        glm::vec3(6.f, 0.f, -6.f),
+        glm::vec3(-6.f, 0.f, 6.f),
+        glm::vec3(6.f, 0.f, 6.f)
+    };
+
+    for (auto p : EmitterPositions)
+    {
+        entity = m_gameScene.createEntity();
+        entity.addComponent<cro::Transform>().setPosition(p);
+        entity.addComponent<cro::ParticleEmitter>().settings = particles;
+        entity.getComponent<cro::ParticleEmitter>().start();
+    }
+
+    auto resize = [](cro::Camera& cam)
+    {
+        glm::vec2 size(cro::App::getWindow().getSize());
+        cam.viewport = { 0.f, 0.f, 1.f, 1.f };
+        cam.setPerspective(60.f * cro::Util::Const::degToRad, size.x / size.y, 0.1f, 80.f);
+    };
+
+    auto& cam = m_gameScene.getActiveCamera().getComponent<cro::Camera>();
+    cam.resizeCallback = resize;
+    cam.shadowMapBuffer.create(1024, 1024);
+    cam.setShadowExpansion(10.f);
+    resize(cam);
+
+    m_gameScene.getActiveCamera().getComponent<cro::Transform>().setPosition({ 0.f, 15.f, 20.f });
+    m_gameScene.getActiveCamera().getComponent<cro::Transform>().rotate(cro::Transform::X_AXIS, -35.f * cro::Util::Const::degToRad);
+
+    m_gameScene.getSunlight().getComponent<cro::Transform>().rotate(cro::Transform::X_AXIS, -45.f * cro::Util::Const::degToRad);
+    m_gameScene.getSunlight().getComponent<cro::Transform>().rotate(cro::Transform::Y_AXIS, -25.f * cro::Util::Const::degToRad);
+}
+
+void FrameCheckState::createUI()
+{
+    for (auto y = 0; y < QuadRows; ++y)
+    {
+        for (auto x = 0; x < QuadRows; ++x)
+        {
+            const cro::Colour c(static_cast<float>(x) / QuadRows, static_cast<float>(y) / QuadRows, 1.f);
+
+            auto entity = m_uiScene.createEntity();
+            entity.addComponent<cro::Transform>().setPosition({ x * QuadSize * 2.f, y * QuadSize * 2.f });
+            entity.addComponent<cro::Drawable2D>().setVertexData(
+                {
+                    cro::Vertex2D(glm::vec2(0.f, QuadSize), c),
+                    cro::Vertex2D(glm::vec2(0.f), c),
+                    cro::Vertex2D(glm::vec2(QuadSize), c),
+                    cro::Vertex2D(glm::vec2(QuadSize, 0.f), c)
+                });
+            m_quadTree.add(entity);
+            m_drawables.push_back(entity);
+        }
+    }
+
+    auto resize = [](cro::Camera& cam)
+    {
+        glm::vec2 size(cro::App::getWindow().getSize());
+        cam.viewport = { 0.f, 0.f, 1.f, 1.f };
+        cam.setOrthographic(0.f, size.x, 0.f, size.y, -0.1f, 10.f);
+    };
+
+    auto& cam = m_uiScene.getActiveCamera().getComponent<cro::Camera>();
+    cam.resizeCallback = resize;
+    resize(cam);
+}
+
+void FrameCheckState::cullScene()
+{
+    //sweep a query area back and forth across each scene
+    //and only draw what was returned by the query
+    const float sweep = std::sin(m_elapsed);
+
+    const float modelWidth = ModelRows * ModelSpacing;
+    const glm::vec3 boxMin(sweep * modelWidth / 2.f - (modelWidth / 4.f), -1.f, -modelWidth);
+    const glm::vec3 boxMax(boxMin.x + (modelWidth / 2.f), 2.f, modelWidth);
+
+    for (auto e : m_models)
+    {
+        e.getComponent<cro::Model>().setHidden(true);
+    }
+
+    auto count = m_gameScene.getSystem<cro::DynamicTreeSystem>()->query(cro::Box(boxMin, boxMax), m_queryResults.data(), m_queryResults.size());
+    for (auto i = 0u; i < count; ++i)
+    {
+        m_queryResults[i].getComponent<cro::Model>().setHidden(false);
+    }
+
+
+    for (auto e : m_drawables)
+    {
+        e.getComponent<cro::Drawable2D>().setRenderFlags(0);
+    }
+
+    const cro::FloatRect area((sweep + 1.f) * (QuadArea.width / 4.f), 0.f, QuadArea.width / 2.f, QuadArea.height);
+    count = m_quadTree.query(area, m_queryResults.data(), m_queryResults.size());
+    for (auto i = 0u; i < count; ++i)
+    {
+        m_queryResults[i].getComponent<cro::Drawable2D>().setRenderFlags(std::numeric_limits<std::uint64_t>::max());
+    }
+}
@@ -0,0 +1,86 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include "StateIDs.hpp"
+#include "CheckResult.hpp"
+
+#include <crogine/core/State.hpp>
+#include <crogine/detail/QuadTree.hpp>
+#include <crogine/ecs/Scene.hpp>
+#include <crogine/graphics/ModelDefinition.hpp>
+
+#include <array>
+#include <vector>
+
+/*
+Builds a scene with shadow casting models, particles and 2D
+drawables, and queries the DynamicTreeSystem and a QuadTree
+every frame to cull them. Once WarmupFrames have passed the
+number of allocations is counted for CheckFrames, after which
+the app quits.
+*/
+class FrameCheckState final : public cro::State
+{
+public:
+    FrameCheckState(cro::StateStack&, cro::State::Context, CheckResult&);
+    ~FrameCheckState() = default;
+
+    cro::StateID getStateID() const override { return States::FrameCheck; }
+
+    bool handleEvent(const cro::Event&) override;
+    void handleMessage(const cro::Message&) override;
+    bool simulate(float) override;
+    void render() override;
+
+private:
+    static constexpr std::size_t MaxQueryResults = 256;
+
+    CheckResult& m_result;
+
+    cro::Scene m_gameScene;
+    cro::Scene m_uiScene;
+    cro::ResourceCollection m_resources;
+
+    cro::Detail::QuadTree m_quadTree;
+
+    std::vector<cro::Entity> m_models;
+    std::vector<cro::Entity> m_drawables;
+    std::array<cro::Entity, MaxQueryResults> m_queryResults = {};
+
+    std::uint64_t m_frameCount;
+    std::uint64_t m_startCount;
+    float m_elapsed;
+
+    void addSystems();
+    void createScene();
+    void createUI();
+    void cullScene();
+};
@@ -0,0 +1,193 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+/*
+Connects a NetClient to a NetHost over the loopback interface and
+exchanges reliable and unreliable packets, with batching enabled,
+for a fixed number of ticks. Fails if the network system allocation
+count is still increasing once the connection has warmed up, or, if
+crogine was built with USE_ALLOCATION_COUNTING, if any heap
+allocations are made at all. The exit code is 0 if the check passed.
+*/
+
+#include <crogine/core/AllocationCounter.hpp>
+#include <crogine/network/NetClient.hpp>
+#include <crogine/network/NetHost.hpp>
+#include <crogine/util/Network.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+    constexpr std::uint16_t Port = 16002;
+    constexpr std::size_t MaxChannels = 2;
+
+    constexpr std::uint64_t WarmupTicks = 500;
+    constexpr std::uint64_t CheckTicks = 2000;
+    constexpr auto TickTime = std::chrono::milliseconds(1);
+
+    namespace PacketID
+    {
+        enum
+        {
+            Input, Event, State
+        };
+    }
+
+    struct InputData final
+    {
+        std::uint32_t tick = 0;
+        std::int16_t x = 0;
+        std::int16_t y = 0;
+        std::uint16_t buttons = 0;
+    };
+
+    struct StateData final
+    {
+        std::uint32_t tick = 0;
+        std::array<std::int16_t, 3u> position = {};
+        std::array<std::int16_t, 4u> rotation = {};
+    };
+
+    //echoes everything received back to the sender, and
+    //broadcasts a state update and a batch of events every tick
+    void hostFunc(cro::NetHost& host, const std::atomic<bool>& running)
+    {
+        StateData state;
+        cro::NetEvent evt;
+
+        while (running)
+        {
+            while (host.pollEvent(evt))
+            {
+                if (evt.type == cro::NetEvent::PacketReceived)
+                {
+                    host.sendPacket(evt.peer, evt.packet.getID(), evt.packet.getData(), evt.packet.getSize(),
+                        evt.channel == 0 ? cro::NetFlag::Reliable : cro::NetFlag::Unreliable, evt.channel);
+                }
+            }
+
+            state.tick++;
+            host.broadcastPacket(PacketID::State, state, cro::NetFlag::Unreliable, 1);
+            for (auto i = 0u; i < 4u; ++i)
+            {
+                host.broadcastPacket(PacketID::Event, state.tick, cro::NetFlag::Reliable, 0);
+            }
+
+            std::this_thread::sleep_for(TickTime);
+        }
+    }
+}
+
+int main(int argc, char** argsv)
+{
+    cro::NetHost host;
+    if (!host.start("", Port, 1, MaxChannels))
+    {
+        std::cout << "Failed to start host on port " << Port << std::endl;
+        return 1;
+    }
+    host.setBatchingEnabled(true);
+
+    std::atomic<bool> running = true;
+    std::thread hostThread(hostFunc, std::ref(host), std::cref(running));
+
+    cro::NetClient client;
+    if (!client.create(MaxChannels)
+        || !client.connect("127.0.0.1", Port))
+    {
+        std::cout << "Failed to connect client to loopback host" << std::endl;
+        running = false;
+        hostThread.join();
+        return 1;
+    }
+    client.setBatchingEnabled(true);
+
+    InputData input;
+    cro::NetEvent evt;
+    std::uint64_t receivedCount = 0;
+
+    cro::Util::Net::AllocationStats startStats;
+    std::uint64_t startCount = 0;
+
+    for (auto tick = 0u; tick < WarmupTicks + CheckTicks; ++tick)
+    {
+        if (tick == WarmupTicks)
+        {
+            startStats = cro::Util::Net::getAllocationStats();
+            startCount = cro::AllocationCounter::getCount();
+        }
+
+        input.tick = tick;
+        input.x = static_cast<std::int16_t>(tick % 256);
+        client.sendPacket(PacketID::Input, input, cro::NetFlag::Unreliable, 1);
+        client.sendPacket(PacketID::Event, input.tick, cro::NetFlag::Reliable, 0);
+
+        while (client.pollEvent(evt))
+        {
+            if (evt.type == cro::NetEvent::PacketReceived)
+            {
+                receivedCount++;
+            }
+        }
+
+        std::this_thread::sleep_for(TickTime);
+    }
+
+    const auto endStats = cro::Util::Net::getAllocationStats();
+    const auto allocationCount = cro::AllocationCounter::getCount() - startCount;
+
+    running = false;
+    hostThread.join();
+    client.disconnect();
+
+    const auto systemCount = endStats.systemAllocationCount - startStats.systemAllocationCount;
+    std::cout << "Received " << receivedCount << " packets, " << (endStats.allocationCount - startStats.allocationCount) << " pool allocations, "
+        << systemCount << " system allocations after warm-up" << std::endl;
+
+    bool passed = (receivedCount != 0 && systemCount == 0);
+
+    if (cro::AllocationCounter::isAvailable())
+    {
+        std::cout << allocationCount << " heap allocations after warm-up" << std::endl;
+        passed = passed && allocationCount == 0;
+    }
+    else
+    {
+        std::cout << "crogine was built without USE_ALLOCATION_COUNTING, only network allocations were counted" << std::endl;
+    }
+
+    std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed ? 0 : 1;
+}
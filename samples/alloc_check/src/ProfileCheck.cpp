@@ -0,0 +1,111 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+/*
+Writes an empty profiler capture, and a capture containing a single
+zone, and checks that both can be parsed as Chrome trace JSON. The
+exit code is 0 if the check passed.
+*/
+
+#include <crogine/core/Profiler.hpp>
+
+#include "detail/json.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    //returns the number of trace events, or -1 if the capture is invalid
+    std::int32_t readCapture(const std::string& path)
+    {
+        std::ifstream file(path);
+        if (!file.is_open())
+        {
+            std::cout << "Failed opening " << path << std::endl;
+            return -1;
+        }
+
+        std::stringstream ss;
+        ss << file.rdbuf();
+        file.close();
+        std::filesystem::remove(path);
+
+        const auto json = nlohmann::json::parse(ss.str(), nullptr, false);
+        if (json.is_discarded())
+        {
+            std::cout << path << " is not valid JSON:\n" << ss.str() << std::endl;
+            return -1;
+        }
+
+        if (!json.contains("traceEvents")
+            || !json["traceEvents"].is_array())
+        {
+            std::cout << path << " has no traceEvents array" << std::endl;
+            return -1;
+        }
+
+        return static_cast<std::int32_t>(json["traceEvents"].size());
+    }
+}
+
+int main(int argc, char** argsv)
+{
+    const auto path = (std::filesystem::temp_directory_path() / "cro_profile_check.json").string();
+
+    //nothing was recorded, so there are no thread names or zones
+    cro::Profiler::beginCapture();
+    if (!cro::Profiler::endCapture(path)
+        || readCapture(path) != 0)
+    {
+        std::cout << "Empty capture failed" << std::endl;
+        return 1;
+    }
+
+    cro::Profiler::setThreadName("Profile Check");
+    cro::Profiler::beginCapture();
+    {
+        CRO_PROFILE_SCOPE("ProfileCheck");
+    }
+    cro::Profiler::collect();
+
+    if (!cro::Profiler::endCapture(path)
+        || readCapture(path) < 1)
+    {
+        std::cout << "Capture with one zone failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Profiler captures are valid" << std::endl;
+    return 0;
+}
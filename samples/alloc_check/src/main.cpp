@@ -0,0 +1,45 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include "CheckApp.hpp"
+
+/*
+Runs a small scene for a fixed number of frames and fails
+if any heap allocations are made once the scene has warmed
+up. Requires crogine to be built with USE_ALLOCATION_COUNTING.
+The exit code is 0 if the check passed, else 1.
+*/
+
+int main(int argc, char** argsv)
+{
+    CheckApp app;
+    app.run();
+
+    return app.getResult().getExitCode();
+}
@@ -779,6 +779,22 @@ bool GolfGame::initialise()
     //do this first because if we quit early the preferences will otherwise get overwritten by defaults.
     loadPreferences();
 
+    if (m_sharedData.benchmark.enabled)
+    {
+        //GolfState renders the scene to a texture of the benchmark resolution
+        //whatever the window size is - the window is only resized so that the
+        //UI is drawn at the same size. None of this affects the player's settings.
+        setSaveSettingsEnabled(false);
+        getWindow().setFullScreen(false);
+        getWindow().setSize(m_sharedData.benchmark.resolution);
+        getWindow().setVsyncEnabled(false);
+        m_sharedData.pixelScale = false;
+
+        m_sharedData.nightTime = m_sharedData.benchmark.nightTime ? 1 : 0;
+        m_sharedData.logBenchmarks = false;
+        m_sharedData.fastCPU = true;
+    }
+
     if (!initResult)
     {
         //no point trying to load the menu if we failed to init.
@@ -1086,6 +1102,42 @@ bool GolfGame::initialise()
             cro::Console::print(WebSock::getStatus());
         });
 
+    registerCommand("sv_spectator_relay", [&](const std::string& param)
+        {
+            if (param == "true")
+            {
+                m_sharedData.serverInstance.setSpectatorRelayEnabled(true);
+            }
+            else if (param == "false")
+            {
+                m_sharedData.serverInstance.setSpectatorRelayEnabled(false);
+            }
+            else
+            {
+                cro::Console::print("Usage: sv_spectator_relay <true|false>");
+            }
+
+            cro::Console::print(m_sharedData.serverInstance.getSpectatorRelayEnabled() ?
+                "Spectator relay will be hosted on port " + std::to_string(ConstVal::SpectatorPort) + " next time a game is hosted" :
+                "Spectator relay is disabled");
+        });
+
+    registerCommand("net_alloc_stats", [](const std::string&)
+        {
+            //once a game is under way the system count should
+            //no longer change between calls to this
+            static cro::Util::Net::AllocationStats lastStats;
+            const auto stats = cro::Util::Net::getAllocationStats();
+
+            cro::Console::print("Network allocations: " + std::to_string(stats.allocationCount)
+                + " (+" + std::to_string(stats.allocationCount - lastStats.allocationCount) + ")");
+            cro::Console::print("System allocations: " + std::to_string(stats.systemAllocationCount)
+                + " (+" + std::to_string(stats.systemAllocationCount - lastStats.systemAllocationCount) + ")");
+            cro::Console::print("Active allocations: " + std::to_string(stats.activeCount));
+
+            lastStats = stats;
+        });
+
     registerCommand("scrub", 
         [&](const std::string&)
         {
@@ -1122,6 +1174,10 @@ bool GolfGame::initialise()
     cro::AudioMixer::setLabel("Text To Speech", MixerChannel::TextToSpeech);
 
     m_sharedData.clientConnection.netClient.create(ConstVal::MaxClients);
+#ifndef USE_GNS
+    //the server batches its reliable updates
+    m_sharedData.clientConnection.netClient.setBatchingEnabled(true);
+#endif
     m_sharedData.sharedResources = std::make_unique<cro::ResourceCollection>();
 
     //texture used to hold name tags
@@ -1239,19 +1295,27 @@ bool GolfGame::initialise()
 
     m_activeIndex = m_sharedData.postProcessIndex;
 
+    if (m_sharedData.benchmark.enabled)
+    {
+        //the menu launches the benchmark as soon as it's loaded
+        m_stateStack.pushState(StateID::Menu);
+    }
+    else
+    {
 #ifdef CRO_DEBUG_
-    m_stateStack.pushState(StateID::Menu);
-    //m_stateStack.pushState(StateID::Bush);
-    //m_stateStack.pushState(StateID::Clubhouse);
-    //m_stateStack.pushState(StateID::SplashScreen);
-    //m_stateStack.pushState(StateID::Shop);
-    //m_stateStack.pushState(StateID::SBallBackground);
-    //m_stateStack.pushState(StateID::EndlessAttract);
-    //m_stateStack.pushState(StateID::Workshop);
+        m_stateStack.pushState(StateID::Menu);
+        //m_stateStack.pushState(StateID::Bush);
+        //m_stateStack.pushState(StateID::Clubhouse);
+        //m_stateStack.pushState(StateID::SplashScreen);
+        //m_stateStack.pushState(StateID::Shop);
+        //m_stateStack.pushState(StateID::SBallBackground);
+        //m_stateStack.pushState(StateID::EndlessAttract);
+        //m_stateStack.pushState(StateID::Workshop);
 #else
-    m_stateStack.pushState(StateID::SplashScreen);
-    //m_stateStack.pushState(StateID::Clubhouse);
+        m_stateStack.pushState(StateID::SplashScreen);
+        //m_stateStack.pushState(StateID::Clubhouse);
 #endif
+    }
 
     applyImGuiStyle(m_sharedData);
 
@@ -1969,6 +2033,12 @@ void GolfGame::loadPreferences()
 
 void GolfGame::savePreferences()
 {
+    if (m_sharedData.benchmark.enabled)
+    {
+        //the benchmark overrides some settings which shouldn't be kept
+        return;
+    }
+
     auto path = getPreferencePath() + "prefs.cfg";
     cro::ConfigFile cfg("preferences");
 
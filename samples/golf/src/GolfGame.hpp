@@ -64,6 +64,7 @@ public:
     void unloadPlugin() { cro::App::unloadPlugin(m_stateStack); }
 
     void setSafeModeEnabled(bool sm);
+    void setBenchmarkSettings(const SharedStateData::BenchmarkSettings& settings) { m_sharedData.benchmark = settings; }
 private:
     //cro::Cursor m_cursor;
 
@@ -140,15 +140,18 @@ void WebSock::stop()
     }
 }
 
-void WebSock::broadcastPacket(const std::vector<std::byte>& packet)
+void WebSock::broadcastPacket(const std::byte* data, std::size_t size)
 {
     if (server &&
         server->server)
     {
+        //the send data only wraps the buffer, so the same one is shared by all clients
+        const ix::IXWebSocketSendData sendData(reinterpret_cast<const char*>(data), size);
+
         auto sockets = server->server->getClients();
         for (auto& socket : sockets)
         {
-            socket->sendBinary(ix::IXWebSocketSendData(reinterpret_cast<const char*>(packet.data()), packet.size()));
+            socket->sendBinary(sendData);
         }
     }
 }
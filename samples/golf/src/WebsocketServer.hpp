@@ -29,6 +29,7 @@ source distribution.
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <cstddef>
 #include <cstring>
@@ -48,15 +49,17 @@ public:
     static void stop();
 
     //send to all connected clients
-    static void broadcastPacket(const std::vector<std::byte>& data);
+    static void broadcastPacket(const std::byte* data, std::size_t size);
+    static void broadcastPacket(const std::vector<std::byte>& data) { broadcastPacket(data.data(), data.size()); }
     
     template <typename T>
     static void broadcastPacket(std::uint8_t packetID, const T& data)
     {
-        std::vector<std::byte> p(sizeof(data) + 1);
+        //size is known at compile time so we don't need to allocate
+        std::array<std::byte, sizeof(data) + 1> p = {};
         p[0] = static_cast<std::byte>(packetID);
         std::memcpy(&p[1], &data, sizeof(data));
-        broadcastPacket(p);
+        broadcastPacket(p.data(), p.size());
     }
 
     static void broadcastPlayers(const SharedStateData&);
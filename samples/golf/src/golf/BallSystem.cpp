@@ -29,6 +29,7 @@ source distribution.
 
 #include "BallSystem.hpp"
 #include "Terrain.hpp"
+#include "BvhCache.hpp"
 #include "HoleData.hpp"
 #include "GameConsts.hpp"
 #include "MessageIDs.hpp"
@@ -1640,7 +1641,7 @@ bool BallSystem::updateCollisionMesh(const std::string& modelPath)
 
 
         m_groundVertices.emplace_back(std::make_unique<btTriangleIndexVertexArray>())->addIndexedMesh(groundMesh);
-        m_groundShapes.emplace_back(std::make_unique<btBvhTriangleMeshShape>(m_groundVertices.back().get(), false));
+        m_groundShapes.emplace_back(BvhCache::createShape(*m_groundVertices.back()));
         m_groundObjects.emplace_back(std::make_unique<btPairCachingGhostObject>())->setCollisionShape(m_groundShapes.back().get());
         m_groundObjects.back()->setUserIndex(colourOffset); //use to read the terrain type in RayResult
         m_collisionWorld->addCollisionObject(m_groundObjects.back().get(), CollisionGroup::Terrain, CollisionGroup::Ball);
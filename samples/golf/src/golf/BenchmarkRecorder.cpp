@@ -0,0 +1,237 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+Super Video Golf - zlib licence.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+
+#include "BenchmarkRecorder.hpp"
+
+#include <crogine/core/Log.hpp>
+#include <crogine/detail/Types.hpp>
+
+#include <SDL_rwops.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace
+{
+    const std::array<std::string, BenchmarkRecorder::Phase::Complete> PhaseNames =
+    {
+        "none", "intro", "flythrough", "play"
+    };
+
+    std::string escape(const std::string& str)
+    {
+        std::string ret;
+        for (auto c : str)
+        {
+            switch (c)
+            {
+            default:
+                if (static_cast<unsigned char>(c) >= 0x20)
+                {
+                    ret.push_back(c);
+                }
+                break;
+            case '"':
+                ret += "\\\"";
+                break;
+            case '\\':
+                ret += "\\\\";
+                break;
+            }
+        }
+        return ret;
+    }
+
+    //appends the frame time statistics of the given samples as a JSON object
+    void writeStats(std::string& out, std::vector<float> frameTimes, float simTime, std::uint32_t simSteps)
+    {
+        out += "{\"frames\":" + std::to_string(frameTimes.size())
+            + ",\"sim_steps\":" + std::to_string(simSteps)
+            + ",\"sim_time_s\":" + std::to_string(simTime);
+
+        if (!frameTimes.empty())
+        {
+            std::sort(frameTimes.begin(), frameTimes.end());
+            const auto percentile = [&frameTimes](float p)
+            {
+                //nearest rank
+                auto idx = static_cast<std::size_t>(std::ceil(p * frameTimes.size()));
+                return frameTimes[std::clamp(idx, std::size_t(1), frameTimes.size()) - 1];
+            };
+
+            const float total = std::accumulate(frameTimes.begin(), frameTimes.end(), 0.f);
+            const float mean = total / frameTimes.size();
+
+            out += ",\"mean_fps\":" + std::to_string(1000.f / mean)
+                + ",\"min_ms\":" + std::to_string(frameTimes.front())
+                + ",\"mean_ms\":" + std::to_string(mean)
+                + ",\"p50_ms\":" + std::to_string(percentile(0.5f))
+                + ",\"p90_ms\":" + std::to_string(percentile(0.9f))
+                + ",\"p95_ms\":" + std::to_string(percentile(0.95f))
+                + ",\"p99_ms\":" + std::to_string(percentile(0.99f))
+                + ",\"max_ms\":" + std::to_string(frameTimes.back());
+        }
+        out += "}";
+    }
+}
+
+void BenchmarkRecorder::setPhase(std::int32_t phase)
+{
+    if (phase <= m_phase)
+    {
+        return;
+    }
+
+    if (m_phase == Phase::None)
+    {
+        cro::Profiler::beginSummary();
+        cro::GPUProfiler::beginSummary();
+    }
+
+    m_phase = phase;
+    m_frameTimer.restart();
+
+    if (m_phase == Phase::Complete)
+    {
+        m_cpuZones = cro::Profiler::endSummary();
+        m_gpuPasses = cro::GPUProfiler::endSummary();
+    }
+}
+
+void BenchmarkRecorder::addFrame()
+{
+    const float frameTime = m_frameTimer.restart() * 1000.f;
+
+    if (m_phase != Phase::None
+        && m_phase != Phase::Complete)
+    {
+        m_phaseData[m_phase].frameTimes.push_back(frameTime);
+    }
+}
+
+void BenchmarkRecorder::update(float dt)
+{
+    if (m_phase != Phase::None
+        && m_phase != Phase::Complete)
+    {
+        m_phaseData[m_phase].simTime += dt;
+        m_phaseData[m_phase].simSteps++;
+    }
+}
+
+std::uint32_t BenchmarkRecorder::getPhaseSteps() const
+{
+    if (m_phase != Phase::None
+        && m_phase != Phase::Complete)
+    {
+        return m_phaseData[m_phase].simSteps;
+    }
+    return 0;
+}
+
+bool BenchmarkRecorder::write(const std::string& path, const Info& info) const
+{
+    std::string out = "{\n\"info\":{";
+    for (const auto& [key, value] : info)
+    {
+        out += "\"" + escape(key) + "\":\"" + escape(value) + "\",";
+    }
+    if (!info.empty())
+    {
+        out.pop_back();
+    }
+    out += "},\n";
+
+    std::vector<float> allFrames;
+    float allTime = 0.f;
+    std::uint32_t allSteps = 0;
+
+    out += "\"phases\":{\n";
+    for (std::int32_t i = Phase::Intro; i < Phase::Complete; ++i)
+    {
+        const auto& data = m_phaseData[i];
+        allFrames.insert(allFrames.end(), data.frameTimes.begin(), data.frameTimes.end());
+        allTime += data.simTime;
+        allSteps += data.simSteps;
+
+        out += "\"" + PhaseNames[i] + "\":";
+        writeStats(out, data.frameTimes, data.simTime, data.simSteps);
+        out += (i + 1 < Phase::Complete) ? ",\n" : "\n";
+    }
+    out += "},\n\"overall\":";
+    writeStats(out, std::move(allFrames), allTime, allSteps);
+    out += ",\n";
+
+    out += "\"cpu_zones\":[\n";
+    for (const auto& zone : m_cpuZones)
+    {
+        out += "{\"thread\":\"" + escape(zone.thread) + "\",\"name\":\"" + escape(zone.name)
+            + "\",\"depth\":" + std::to_string(zone.depth)
+            + ",\"avg_ms\":" + std::to_string(zone.averageMs)
+            + ",\"max_ms\":" + std::to_string(zone.maxMs)
+            + ",\"calls\":" + std::to_string(zone.calls) + "},\n";
+    }
+    if (!m_cpuZones.empty())
+    {
+        out.pop_back();
+        out.pop_back();
+        out += "\n";
+    }
+    out += "],\n";
+
+    out += "\"gpu_passes\":[\n";
+    for (const auto& pass : m_gpuPasses)
+    {
+        out += "{\"name\":\"" + escape(pass.name)
+            + "\",\"depth\":" + std::to_string(pass.depth)
+            + ",\"inclusive_ms\":" + std::to_string(pass.inclusiveMs)
+            + ",\"exclusive_ms\":" + std::to_string(pass.exclusiveMs) + "},\n";
+    }
+    if (!m_gpuPasses.empty())
+    {
+        out.pop_back();
+        out.pop_back();
+        out += "\n";
+    }
+    out += "]\n}\n";
+
+    cro::RaiiRWops file;
+    file.file = SDL_RWFromFile(path.c_str(), "w");
+    if (file.file)
+    {
+        SDL_RWwrite(file.file, out.data(), out.size(), 1);
+        LogI << "Wrote benchmark results to " << path << std::endl;
+        return true;
+    }
+
+    LogE << "Failed opening " << path << " for writing benchmark results: " << SDL_GetError() << std::endl;
+    return false;
+}
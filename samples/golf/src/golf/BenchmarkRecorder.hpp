@@ -0,0 +1,92 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+Super Video Golf - zlib licence.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <crogine/core/HiResTimer.hpp>
+#include <crogine/core/Profiler.hpp>
+#include <crogine/graphics/GPUProfiler.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+//records the frame times of each phase of a benchmark run
+//along with a summary of the CPU profiler zones and GPU passes
+//and writes the results as JSON when the run is complete
+class BenchmarkRecorder final
+{
+public:
+    struct Phase final
+    {
+        enum
+        {
+            None, Intro, FlyThrough, Play,
+            Complete
+        };
+    };
+
+    using Info = std::vector<std::pair<std::string, std::string>>;
+
+    //starts the given phase. Moving from Phase::None starts the
+    //profiler summaries, and moving to Phase::Complete ends them
+    void setPhase(std::int32_t phase);
+    std::int32_t getPhase() const { return m_phase; }
+
+    //call once per rendered frame
+    void addFrame();
+
+    //call with the fixed simulation step
+    void update(float dt);
+
+    //number of fixed simulation steps taken in the current phase
+    std::uint32_t getPhaseSteps() const;
+
+    //writes the results to the given path, including the key/value
+    //pairs of info which describe the run. Call after Phase::Complete
+    bool write(const std::string& path, const Info& info) const;
+
+private:
+    std::int32_t m_phase = Phase::None;
+
+    struct PhaseData final
+    {
+        std::vector<float> frameTimes; //ms
+        float simTime = 0.f;
+        std::uint32_t simSteps = 0;
+    };
+    std::array<PhaseData, Phase::Complete> m_phaseData = {};
+
+    cro::HiResTimer m_frameTimer;
+
+    std::vector<cro::Profiler::SummaryZone> m_cpuZones;
+    std::vector<cro::GPUProfiler::Result> m_gpuPasses;
+};
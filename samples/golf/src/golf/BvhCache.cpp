@@ -0,0 +1,253 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+Super Video Golf - zlib licence.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+
+#include "BvhCache.hpp"
+#include "spooky2.hpp"
+
+#include <crogine/core/App.hpp>
+#include <crogine/core/FileSystem.hpp>
+#include <crogine/core/Log.hpp>
+#include <crogine/detail/Types.hpp>
+
+#include <mutex>
+#include <sstream>
+#include <iomanip>
+#include <unordered_map>
+
+namespace
+{
+    constexpr std::uint32_t CacheMagic = 0x43485642; //BVHC
+    constexpr std::uint32_t CacheVersion = 1;
+    const std::string CacheDir("cache/bvh/");
+
+    struct CacheHeader final
+    {
+        std::uint32_t magic = CacheMagic;
+        std::uint32_t version = CacheVersion;
+        std::uint64_t hash = 0;
+        std::uint32_t size = 0;
+        std::uint32_t padding = 0;
+    };
+    static_assert(sizeof(CacheHeader) == 24);
+
+    //the BVH is deserialised into this buffer, so it has
+    //to stay alive as long as any shape is using it
+    struct BvhData final
+    {
+        void* buffer = nullptr;
+        btQuantizedBvh* bvh = nullptr;
+
+        BvhData() = default;
+        BvhData(const BvhData&) = delete;
+        BvhData& operator = (const BvhData&) = delete;
+
+        ~BvhData()
+        {
+            if (bvh)
+            {
+                bvh->~btQuantizedBvh();
+            }
+
+            if (buffer)
+            {
+                btAlignedFree(buffer);
+            }
+        }
+    };
+
+    class CachedShape final : public btBvhTriangleMeshShape
+    {
+    public:
+        CachedShape(btTriangleIndexVertexArray& meshInterface, std::shared_ptr<BvhData> data)
+            : btBvhTriangleMeshShape(&meshInterface, true, false),
+            m_data(data)
+        {
+            //Bullet's own in place loading does this cast, as btOptimizedBvh adds no data
+            setOptimizedBvh(static_cast<btOptimizedBvh*>(m_data->bvh));
+        }
+
+    private:
+        std::shared_ptr<BvhData> m_data;
+    };
+
+    std::mutex cacheMutex;
+    std::unordered_map<std::uint64_t, std::weak_ptr<BvhData>> memoryCache;
+
+    std::uint64_t hashMesh(btTriangleIndexVertexArray& meshInterface)
+    {
+        //the serialised layout depends on the build, so include that in the seed
+        std::uint64_t hash = (CacheVersion << 24) | (sizeof(void*) << 16) | (sizeof(btScalar) << 8);
+        hash ^= static_cast<std::uint64_t>(sizeof(btQuantizedBvh)) << 32;
+
+        auto& meshes = meshInterface.getIndexedMeshArray();
+        for (auto i = 0; i < meshes.size(); ++i)
+        {
+            const auto& mesh = meshes[i];
+            hash = SpookyHash::Hash64(mesh.m_vertexBase, static_cast<std::size_t>(mesh.m_numVertices) * mesh.m_vertexStride, hash);
+            hash = SpookyHash::Hash64(mesh.m_triangleIndexBase, static_cast<std::size_t>(mesh.m_numTriangles) * mesh.m_triangleIndexStride, hash);
+        }
+        return hash;
+    }
+
+    std::string getCachePath(std::uint64_t hash)
+    {
+        std::stringstream ss;
+        ss << cro::App::getPreferencePath() << CacheDir << std::hex << std::setw(16) << std::setfill('0') << hash << ".bvh";
+        return ss.str();
+    }
+
+    std::shared_ptr<BvhData> deserialise(void* buffer, std::uint32_t size)
+    {
+        auto data = std::make_shared<BvhData>();
+        data->buffer = buffer;
+        data->bvh = btQuantizedBvh::deSerializeInPlace(buffer, size, false);
+
+        if (!data->bvh)
+        {
+            return nullptr;
+        }
+        return data;
+    }
+
+    std::shared_ptr<BvhData> loadCache(std::uint64_t hash)
+    {
+        const auto path = getCachePath(hash);
+        if (!cro::FileSystem::fileExists(path))
+        {
+            return nullptr;
+        }
+
+        cro::RaiiRWops file;
+        file.file = SDL_RWFromFile(path.c_str(), "rb");
+        if (!file.file)
+        {
+            return nullptr;
+        }
+
+        CacheHeader header;
+        if (SDL_RWread(file.file, &header, sizeof(header), 1) == 0
+            || header.magic != CacheMagic
+            || header.version != CacheVersion
+            || header.hash != hash
+            || header.size == 0
+            || SDL_RWsize(file.file) != static_cast<Sint64>(sizeof(header) + header.size))
+        {
+            LogW << path << ": invalid BVH cache file, rebuilding..." << std::endl;
+            return nullptr;
+        }
+
+        auto* buffer = btAlignedAlloc(header.size, 16);
+        if (SDL_RWread(file.file, buffer, header.size, 1) == 0)
+        {
+            btAlignedFree(buffer);
+            return nullptr;
+        }
+
+        return deserialise(buffer, header.size);
+    }
+
+    std::shared_ptr<BvhData> buildCache(btTriangleIndexVertexArray& meshInterface, std::uint64_t hash)
+    {
+        btBvhTriangleMeshShape shape(&meshInterface, true);
+        const auto* bvh = shape.getOptimizedBvh();
+
+        CacheHeader header;
+        header.hash = hash;
+        header.size = bvh->calculateSerializeBufferSize();
+
+        auto* buffer = btAlignedAlloc(header.size, 16);
+        if (!bvh->serialize(buffer, header.size, false))
+        {
+            btAlignedFree(buffer);
+            return nullptr;
+        }
+
+        //write this before deserialising, which modifies the buffer
+        const auto dir = cro::App::getPreferencePath() + CacheDir;
+        if (!cro::FileSystem::directoryExists(dir))
+        {
+            cro::FileSystem::createDirectory(dir);
+        }
+
+        const auto path = getCachePath(hash);
+        cro::RaiiRWops file;
+        file.file = SDL_RWFromFile(path.c_str(), "wb");
+        if (file.file)
+        {
+            if (SDL_RWwrite(file.file, &header, sizeof(header), 1) == 0
+                || SDL_RWwrite(file.file, buffer, header.size, 1) == 0)
+            {
+                LogW << "Failed writing BVH cache " << path << std::endl;
+            }
+        }
+        else
+        {
+            LogW << "Unable to open " << path << " for writing" << std::endl;
+        }
+
+        return deserialise(buffer, header.size);
+    }
+}
+
+std::unique_ptr<btBvhTriangleMeshShape> BvhCache::createShape(btTriangleIndexVertexArray& meshInterface)
+{
+    const auto hash = hashMesh(meshInterface);
+
+    std::shared_ptr<BvhData> data;
+    {
+        //held while building so that the server and client threads
+        //don't both build the same mesh - the second will find it in memory
+        std::scoped_lock lock(cacheMutex);
+
+        data = memoryCache[hash].lock();
+        if (!data)
+        {
+            data = loadCache(hash);
+        }
+
+        if (!data)
+        {
+            data = buildCache(meshInterface, hash);
+        }
+
+        if (data)
+        {
+            memoryCache[hash] = data;
+        }
+    }
+
+    if (!data)
+    {
+        LogW << "Failed creating cached BVH, falling back to building in place" << std::endl;
+        return std::make_unique<btBvhTriangleMeshShape>(&meshInterface, true);
+    }
+
+    return std::make_unique<CachedShape>(meshInterface, data);
+}
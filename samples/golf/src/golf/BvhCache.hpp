@@ -0,0 +1,50 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+Super Video Golf - zlib licence.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+
+#pragma once
+
+#include <btBulletCollisionCommon.h>
+
+#include <memory>
+
+/*
+Creates triangle mesh collision shapes whose quantized BVH is
+loaded in place from a cache file keyed by a hash of the mesh data.
+The BVH is only built (and the cache written) the first time a
+mesh is seen. BVHs are also shared in memory, so the server and
+client loading the same hole only read the cache once.
+
+This is thread safe, and the mesh interface must outlive the
+returned shape, as is usual with Bullet.
+*/
+namespace BvhCache
+{
+    std::unique_ptr<btBvhTriangleMeshShape> createShape(btTriangleIndexVertexArray& meshInterface);
+}
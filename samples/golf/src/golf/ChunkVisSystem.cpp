@@ -131,6 +131,8 @@ void ChunkVisSystem::process(float)
     {
         m_terrainBuilder->onChunkUpdate(m_indexList);
     }
+
+    m_terrainBuilder->updateTerrainLod(camPos);
 }
 
 void ChunkVisSystem::setWorldHeight(float h)
@@ -29,6 +29,7 @@ source distribution.
 
 #include "CollisionMesh.hpp"
 #include "RayResultCallback.hpp"
+#include "BvhCache.hpp"
 #include "GameConsts.hpp"
 
 #include <crogine/detail/glm/mat4x4.hpp>
@@ -78,7 +79,7 @@ void CollisionMesh::updateCollisionMesh(const cro::Mesh::Data& meshData)
         groundMesh.m_triangleIndexStride = 3 * sizeof(std::uint32_t);
 
         m_groundVertices.emplace_back(std::make_unique<btTriangleIndexVertexArray>())->addIndexedMesh(groundMesh);
-        m_groundShapes.emplace_back(std::make_unique<btBvhTriangleMeshShape>(m_groundVertices.back().get(), false));
+        m_groundShapes.emplace_back(BvhCache::createShape(*m_groundVertices.back()));
         m_groundObjects.emplace_back(std::make_unique<btPairCachingGhostObject>())->setCollisionShape(m_groundShapes.back().get());
         m_groundObjects.back()->setUserIndex(colourOffset); //used by RayResultCallback to read the terrain type
         m_collisionWorld->addCollisionObject(m_groundObjects.back().get(), CollisionGroup::Terrain, CollisionGroup::Ball);
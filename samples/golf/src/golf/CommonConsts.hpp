@@ -78,6 +78,7 @@ namespace ConstVal
     static constexpr std::uint16_t GamePort = 16002;
 #endif
     static constexpr std::uint16_t VoicePort = GamePort + 5;
+    static constexpr std::uint16_t SpectatorPort = GamePort + 6;
     static constexpr std::uint8_t MaxClients = 16;
     static constexpr std::uint8_t MaxPlayers = 8;
     static constexpr std::uint8_t NullValue = 255;
@@ -428,6 +428,7 @@ DrivingState::DrivingState(cro::StateStack& stack, cro::State::Context context,
 
 DrivingState::~DrivingState()
 {
+    cro::GPUReadback::cancel(m_foliageReadback);
     m_sharedData.activeResources = nullptr;
 }
 
@@ -1094,7 +1095,7 @@ void DrivingState::handleMessage(const cro::Message& msg)
                 {
                     m_cameras[i].getComponent<cro::Camera>().setMaxShadowDistance(getMaxShadowDistance(i, m_sharedData.shadowQuality));
                     m_cameras[i].getComponent<cro::Camera>().shadowMapBuffer.create(shadowRes, shadowRes);
-                    m_cameras[i].getComponent<cro::Camera>().setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+                    applyShadowPreset(m_cameras[i].getComponent<cro::Camera>(), m_sharedData.shadowQuality);
                 }
             }
         }
@@ -2061,7 +2062,7 @@ void DrivingState::createScene()
 
     cam.setMaxShadowDistance(getMaxShadowDistance(CameraID::Player, m_sharedData.shadowQuality));
     cam.setShadowExpansion(30.f);
-    cam.setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+    applyShadowPreset(cam, m_sharedData.shadowQuality);
     cam.setRenderFlags(cro::Camera::Pass::Final, ~RenderFlags::MiniMap);
     m_cameras[CameraID::Player] = camEnt;
 
@@ -2167,7 +2168,7 @@ void DrivingState::createScene()
     
     setPerspective(camEnt.getComponent<cro::Camera>());
     camEnt.getComponent<cro::Camera>().setMaxShadowDistance(80.f);
-    camEnt.getComponent<cro::Camera>().setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+    applyShadowPreset(camEnt.getComponent<cro::Camera>(), m_sharedData.shadowQuality);
     camEnt.getComponent<cro::Camera>().active = false;
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Final, ~RenderFlags::MiniMap);
     camEnt.getComponent<cro::Camera>().shadowMapBuffer.create(ShadowMapSize, ShadowMapSize);
@@ -2195,7 +2196,7 @@ void DrivingState::createScene()
     camEnt.getComponent<cro::Camera>().active = false;
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Final, ~RenderFlags::MiniMap);
     camEnt.getComponent<cro::Camera>().setMaxShadowDistance(getMaxShadowDistance(CameraID::Green, m_sharedData.shadowQuality));
-    camEnt.getComponent<cro::Camera>().setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+    applyShadowPreset(camEnt.getComponent<cro::Camera>(), m_sharedData.shadowQuality);
     camEnt.getComponent<cro::Camera>().shadowMapBuffer.create(ShadowMapSize, ShadowMapSize);
     camEnt.addComponent<cro::CommandTarget>().ID = CommandID::SpectatorCam;
     camEnt.addComponent<CameraFollower>().radius = 20.f * 20.f;
@@ -2227,7 +2228,7 @@ void DrivingState::createScene()
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Final, ~RenderFlags::MiniMap);
     camEnt.getComponent<cro::Camera>().setMaxShadowDistance(getMaxShadowDistance(CameraID::Idle, m_sharedData.shadowQuality));
     camEnt.getComponent<cro::Camera>().setShadowExpansion(50.f);
-    camEnt.getComponent<cro::Camera>().setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+    applyShadowPreset(camEnt.getComponent<cro::Camera>(), m_sharedData.shadowQuality);
     camEnt.addComponent<cro::AudioListener>();
     camEnt.addComponent<TargetInfo>();
     camEnt.addComponent<cro::Callback>().setUserData<CameraFollower::ZoomData>();
@@ -2341,69 +2342,25 @@ void DrivingState::createFoliage(cro::Entity terrainEnt)
     glCheck(glDeleteVertexArrays(vaoCount, vaos.data()));
 
 
-    std::vector<float> normalMapValues(normalMap.getSize().x * normalMap.getSize().y * 4);
-    glBindTexture(GL_TEXTURE_2D, normalMap.getTexture(1).textureID);
-    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_FLOAT, normalMapValues.data());
-
-
 #ifdef CRO_DEBUG_
     //m_debugHeightmap.loadFromImage(normalMapImage);
 #endif
 
-    const auto readHeightMap = [&](std::uint32_t x, std::uint32_t y)
+    //billboards are placed once the height map has been read
+    //back from the GPU, so for now just record where they go
+    struct FoliageArea final
     {
-        auto size = normalMap.getSize();
-        x = std::min(size.x - 1, std::max(0u, x));
-        y = std::min(size.y - 1, std::max(0u, y));
-
-        auto idx = 4 * (y * size.x + x);
-        return normalMapValues[idx + 3];
+        cro::Entity entity;
+        std::array<float, 2u> minBounds = {};
+        std::array<float, 2u> maxBounds = {};
+        float radius = 0.f;
+        glm::vec2 centre = glm::vec2(0.f);
     };
+    std::vector<FoliageArea> foliageAreas;
 
     auto createBillboards = [&](cro::Entity dst, std::array<float, 2u> minBounds, std::array<float, 2u> maxBounds, float radius = 0.f, glm::vec2 centre = glm::vec2(0.f))
     {
-        auto trees = pd::PoissonDiskSampling(4.f, minBounds, maxBounds);
-        auto flowers = pd::PoissonDiskSampling(2.f, minBounds, maxBounds);
-        std::vector<cro::Billboard> billboards;
-
-        glm::vec3 offsetPos = dst.getComponent<cro::Transform>().getPosition();
-        static constexpr glm::vec2 centreOffset(140.f, 125.f);
-
-        const float radSqr = radius * radius;
-
-        for (auto [x, y] : trees)
-        {
-            glm::vec2 radPos(x, y);
-            auto len2 = glm::length2(radPos - centre);
-
-            if (len2 < radSqr) continue;
-
-            glm::vec2 mapPos(offsetPos.x + x, -offsetPos.z + y);
-            mapPos += centreOffset;
-
-            float scale = static_cast<float>(cro::Util::Random::value(12, 22)) / 10.f;
-            auto& bb = billboards.emplace_back(m_billboardTemplates[cro::Util::Random::value(BillboardID::Tree01, BillboardID::Tree04)]);
-            bb.position = { x, readHeightMap(static_cast<std::int32_t>(mapPos.x), static_cast<std::int32_t>(mapPos.y)) - 0.05f, -y}; //small vertical offset to stop floating billboards
-            bb.size *= scale;
-        }
-
-        for (auto [x, y] : flowers)
-        {
-            glm::vec2 radPos(x, y);
-            auto len2 = glm::length2(radPos - centre);
-
-            if (len2 < radSqr) continue;
-
-            glm::vec2 mapPos(offsetPos.x + x, -offsetPos.z + y);
-            mapPos += centreOffset;
-
-            float scale = static_cast<float>(cro::Util::Random::value(13, 17)) / 10.f;
-
-            auto& bb = billboards.emplace_back(m_billboardTemplates[cro::Util::Random::value(BillboardID::Flowers01, BillboardID::Bush02)]);
-            bb.position = { x, readHeightMap(static_cast<std::int32_t>(mapPos.x), static_cast<std::int32_t>(mapPos.y)) + 0.05f, -y };
-            bb.size *= scale;
-        }
-        dst.getComponent<cro::BillboardCollection>().setBillboards(billboards);
+        foliageAreas.push_back({ dst, minBounds, maxBounds, radius, centre });
         dst.getComponent<cro::Model>().setRenderFlags(~(RenderFlags::MiniMap));
     };
 
@@ -2492,6 +2449,69 @@ void DrivingState::createFoliage(cro::Entity terrainEnt)
         applyMaterialData(md, material);
         entity.getComponent<cro::Model>().setMaterial(0, material);
     }
+
+    cro::GPUReadback::cancel(m_foliageReadback);
+    m_foliageReadback = cro::GPUReadback::readTexture(normalMap.getTexture(1).textureID, normalMap.getSize(), cro::GPUReadback::Format::RGBA32F,
+        [this, foliageAreas = std::move(foliageAreas), size = normalMap.getSize()](const std::byte* data, std::size_t) mutable
+        {
+            m_foliageReadback = 0;
+
+            const auto* normalMapValues = reinterpret_cast<const float*>(data);
+            const auto readHeightMap = [&](std::uint32_t x, std::uint32_t y)
+            {
+                x = std::min(size.x - 1, std::max(0u, x));
+                y = std::min(size.y - 1, std::max(0u, y));
+
+                auto idx = 4 * (y * size.x + x);
+                return normalMapValues[idx + 3];
+            };
+
+            for (auto& area : foliageAreas)
+            {
+                auto trees = pd::PoissonDiskSampling(4.f, area.minBounds, area.maxBounds);
+                auto flowers = pd::PoissonDiskSampling(2.f, area.minBounds, area.maxBounds);
+                std::vector<cro::Billboard> billboards;
+
+                glm::vec3 offsetPos = area.entity.getComponent<cro::Transform>().getPosition();
+                static constexpr glm::vec2 centreOffset(140.f, 125.f);
+
+                const float radSqr = area.radius * area.radius;
+
+                for (auto [x, y] : trees)
+                {
+                    glm::vec2 radPos(x, y);
+                    auto len2 = glm::length2(radPos - area.centre);
+
+                    if (len2 < radSqr) continue;
+
+                    glm::vec2 mapPos(offsetPos.x + x, -offsetPos.z + y);
+                    mapPos += centreOffset;
+
+                    float scale = static_cast<float>(cro::Util::Random::value(12, 22)) / 10.f;
+                    auto& bb = billboards.emplace_back(m_billboardTemplates[cro::Util::Random::value(BillboardID::Tree01, BillboardID::Tree04)]);
+                    bb.position = { x, readHeightMap(static_cast<std::int32_t>(mapPos.x), static_cast<std::int32_t>(mapPos.y)) - 0.05f, -y}; //small vertical offset to stop floating billboards
+                    bb.size *= scale;
+                }
+
+                for (auto [x, y] : flowers)
+                {
+                    glm::vec2 radPos(x, y);
+                    auto len2 = glm::length2(radPos - area.centre);
+
+                    if (len2 < radSqr) continue;
+
+                    glm::vec2 mapPos(offsetPos.x + x, -offsetPos.z + y);
+                    mapPos += centreOffset;
+
+                    float scale = static_cast<float>(cro::Util::Random::value(13, 17)) / 10.f;
+
+                    auto& bb = billboards.emplace_back(m_billboardTemplates[cro::Util::Random::value(BillboardID::Flowers01, BillboardID::Bush02)]);
+                    bb.position = { x, readHeightMap(static_cast<std::int32_t>(mapPos.x), static_cast<std::int32_t>(mapPos.y)) + 0.05f, -y };
+                    bb.size *= scale;
+                }
+                area.entity.getComponent<cro::BillboardCollection>().setBillboards(billboards);
+            }
+        });
 }
 
 void DrivingState::createClouds()
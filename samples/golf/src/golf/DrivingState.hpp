@@ -51,6 +51,7 @@ source distribution.
 #include <crogine/graphics/CubemapTexture.hpp>
 #include <crogine/graphics/SimpleQuad.hpp>
 #include <crogine/graphics/UniformBuffer.hpp>
+#include <crogine/graphics/GPUReadback.hpp>
 
 #include <crogine/detail/glm/vec2.hpp>
 
@@ -180,6 +181,7 @@ private:
     std::vector<HoleData> m_holeData;
     std::int32_t m_targetIndex;
     std::array<cro::Billboard, BillboardID::Count> m_billboardTemplates = {};
+    cro::GPUReadback::ID m_foliageReadback = 0;
 
     struct SpriteID final
     {
@@ -44,6 +44,7 @@ source distribution.
 #include <crogine/core/GameController.hpp>
 #include <crogine/core/SysTime.hpp>
 #include <crogine/ecs/Scene.hpp>
+#include <crogine/ecs/components/Camera.hpp>
 #include <crogine/ecs/components/Model.hpp>
 #include <crogine/ecs/components/Callback.hpp>
 #include <crogine/ecs/components/CommandTarget.hpp>
@@ -234,6 +235,19 @@ static inline std::uint32_t getBlurPassCount(std::int32_t q)
     return (q == 0 || q == 4) ? 0 : 1;
 }
 
+static inline void applyShadowPreset(cro::Camera& cam, std::int32_t q)
+{
+    cam.setBlurPassCount(getBlurPassCount(q));
+
+    //high and very high have enough resolution to spare for
+    //stable (texel snapped) cascades, which stops shadows
+    //shimmering as the camera moves.
+    cam.setStableShadows(q == 2 || q == 3);
+
+    //very high has 3 cascades - the far ones can be updated less often
+    cam.setCascadeUpdateInterval(q == 3 ? 2 : 1);
+}
+
 class btVector3;
 glm::vec3 btToGlm(btVector3 v);
 btVector3 glmToBt(glm::vec3 v);
@@ -76,6 +76,8 @@ source distribution.
 #include <crogine/audio/AudioScape.hpp>
 #include <crogine/audio/AudioMixer.hpp>
 #include <crogine/core/ConfigFile.hpp>
+#include <crogine/core/Profiler.hpp>
+#include <crogine/graphics/GPUProfiler.hpp>
 #include <crogine/core/GameController.hpp>
 #include <crogine/core/SysTime.hpp>
 #include <crogine/ecs/InfoFlags.hpp>
@@ -513,6 +515,7 @@ GolfState::GolfState(cro::StateStack& stack, cro::State::Context context, Shared
         loadAssets();
         buildTrophyScene();
         buildScene();
+        createRenderGraph();
         createTransition();
         cacheState(StateID::Pause);
         cacheState(StateID::MapOverview);
@@ -586,11 +589,6 @@ GolfState::~GolfState()
     m_sharedData.leagueNames.read();
 
     //wait for any active async
-    if (m_statResult.valid())
-    {
-        m_statResult.wait_for(std::chrono::milliseconds(50));
-    }
-
     if (m_csvResult.valid())
     {
         m_csvResult.wait_for(std::chrono::milliseconds(50));
@@ -1790,6 +1788,15 @@ void GolfState::handleMessage(const cro::Message& msg)
             break;
         case SceneEvent::TransitionComplete:
         {
+            //benchmarks hold the hole here until the scripted camera path
+            //has finished - this message is posted again once it's done
+            if (m_sharedData.benchmark.enabled
+                && m_benchmarkRun.getPhase() == BenchmarkRecorder::Phase::Intro)
+            {
+                startBenchmarkFlyThrough();
+                break;
+            }
+
             Timeline::addEvent(Timeline::Event::NewHole, holeNumberFromIndex());
 
             if (m_sharedData.leagueRoundID != LeagueRoundID::Club)
@@ -2735,6 +2742,11 @@ void GolfState::handleMessage(const cro::Message& msg)
 
 bool GolfState::simulate(float dt)
 {
+    if (m_sharedData.benchmark.enabled)
+    {
+        updateBenchmarkRun(dt);
+    }
+
     //while this mostly does nothing it would be nice
     //to be able to stop/start it when only a hole requires it
     m_billboardVideo.update(dt);
@@ -2915,6 +2927,7 @@ bool GolfState::simulate(float dt)
     data.direction[2] = m_windUpdate.currentWindVector.z;
     data.elapsedTime = elapsed;
     m_windBuffer.setData(data);
+    m_gameScene.getSystem<VatAnimationSystem>()->setElapsedTime(elapsed);
 
     glm::vec3 windVector(m_windUpdate.currentWindVector.x,
                         m_windUpdate.currentWindSpeed,
@@ -3180,124 +3193,162 @@ bool GolfState::simulate(float dt)
 void GolfState::render()
 {
     m_benchmark.update();
+    m_benchmarkRun.addFrame();
 
     m_scaleBuffer.bind();
     m_resolutionBuffer.bind();
     m_windBuffer.bind();
 
+    //the water projects the reflection with the current view so
+    //it's drawn every frame the view moves, else it appears to swim
+    if (auto cam = m_gameScene.getActiveCamera(); cam != m_reflectionCamera
+        || cam.getComponent<cro::Camera>().getPass(cro::Camera::Pass::Final).viewProjectionMatrix != m_reflectionViewProjection)
+    {
+        m_reflectionCamera = cam;
+        m_renderGraph.requestUpdate(m_renderPassIDs[RenderPassID::Reflection]);
+    }
+
+    m_renderGraph.execute();
+
+    //m_uiScene.setActiveCamera(uiCam);
+    CRO_GPU_SCOPE("Golf::UI");
+    m_uiScene.render();
+}
+
+void GolfState::createRenderGraph()
+{
     //render reflections first
-    auto& cam = m_gameScene.getActiveCamera().getComponent<cro::Camera>();
-    auto oldVP = cam.viewport;
+    RenderGraph::Pass pass;
+    pass.name = "Golf::Reflection";
+    pass.rate = RenderGraph::Rate::Reduced;
+    pass.interval = 2;
+    pass.render = [&]()
+    {
+        CRO_PROFILE_SCOPE("GolfState::renderReflection");
+        auto& cam = m_gameScene.getActiveCamera().getComponent<cro::Camera>();
+        auto oldVP = cam.viewport;
 
-    cam.viewport = { 0.f,0.f,1.f,1.f };
+        cam.viewport = { 0.f,0.f,1.f,1.f };
 
-    cam.setActivePass(cro::Camera::Pass::Reflection);
+        cam.setActivePass(cro::Camera::Pass::Reflection);
 
-    auto& skyCam = m_skyCameras[SkyCam::Main].getComponent<cro::Camera>();
-    skyCam.setActivePass(cro::Camera::Pass::Reflection);
-    skyCam.viewport = { 0.f,0.f,1.f,1.f };
-    m_skyScene.setActiveCamera(m_skyCameras[SkyCam::Main]);
+        auto& skyCam = m_skyCameras[SkyCam::Main].getComponent<cro::Camera>();
+        skyCam.setActivePass(cro::Camera::Pass::Reflection);
+        skyCam.viewport = { 0.f,0.f,1.f,1.f };
+        m_skyScene.setActiveCamera(m_skyCameras[SkyCam::Main]);
 
-    cam.reflectionBuffer.clear(cro::Colour::Red);
-    //don't want to test against skybox depth values.
-    m_skyScene.render();
-    glClear(GL_DEPTH_BUFFER_BIT);
-    m_gameScene.render();
-    cam.reflectionBuffer.display();
+        cam.reflectionBuffer.clear(cro::Colour::Red);
+        //don't want to test against skybox depth values.
+        m_skyScene.render();
+        glClear(GL_DEPTH_BUFFER_BIT);
+        m_gameScene.render();
+        cam.reflectionBuffer.display();
 
-    cam.setActivePass(cro::Camera::Pass::Final);
-    cam.viewport = oldVP;
+        cam.setActivePass(cro::Camera::Pass::Final);
+        cam.viewport = oldVP;
+        m_reflectionViewProjection = cam.getPass(cro::Camera::Pass::Final).viewProjectionMatrix;
 
-    skyCam.setActivePass(cro::Camera::Pass::Final);
-    skyCam.viewport = oldVP;
+        skyCam.setActivePass(cro::Camera::Pass::Final);
+        skyCam.viewport = oldVP;
+    };
+    m_renderPassIDs[RenderPassID::Reflection] = m_renderGraph.addPass(pass);
 
     //then render scene
-    if (m_holeData[m_currentHole].puttFromTee)
+    pass = {};
+    pass.name = "Golf::Main";
+    pass.render = [&]()
     {
-        glUseProgram(m_gridShaders[1].shaderID);
-        glUniform1f(m_gridShaders[1].transparency, m_sharedData.gridTransparency);
-    }
-    else
-    {
-        glUseProgram(m_gridShaders[0].shaderID);
-        glUniform1f(m_gridShaders[0].transparency, m_sharedData.gridTransparency * (1.f - m_terrainBuilder.getSlopeAlpha()));
-    }    
-    m_renderTarget.clear(cro::Colour::Black);
-    m_skyScene.render();
-    glClear(GL_DEPTH_BUFFER_BIT);
+        if (m_holeData[m_currentHole].puttFromTee)
+        {
+            glUseProgram(m_gridShaders[1].shaderID);
+            glUniform1f(m_gridShaders[1].transparency, m_sharedData.gridTransparency);
+        }
+        else
+        {
+            glUseProgram(m_gridShaders[0].shaderID);
+            glUniform1f(m_gridShaders[0].transparency, m_sharedData.gridTransparency * (1.f - m_terrainBuilder.getSlopeAlpha()));
+        }
+
+        //the reflection pass may not have set this if it was skipped
+        m_skyScene.setActiveCamera(m_skyCameras[SkyCam::Main]);
+
+        m_renderTarget.clear(cro::Colour::Black);
+        m_skyScene.render();
+        glClear(GL_DEPTH_BUFFER_BIT);
 #ifndef __APPLE__
-    glCheck(glEnable(GL_LINE_SMOOTH));
+        glCheck(glEnable(GL_LINE_SMOOTH));
 #endif
-    m_gameScene.render();
+        m_gameScene.render();
 #ifdef CAMERA_TRACK
-    //if (recordCam)
-    //{
-    //    const auto& tx = m_gameScene.getActiveCamera().getComponent<cro::Transform>();
-    //    m_cameraDebugPoints[m_currentCamera].emplace_back(tx.getRotation(), tx.getPosition());
-    //}
+        //if (recordCam)
+        //{
+        //    const auto& tx = m_gameScene.getActiveCamera().getComponent<cro::Transform>();
+        //    m_cameraDebugPoints[m_currentCamera].emplace_back(tx.getRotation(), tx.getPosition());
+        //}
 #endif
 #ifndef __APPLE__
-    glCheck(glDisable(GL_LINE_SMOOTH));
+        glCheck(glDisable(GL_LINE_SMOOTH));
 #endif
 #ifdef CRO_DEBUG_
 #endif
-    m_collisionMesh.renderDebug(cam.getActivePass().viewProjectionMatrix, m_gameSceneTexture.getSize());
-    m_renderTarget.display();
-
-    cro::Entity nightCam;
-
-    //update mini green if ball is there
-    if (m_currentPlayer.terrain == TerrainID::Green
-        && !m_flightCam.getComponent<cro::Camera>().active)
-    {
-        glUseProgram(m_gridShaders[1].shaderID);
-        glUniform1f(m_gridShaders[1].transparency, 0.f);
+        const auto& cam = m_gameScene.getActiveCamera().getComponent<cro::Camera>();
+        m_collisionMesh.renderDebug(cam.getActivePass().viewProjectionMatrix, m_gameSceneTexture.getSize());
+        m_renderTarget.display();
+    };
+    m_renderPassIDs[RenderPassID::Main] = m_renderGraph.addPass(pass);
 
-        auto oldCam = m_gameScene.setActiveCamera(m_greenCam);
-        m_overheadBuffer.clear();
-        m_gameScene.render();
-        m_overheadBuffer.display();
-        m_gameScene.setActiveCamera(oldCam);
-        nightCam = m_greenCam;
-    }
-    else //if (m_flightCam.getComponent<cro::Camera>().active)
+    //the mini green or the flight view, along with its light map
+    pass = {};
+    pass.name = "Golf::Overhead";
+    pass.rate = RenderGraph::Rate::Reduced;
+    pass.interval = 2;
+    pass.cameras = { m_greenCam, m_flightCam, m_skyCameras[SkyCam::Flight] };
+    pass.render = [&]()
     {
-        auto resolutionData = m_resolutionUpdate.resolutionData;
-        resolutionData.nearFadeDistance = 0.15f;
-        m_resolutionBuffer.setData(resolutionData);
+        cro::Entity nightCam;
 
-        m_skyScene.setActiveCamera(m_skyCameras[SkyCam::Flight]);
+        //update mini green if ball is there
+        if (m_currentPlayer.terrain == TerrainID::Green
+            && !m_flightCam.getComponent<cro::Camera>().active)
+        {
+            glUseProgram(m_gridShaders[1].shaderID);
+            glUniform1f(m_gridShaders[1].transparency, 0.f);
 
-        //update the flight view
-        auto oldCam = m_gameScene.setActiveCamera(m_flightCam);
-        m_overheadBuffer.clear(/*cro::Colour(0.5, 0.5, 1.f)*/);
-        m_skyScene.render();
-        glClear(GL_DEPTH_BUFFER_BIT);
-        m_gameScene.render();
-        m_overheadBuffer.display();
-        m_gameScene.setActiveCamera(oldCam);
+            CRO_GPU_SCOPE("Golf::Green");
+            auto oldCam = m_gameScene.setActiveCamera(m_greenCam);
+            m_overheadBuffer.clear();
+            m_gameScene.render();
+            m_overheadBuffer.display();
+            m_gameScene.setActiveCamera(oldCam);
+            nightCam = m_greenCam;
+        }
+        else //if (m_flightCam.getComponent<cro::Camera>().active)
+        {
+            auto resolutionData = m_resolutionUpdate.resolutionData;
+            resolutionData.nearFadeDistance = 0.15f;
+            m_resolutionBuffer.setData(resolutionData);
 
-        m_skyScene.setActiveCamera(m_skyCameras[SkyCam::Main]);
-        m_resolutionBuffer.setData(m_resolutionUpdate.resolutionData);
+            m_skyScene.setActiveCamera(m_skyCameras[SkyCam::Flight]);
 
-        nightCam = m_flightCam;
-    }
- 
+            //update the flight view
+            CRO_GPU_SCOPE("Golf::Flight");
+            auto oldCam = m_gameScene.setActiveCamera(m_flightCam);
+            m_overheadBuffer.clear(/*cro::Colour(0.5, 0.5, 1.f)*/);
+            m_skyScene.render();
+            glClear(GL_DEPTH_BUFFER_BIT);
+            m_gameScene.render();
+            m_overheadBuffer.display();
+            m_gameScene.setActiveCamera(oldCam);
 
-    //TODO remove conditional branch?
-    if (m_sharedData.nightTime)
-    {
-        auto& lightVolSystem = *m_gameScene.getSystem<cro::LightVolumeSystem>();
-        lightVolSystem.setSourceBuffer(m_gameSceneMRTexture.getTexture(MRTIndex::Normal), cro::LightVolumeSystem::BufferID::Normal);
-        lightVolSystem.setSourceBuffer(m_gameSceneMRTexture.getTexture(MRTIndex::Position), cro::LightVolumeSystem::BufferID::Position);
-        lightVolSystem.updateTarget(m_gameScene.getActiveCamera(), m_lightMaps[LightMapID::Scene]);
+            m_skyScene.setActiveCamera(m_skyCameras[SkyCam::Main]);
+            m_resolutionBuffer.setData(m_resolutionUpdate.resolutionData);
 
-        m_lightBlurTextures[LightMapID::Scene].clear();
-        m_lightBlurQuads[LightMapID::Scene].draw();
-        m_lightBlurTextures[LightMapID::Scene].display();
+            nightCam = m_flightCam;
+        }
 
-        if (nightCam.isValid())
+        if (m_sharedData.nightTime)
         {
+            auto& lightVolSystem = *m_gameScene.getSystem<cro::LightVolumeSystem>();
             lightVolSystem.setSourceBuffer(m_overheadBuffer.getTexture(MRTIndex::Normal), cro::LightVolumeSystem::BufferID::Normal);
             lightVolSystem.setSourceBuffer(m_overheadBuffer.getTexture(MRTIndex::Position), cro::LightVolumeSystem::BufferID::Position);
             lightVolSystem.updateTarget(nightCam, m_lightMaps[LightMapID::Overhead]);
@@ -3306,26 +3357,51 @@ void GolfState::render()
             m_lightBlurQuads[LightMapID::Overhead].draw();
             m_lightBlurTextures[LightMapID::Overhead].display();
         }
-    }
+    };
+    m_renderPassIDs[RenderPassID::Overhead] = m_renderGraph.addPass(pass);
 
-    if (m_photoMode && m_useDOF)
+    pass = {};
+    pass.name = "Golf::LightMaps";
+    pass.enabled = [&]() { return m_sharedData.nightTime; };
+    pass.render = [&]()
+    {
+        auto& lightVolSystem = *m_gameScene.getSystem<cro::LightVolumeSystem>();
+        lightVolSystem.setSourceBuffer(m_gameSceneMRTexture.getTexture(MRTIndex::Normal), cro::LightVolumeSystem::BufferID::Normal);
+        lightVolSystem.setSourceBuffer(m_gameSceneMRTexture.getTexture(MRTIndex::Position), cro::LightVolumeSystem::BufferID::Position);
+        lightVolSystem.updateTarget(m_gameScene.getActiveCamera(), m_lightMaps[LightMapID::Scene]);
+
+        m_lightBlurTextures[LightMapID::Scene].clear();
+        m_lightBlurQuads[LightMapID::Scene].draw();
+        m_lightBlurTextures[LightMapID::Scene].display();
+    };
+    m_renderPassIDs[RenderPassID::LightMaps] = m_renderGraph.addPass(pass);
+
+    pass = {};
+    pass.name = "Golf::Focus";
+    pass.enabled = [&]() { return m_photoMode && m_useDOF; };
+    pass.render = [&]()
     {
         m_focusTexture.clear();
         m_focusQuad.draw();
         m_focusTexture.display();
-    }
+    };
+    m_renderPassIDs[RenderPassID::Focus] = m_renderGraph.addPass(pass);
 
+    pass = {};
+    pass.name = "Golf::Trophies";
+    pass.rate = RenderGraph::Rate::Reduced;
+    pass.interval = 2;
+    pass.cameras = { m_trophyScene.getActiveCamera() };
 #ifndef CRO_DEBUG_
-    if (m_roundEnded /* && !m_sharedData.tutorial */)
+    pass.enabled = [&]() { return m_roundEnded /* && !m_sharedData.tutorial */; };
 #endif
+    pass.render = [&]()
     {
         m_trophySceneTexture.clear(cro::Colour::Transparent);
         m_trophyScene.render();
         m_trophySceneTexture.display();
-    }
-
-    //m_uiScene.setActiveCamera(uiCam);
-    m_uiScene.render();
+    };
+    m_renderPassIDs[RenderPassID::Trophies] = m_renderGraph.addPass(pass);
 }
 
 //private
@@ -6331,6 +6407,8 @@ void GolfState::removeClient(std::uint8_t clientID)
 
 void GolfState::setCurrentHole(std::uint16_t holeInfo, bool forceTransition)
 {
+    CRO_PROFILE_SCOPE("GolfState::setCurrentHole");
+
     m_measurePosition = glm::vec3(0.f);
 
     //clear putt counts
@@ -6741,6 +6819,11 @@ void GolfState::setCurrentHole(std::uint16_t holeInfo, bool forceTransition)
     updateScoreboard();
     startFlyBy(); //requires current hole
 
+    if (m_sharedData.benchmark.enabled)
+    {
+        m_benchmarkRun.setPhase(BenchmarkRecorder::Phase::Intro);
+    }
+
     //restore the drone if someone hit it
     if (!m_drone.isValid())
     {
@@ -7158,6 +7241,8 @@ void GolfState::requestNextPlayer(const ActivePlayer& player)
 
 void GolfState::setCurrentPlayer(const ActivePlayer& player)
 {
+    CRO_PROFILE_SCOPE("GolfState::setCurrentPlayer");
+
     m_measurePosition = glm::vec3(0.f);
 
     if (m_sharedData.gameMode != GameMode::Tutorial)
@@ -7484,7 +7569,8 @@ void GolfState::setCurrentPlayer(const ActivePlayer& player)
 
     //check if input is CPU
     if (localPlayer
-        && isCPU)
+        && isCPU
+        && !m_sharedData.benchmark.enabled)
     {
         auto pft = m_holeData[m_currentHole].puttFromTee;
 
@@ -7549,6 +7635,13 @@ void GolfState::setCurrentPlayer(const ActivePlayer& player)
 #endif
         }
     }
+    else if (localPlayer
+        && isCPU)
+    {
+        //benchmarks replace the CPU golfer with a fixed list of shots
+        m_benchmarkShot.pending = true;
+        m_benchmarkShot.delay = BenchmarkShotDelay;
+    }
 
 
     //this just makes sure to update the direction indicator
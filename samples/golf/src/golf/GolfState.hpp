@@ -45,6 +45,8 @@ source distribution.
 #include "TextChat.hpp"
 #include "League.hpp"
 #include "AvatarAnimation.hpp"
+#include "BenchmarkRecorder.hpp"
+#include "RenderGraph.hpp"
 #include "server/ServerPacketData.hpp"
 
 #include <crogine/audio/DynamicAudioStream.hpp>
@@ -198,6 +200,21 @@ private:
     std::array<cro::RenderTexture, LightMapID::Count> m_lightBlurTextures = {};
     std::array<cro::SimpleQuad, LightMapID::Count> m_lightBlurQuads = {};
 
+    RenderGraph m_renderGraph;
+    struct RenderPassID final
+    {
+        enum
+        {
+            Reflection, Main, Overhead,
+            LightMaps, Focus, Trophies,
+
+            Count
+        };
+    };
+    std::array<RenderGraph::PassID, RenderPassID::Count> m_renderPassIDs = {};
+    cro::Entity m_reflectionCamera; //each camera has its own reflection buffer
+    glm::mat4 m_reflectionViewProjection = glm::mat4(1.f); //the camera view when the reflection was last drawn
+
     struct TargetShader final
     {
         static constexpr float Epsilon = 0.0001f;
@@ -381,6 +398,7 @@ private:
 
     void addSystems();
     void buildScene();
+    void createRenderGraph();
 
     //weather.cpp
     void createWeather(std::int32_t);
@@ -680,7 +698,6 @@ private:
     //hack to allow the profile update to be const.
     std::int32_t m_courseIndex; //-1 if not an official course
     mutable std::array<std::array<PersonalBestRecord, 18>, ConstVal::MaxPlayers> m_personalBests = {};
-    std::future<void> m_statResult; //stat updates are async - this makes sure to wait when quitting
     std::future<void> m_csvResult;
     void updateProfileDB() const;
 
@@ -931,4 +948,16 @@ private:
         cro::HiResTimer m_timer;
     }m_benchmark;
     void dumpBenchmark();
+
+    //used when launched with --benchmark
+    BenchmarkRecorder m_benchmarkRun;
+    static constexpr std::uint32_t BenchmarkShotDelay = 120; //fixed steps between the player's turn starting and taking the shot
+    struct BenchmarkShot final
+    {
+        std::size_t index = 0; //next shot in the scripted list
+        std::uint32_t delay = 0;
+        bool pending = false;
+    }m_benchmarkShot;
+    void startBenchmarkFlyThrough();
+    void updateBenchmarkRun(float);
 };
\ No newline at end of file
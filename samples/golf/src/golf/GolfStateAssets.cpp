@@ -105,6 +105,45 @@ namespace
     //make this static so throughout the duration of the game we
     //cycle without repetition (until we reach the end)
     static std::int32_t BannerIndex = cro::Util::Random::value(0, static_cast<std::int32_t>(BannerStrings.size()) - 1);
+
+    //every variant of the cel shader used by the golf state. These are
+    //all issued in one batch before any are used, so that the driver can
+    //compile them in parallel rather than one at a time as materials are created
+    struct CelVariant final
+    {
+        std::int32_t shaderID = -1;
+        std::uint32_t features = 0;
+    };
+
+    constexpr std::array CelVariants =
+    {
+        CelVariant{ShaderID::Cel, CelFeature::VertexColoured | CelFeature::Dithered | CelFeature::TerrainClip | CelFeature::BallColour | CelFeature::QualitySettings},
+        CelVariant{ShaderID::CelSkinned, CelFeature::VertexColoured | CelFeature::Dithered | CelFeature::Skinned | CelFeature::TerrainClip | CelFeature::QualitySettings},
+        CelVariant{ShaderID::Flag, CelFeature::Textured | CelFeature::Skinned | CelFeature::QualitySettings},
+        CelVariant{ShaderID::Ball, CelFeature::VertexColoured | CelFeature::BallColour | CelFeature::QualitySettings},
+        CelVariant{ShaderID::BallSkinned, CelFeature::Skinned | CelFeature::VertexColoured | CelFeature::BallColour | CelFeature::QualitySettings},
+        CelVariant{ShaderID::Trophy, CelFeature::VertexColoured | CelFeature::Reflections | CelFeature::QualitySettings},
+        CelVariant{ShaderID::CelTextured, CelFeature::WindWarp | CelFeature::Textured | CelFeature::Dithered | CelFeature::Subrect | CelFeature::TerrainClip | CelFeature::QualitySettings},
+        CelVariant{ShaderID::CelTexturedMasked, CelFeature::WindWarp | CelFeature::Textured | CelFeature::Dithered | CelFeature::Subrect | CelFeature::MaskMap | CelFeature::TerrainClip | CelFeature::QualitySettings},
+        CelVariant{ShaderID::CelTexturedNoWind, CelFeature::Textured | CelFeature::Dithered | CelFeature::Subrect | CelFeature::TerrainClip | CelFeature::QualitySettings},
+        CelVariant{ShaderID::CelTexturedMaskedNoWind, CelFeature::Textured | CelFeature::Dithered | CelFeature::Subrect | CelFeature::MaskMap | CelFeature::TerrainClip | CelFeature::QualitySettings},
+        CelVariant{ShaderID::Leaderboard, CelFeature::Textured | CelFeature::Dithered | CelFeature::Subrect | CelFeature::TerrainClip},
+        CelVariant{ShaderID::CelTexturedSkinned, CelFeature::Textured | CelFeature::Dithered | CelFeature::Skinned | CelFeature::Subrect | CelFeature::TerrainClip | CelFeature::QualitySettings},
+        CelVariant{ShaderID::CelTexturedSkinnedMasked, CelFeature::Textured | CelFeature::Dithered | CelFeature::Skinned | CelFeature::Subrect | CelFeature::MaskMap | CelFeature::TerrainClip | CelFeature::QualitySettings},
+        CelVariant{ShaderID::BallWasher, CelFeature::Textured | CelFeature::Skinned | CelFeature::Subrect | CelFeature::MaskMap | CelFeature::TerrainClip | CelFeature::QualitySettings},
+        CelVariant{ShaderID::Player, CelFeature::Textured | CelFeature::Skinned | CelFeature::MaskMap | CelFeature::QualitySettings},
+        CelVariant{ShaderID::Hair, CelFeature::UserColour | CelFeature::QualitySettings},
+        CelVariant{ShaderID::HairReflect, CelFeature::UserColour | CelFeature::Reflections | CelFeature::QualitySettings},
+        CelVariant{ShaderID::Course, CelFeature::Terrain | CelFeature::Textured | CelFeature::RxShadows | CelFeature::TerrainClip | CelFeature::QualitySettings | CelFeature::TargetSettings},
+        CelVariant{ShaderID::MinimapModel, CelFeature::Terrain | CelFeature::Textured | CelFeature::TargetSettings},
+        CelVariant{ShaderID::CourseGreen, CelFeature::HoleHeight | CelFeature::Terrain | CelFeature::Textured | CelFeature::RxShadows | CelFeature::QualitySettings},
+        CelVariant{ShaderID::CourseGrid, CelFeature::HoleHeight | CelFeature::Textured | CelFeature::RxShadows | CelFeature::Contour | CelFeature::QualitySettings | CelFeature::TargetSettings},
+        CelVariant{ShaderID::CelTexturedInstanced, CelFeature::WindWarp | CelFeature::Textured | CelFeature::Dithered | CelFeature::Instancing | CelFeature::TerrainClip},
+        CelVariant{ShaderID::Crowd, CelFeature::Dithered | CelFeature::Instancing | CelFeature::Vats | CelFeature::Textured | CelFeature::TerrainClip},
+        CelVariant{ShaderID::CrowdArray, CelFeature::Dithered | CelFeature::Instancing | CelFeature::Vats | CelFeature::Textured | CelFeature::ArrayMapping | CelFeature::TerrainClip},
+    };
+
+    const std::string ShaderManifestPath = "shader_manifest.cfg";
 }
 
 void GolfState::loadAssets()
@@ -132,6 +171,10 @@ void GolfState::loadAssets()
 
     loadMap();
 
+    //record which built in variants the models needed so they
+    //can be compiled with the rest of the batch next time
+    m_resources.shaders.saveBuiltInManifest(cro::App::getPreferencePath() + ShaderManifestPath);
+
     //registerWindow([&]() 
     //    {
     //        ImGui::Begin("Sun");
@@ -534,6 +577,14 @@ void GolfState::loadMap()
         error = true;
     }
 
+    //benchmarks only ever play a single hole - this must match the server
+    if (m_sharedData.benchmark.enabled
+        && !holeStrings.empty())
+    {
+        const auto idx = std::min(holeStrings.size() - 1, static_cast<std::size_t>(m_sharedData.benchmark.hole));
+        holeStrings = { holeStrings[idx] };
+    }
+
     //check the rules and truncate hole list
     //if requested - 1 front holes, 1 back holes
     if (m_sharedData.holeCount == 1)
@@ -1786,6 +1837,27 @@ void GolfState::loadMaterials()
     static const std::string MapSizeString = "const vec2 MapSize = vec2(" + std::to_string(MapSize.x) + ".0, " + std::to_string(MapSize.y) + ".0); ";
     m_resources.shaders.addInclude("MAP_SIZE", MapSizeString.c_str());
 
+    const std::string targetDefines = (m_sharedData.scoreType == ScoreType::MultiTarget || Social::getMonth() == 2) ? "#define MULTI_TARGET\n" : "";// "#define SHOW_CASCADES\n";
+
+    //issue all the cel variants and any built in shaders used last time
+    //up front - the rest of the shaders here are also part of the batch
+    //so those which aren't requested immediately overlap with the cel shaders
+    m_resources.shaders.beginBatch();
+    for (const auto& variant : CelVariants)
+    {
+        auto defines = getCelDefines(variant.features);
+        if (variant.features & CelFeature::QualitySettings)
+        {
+            defines += wobble;
+        }
+        if (variant.features & CelFeature::TargetSettings)
+        {
+            defines += targetDefines;
+        }
+        m_resources.shaders.loadFromString(variant.shaderID, CelVertexShader, CelFragmentShader, defines);
+    }
+    m_resources.shaders.loadBuiltInManifest(cro::App::getPreferencePath() + ShaderManifestPath);
+
 
 
 
@@ -1885,14 +1957,12 @@ void GolfState::loadMaterials()
     }
 
     //cel shaded material
-    m_resources.shaders.loadFromString(ShaderID::Cel, CelVertexShader, CelFragmentShader, "#define VERTEX_COLOURED\n#define DITHERED\n#define TERRAIN_CLIP\n#define BALL_COLOUR\n" + wobble);
     auto* shader = &m_resources.shaders.get(ShaderID::Cel);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
     m_materialIDs[MaterialID::Cel] = m_resources.materials.add(*shader);
     m_resources.materials.get(m_materialIDs[MaterialID::Cel]).setProperty("u_ballColour", cro::Colour::White);
 
-    m_resources.shaders.loadFromString(ShaderID::CelSkinned, CelVertexShader, CelFragmentShader, "#define VERTEX_COLOURED\n#define DITHERED\n#define SKINNED\n#define TERRAIN_CLIP\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::CelSkinned);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -1902,14 +1972,12 @@ void GolfState::loadMaterials()
     shader = &m_resources.shaders.get(ShaderID::Hole);
     m_materialIDs[MaterialID::Hole] = m_resources.materials.add(*shader);
     
-    m_resources.shaders.loadFromString(ShaderID::Flag, CelVertexShader, CelFragmentShader, "#define TEXTURED\n#define SKINNED\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::Flag);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
     m_materialIDs[MaterialID::Flag] = m_resources.materials.add(*shader);
 
     //we always create this because it's also used on clubs etc even at night
-    m_resources.shaders.loadFromString(ShaderID::Ball, CelVertexShader, CelFragmentShader, "#define VERTEX_COLOURED\n#define BALL_COLOUR\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::Ball);
     m_scaleBuffer.addShader(*shader); //hmm I forget why balls need these UBOs
     m_resolutionBuffer.addShader(*shader);
@@ -1925,7 +1993,6 @@ void GolfState::loadMaterials()
     m_resources.materials.get(m_materialIDs[MaterialID::BallBumped]).setProperty("u_ballColour", cro::Colour::White);
 
 
-    m_resources.shaders.loadFromString(ShaderID::BallSkinned, CelVertexShader, CelFragmentShader, "#define SKINNED\n#define VERTEX_COLOURED\n#define BALL_COLOUR\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::BallSkinned);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -1953,7 +2020,6 @@ void GolfState::loadMaterials()
 
 
 
-    m_resources.shaders.loadFromString(ShaderID::Trophy, CelVertexShader, CelFragmentShader, "#define VERTEX_COLOURED\n#define REFLECTIONS\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::Trophy);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -1963,7 +2029,6 @@ void GolfState::loadMaterials()
     auto& noiseTex = m_resources.textures.get("assets/golf/images/wind.png");
     noiseTex.setRepeated(true);
     noiseTex.setSmooth(true);
-    m_resources.shaders.loadFromString(ShaderID::CelTextured, CelVertexShader, CelFragmentShader, "#define WIND_WARP\n#define TEXTURED\n#define DITHERED\n#define SUBRECT\n#define TERRAIN_CLIP\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::CelTextured);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -1973,7 +2038,6 @@ void GolfState::loadMaterials()
 
 
     //this is only used on prop models, in case they are emissive or reflective
-    m_resources.shaders.loadFromString(ShaderID::CelTexturedMasked, CelVertexShader, CelFragmentShader, "#define WIND_WARP\n#define TEXTURED\n#define DITHERED\n#define SUBRECT\n#define MASK_MAP\n#define TERRAIN_CLIP\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::CelTexturedMasked);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -1984,7 +2048,6 @@ void GolfState::loadMaterials()
 
     //disable wind/vert animation on models with no colour channel
     //saves on probably significant amount of vertex processing...
-    m_resources.shaders.loadFromString(ShaderID::CelTexturedNoWind, CelVertexShader, CelFragmentShader, "#define TEXTURED\n#define DITHERED\n#define SUBRECT\n#define TERRAIN_CLIP\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::CelTexturedNoWind);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -1998,7 +2061,6 @@ void GolfState::loadMaterials()
     {
         rxShadow = "#define RX_SHADOWS\n";
     }*/
-    m_resources.shaders.loadFromString(ShaderID::CelTexturedMaskedNoWind, CelVertexShader, CelFragmentShader, "#define TEXTURED\n#define DITHERED\n#define SUBRECT\n#define MASK_MAP\n#define TERRAIN_CLIP\n" + wobble/* + rxShadow*/);
     shader = &m_resources.shaders.get(ShaderID::CelTexturedMaskedNoWind);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -2020,12 +2082,10 @@ void GolfState::loadMaterials()
     m_windBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
 
-    m_resources.shaders.loadFromString(ShaderID::Leaderboard, CelVertexShader, CelFragmentShader, "#define TEXTURED\n#define DITHERED\n#define SUBRECT\n#define TERRAIN_CLIP\n");
     shader = &m_resources.shaders.get(ShaderID::Leaderboard);
     m_resolutionBuffer.addShader(*shader);
     m_materialIDs[MaterialID::Leaderboard] = m_resources.materials.add(*shader);
 
-    m_resources.shaders.loadFromString(ShaderID::CelTexturedSkinned, CelVertexShader, CelFragmentShader, "#define TEXTURED\n#define DITHERED\n#define SKINNED\n#define SUBRECT\n#define TERRAIN_CLIP\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::CelTexturedSkinned);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -2033,7 +2093,6 @@ void GolfState::loadMaterials()
 
 
     //again, on props only
-    m_resources.shaders.loadFromString(ShaderID::CelTexturedSkinnedMasked, CelVertexShader, CelFragmentShader, "#define TEXTURED\n#define DITHERED\n#define SKINNED\n#define SUBRECT\n#define MASK_MAP\n#define TERRAIN_CLIP\n" + wobble /*+ rxShadow*/);
     shader = &m_resources.shaders.get(ShaderID::CelTexturedSkinnedMasked);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -2042,7 +2101,6 @@ void GolfState::loadMaterials()
 
 
     //sigh we need a special case for ball washer so that it doesn't fade...
-    m_resources.shaders.loadFromString(ShaderID::BallWasher, CelVertexShader, CelFragmentShader, "#define TEXTURED\n#define SKINNED\n#define SUBRECT\n#define MASK_MAP\n#define TERRAIN_CLIP\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::BallWasher);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -2081,7 +2139,6 @@ void GolfState::loadMaterials()
 
 
 
-    m_resources.shaders.loadFromString(ShaderID::Player, CelVertexShader, CelFragmentShader, "#define TEXTURED\n#define SKINNED\n#define MASK_MAP\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::Player);
     m_resolutionBuffer.addShader(*shader);
     m_materialIDs[MaterialID::Player] = m_resources.materials.add(*shader);
@@ -2094,13 +2151,11 @@ void GolfState::loadMaterials()
 
     
     //hair
-    m_resources.shaders.loadFromString(ShaderID::Hair, CelVertexShader, CelFragmentShader, "#define USER_COLOUR\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::Hair);
     m_resolutionBuffer.addShader(*shader);
     m_materialIDs[MaterialID::Hair] = m_resources.materials.add(*shader);
 
 
-    m_resources.shaders.loadFromString(ShaderID::HairReflect, CelVertexShader, CelFragmentShader, "#define USER_COLOUR\n#define REFLECTIONS\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::HairReflect);
     m_materialIDs[MaterialID::HairReflect] = m_resources.materials.add(*shader);
     m_resources.materials.get(m_materialIDs[MaterialID::HairReflect]).setProperty("u_reflectMap", cro::CubemapID(m_reflectionMap.getGLHandle()));
@@ -2108,9 +2163,6 @@ void GolfState::loadMaterials()
 
 
 
-    std::string targetDefines = (m_sharedData.scoreType == ScoreType::MultiTarget || Social::getMonth() == 2) ? "#define MULTI_TARGET\n" : "";// "#define SHOW_CASCADES\n";
-
-    m_resources.shaders.loadFromString(ShaderID::Course, CelVertexShader, CelFragmentShader, "#define TERRAIN\n#define COMP_SHADE\n#define COLOUR_LEVELS 5.0\n#define TEXTURED\n#define RX_SHADOWS\n#define TERRAIN_CLIP\n" + wobble + targetDefines);
     shader = &m_resources.shaders.get(ShaderID::Course);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -2127,7 +2179,6 @@ void GolfState::loadMaterials()
     m_resources.materials.get(m_materialIDs[MaterialID::Course]).setProperty("u_angleTex", shaleTex);
     m_resources.materials.get(m_materialIDs[MaterialID::Course]).addCustomSetting(GL_CLIP_DISTANCE1);
 
-    m_resources.shaders.loadFromString(ShaderID::MinimapModel, CelVertexShader, CelFragmentShader, "#define TERRAIN\n#define COMP_SHADE\n#define COLOUR_LEVELS 5.0\n#define TEXTURED\n" + targetDefines);
     shader = &m_resources.shaders.get(ShaderID::MinimapModel);
     m_materialIDs[MaterialID::Minimap] = m_resources.materials.add(*shader);
     m_resources.materials.get(m_materialIDs[MaterialID::Minimap]).setProperty("u_angleTex", shaleTex);
@@ -2136,7 +2187,6 @@ void GolfState::loadMaterials()
     //m_ballShadows.shaders[0].shader = shader->getGLHandle();
     //m_ballShadows.shaders[0].uniform = shader->getUniformID("u_ballPosition");
 
-    m_resources.shaders.loadFromString(ShaderID::CourseGreen, CelVertexShader, CelFragmentShader, "#define HOLE_HEIGHT\n#define TERRAIN\n#define COMP_SHADE\n#define COLOUR_LEVELS 5.0\n#define TEXTURED\n#define RX_SHADOWS\n" + wobble);
     shader = &m_resources.shaders.get(ShaderID::CourseGreen);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -2149,7 +2199,6 @@ void GolfState::loadMaterials()
     //m_ballShadows.shaders[1].shader = shader->getGLHandle();
     //m_ballShadows.shaders[1].uniform = shader->getUniformID("u_ballPosition");
 
-    m_resources.shaders.loadFromString(ShaderID::CourseGrid, CelVertexShader, CelFragmentShader, "#define HOLE_HEIGHT\n#define TEXTURED\n#define RX_SHADOWS\n#define CONTOUR\n" + wobble + targetDefines);
     shader = &m_resources.shaders.get(ShaderID::CourseGrid);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -2182,7 +2231,6 @@ void GolfState::loadMaterials()
 
 
     //shaders used by terrain
-    m_resources.shaders.loadFromString(ShaderID::CelTexturedInstanced, CelVertexShader, CelFragmentShader, "#define WIND_WARP\n#define TEXTURED\n#define DITHERED\n#define INSTANCING\n#define TERRAIN_CLIP\n");
     shader = &m_resources.shaders.get(ShaderID::CelTexturedInstanced);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
@@ -2193,21 +2241,23 @@ void GolfState::loadMaterials()
     m_windBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
 
-    m_resources.shaders.loadFromString(ShaderID::Crowd, CelVertexShader, CelFragmentShader, "#define DITHERED\n#define INSTANCING\n#define VATS\n#define TEXTURED\n#define TERRAIN_CLIP\n");
     shader = &m_resources.shaders.get(ShaderID::Crowd);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
+    m_windBuffer.addShader(*shader);
 
     m_resources.shaders.loadFromString(ShaderID::CrowdShadow, ShadowVertex, ShadowFragment, "#define DITHERED\n#define INSTANCING\n#define VATS\n");
     m_resolutionBuffer.addShader(m_resources.shaders.get(ShaderID::CrowdShadow));
+    m_windBuffer.addShader(m_resources.shaders.get(ShaderID::CrowdShadow));
 
-    m_resources.shaders.loadFromString(ShaderID::CrowdArray, CelVertexShader, CelFragmentShader, "#define DITHERED\n#define INSTANCING\n#define VATS\n#define TEXTURED\n#define ARRAY_MAPPING\n#define TERRAIN_CLIP\n");
     shader = &m_resources.shaders.get(ShaderID::CrowdArray);
     m_scaleBuffer.addShader(*shader);
     m_resolutionBuffer.addShader(*shader);
+    m_windBuffer.addShader(*shader);
 
     m_resources.shaders.loadFromString(ShaderID::CrowdShadowArray, ShadowVertex, ShadowFragment, "#define DITHERED\n#define INSTANCING\n#define VATS\n#define ARRAY_MAPPING\n");
     m_resolutionBuffer.addShader(m_resources.shaders.get(ShaderID::CrowdShadowArray));
+    m_windBuffer.addShader(m_resources.shaders.get(ShaderID::CrowdShadowArray));
 
 
     //HQ tree shaders - wasted if the whole game is LQ, but we want to be able to swap mid-game...
@@ -2384,6 +2434,8 @@ void GolfState::loadMaterials()
     m_materialIDs[MaterialID::Target] = m_resources.materials.add(m_resources.shaders.get(ShaderID::Target));
     m_resources.materials.get(m_materialIDs[MaterialID::Target]).blendMode = cro::Material::BlendMode::Additive;
     m_resources.materials.get(m_materialIDs[MaterialID::Target]).doubleSided = true;
+
+    m_resources.shaders.endBatch();
 }
 
 void GolfState::loadSprites()
@@ -92,6 +92,12 @@ void GolfState::createCameras()
             float scale = m_sharedData.pixelScale ? maxScale : 1.f;
             auto texSize = winSize / scale;
 
+            //benchmarks render the scene at a fixed size regardless of the window
+            if (m_sharedData.benchmark.enabled)
+            {
+                texSize = glm::vec2(m_sharedData.benchmark.resolution);
+            }
+
             //only want to resize the buffer once !!
             if (cam == m_cameras[CameraID::Player].getComponent<cro::Camera>())
             {
@@ -224,7 +230,7 @@ void GolfState::createCameras()
     cam.shadowMapBuffer.create(ShadowMapSize, ShadowMapSize);
     cam.setMaxShadowDistance(m_shadowQuality.getMaxDistance(CameraID::Player));
     cam.setShadowExpansion(20.f);
-    cam.setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+    applyShadowPreset(cam, m_sharedData.shadowQuality);
 
     //create an overhead camera
     auto setPerspective = [&](cro::Camera& cam)
@@ -259,7 +265,7 @@ void GolfState::createCameras()
     camEnt.getComponent<cro::Camera>().active = false;
     camEnt.getComponent<cro::Camera>().setMaxShadowDistance(m_shadowQuality.getMaxDistance(CameraID::Sky));
     camEnt.getComponent<cro::Camera>().setShadowExpansion(25.f);
-    camEnt.getComponent<cro::Camera>().setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+    applyShadowPreset(camEnt.getComponent<cro::Camera>(), m_sharedData.shadowQuality);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Reflection, RenderFlags::Reflection);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Final, RenderFlags::Main);
     camEnt.addComponent<cro::CommandTarget>().ID = CommandID::SpectatorCam;
@@ -301,7 +307,7 @@ void GolfState::createCameras()
     camEnt.getComponent<cro::Camera>().active = false;
     camEnt.getComponent<cro::Camera>().setMaxShadowDistance(m_shadowQuality.getMaxDistance(CameraID::Drone));
     camEnt.getComponent<cro::Camera>().setShadowExpansion(25.f);
-    camEnt.getComponent<cro::Camera>().setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+    applyShadowPreset(camEnt.getComponent<cro::Camera>(), m_sharedData.shadowQuality);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Reflection, RenderFlags::Reflection);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Final, RenderFlags::Main);
     camEnt.addComponent<cro::CommandTarget>().ID = CommandID::DroneCam;
@@ -333,7 +339,7 @@ void GolfState::createCameras()
     camEnt.getComponent<cro::Camera>().active = false;
     camEnt.getComponent<cro::Camera>().setMaxShadowDistance(m_shadowQuality.getMaxDistance(CameraID::Green));
     camEnt.getComponent<cro::Camera>().setShadowExpansion(25.f);
-    camEnt.getComponent<cro::Camera>().setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+    applyShadowPreset(camEnt.getComponent<cro::Camera>(), m_sharedData.shadowQuality);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Reflection, RenderFlags::Reflection);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Final, RenderFlags::Main);
     camEnt.addComponent<cro::CommandTarget>().ID = CommandID::SpectatorCam;
@@ -366,7 +372,7 @@ void GolfState::createCameras()
     camEnt.getComponent<cro::Camera>().active = false;
     camEnt.getComponent<cro::Camera>().setMaxShadowDistance(m_shadowQuality.getMaxDistance(CameraID::Bystander));
     camEnt.getComponent<cro::Camera>().setShadowExpansion(25.f);
-    camEnt.getComponent<cro::Camera>().setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+    applyShadowPreset(camEnt.getComponent<cro::Camera>(), m_sharedData.shadowQuality);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Reflection, RenderFlags::Reflection);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Final, RenderFlags::Main);
     camEnt.addComponent<cro::AudioListener>();
@@ -415,7 +421,7 @@ void GolfState::createCameras()
     camEnt.getComponent<cro::Camera>().active = false;
     camEnt.getComponent<cro::Camera>().setMaxShadowDistance(m_shadowQuality.getMaxDistance(CameraID::Idle));
     camEnt.getComponent<cro::Camera>().setShadowExpansion(25.f);
-    camEnt.getComponent<cro::Camera>().setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+    applyShadowPreset(camEnt.getComponent<cro::Camera>(), m_sharedData.shadowQuality);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Reflection, RenderFlags::Reflection);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Final, RenderFlags::Main);
     camEnt.addComponent<cro::AudioListener>();
@@ -455,7 +461,7 @@ void GolfState::createCameras()
     camEnt.getComponent<cro::Camera>().active = false;
     camEnt.getComponent<cro::Camera>().setMaxShadowDistance(m_shadowQuality.getMaxDistance(CameraID::Transition));
     camEnt.getComponent<cro::Camera>().setShadowExpansion(45.f);
-    camEnt.getComponent<cro::Camera>().setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+    applyShadowPreset(camEnt.getComponent<cro::Camera>(), m_sharedData.shadowQuality);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Reflection, RenderFlags::Reflection);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Final, RenderFlags::Main);
     camEnt.addComponent<cro::AudioListener>();
@@ -487,7 +493,7 @@ void GolfState::createCameras()
     camEnt.getComponent<cro::Camera>().active = false;
     camEnt.getComponent<cro::Camera>().setMaxShadowDistance(m_shadowQuality.getMaxDistance(-1));
     camEnt.getComponent<cro::Camera>().setShadowExpansion(15.f);
-    camEnt.getComponent<cro::Camera>().setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+    applyShadowPreset(camEnt.getComponent<cro::Camera>(), m_sharedData.shadowQuality);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Reflection, RenderFlags::Reflection);
     camEnt.getComponent<cro::Camera>().setRenderFlags(cro::Camera::Pass::Final, RenderFlags::Main);
     camEnt.addComponent<cro::AudioListener>();
@@ -520,7 +526,7 @@ void GolfState::createCameras()
     camEnt.getComponent<cro::Camera>().active = false;
     camEnt.getComponent<cro::Camera>().setMaxShadowDistance(/*m_shadowQuality.shadowFarDistance*/3.f);
     camEnt.getComponent<cro::Camera>().setShadowExpansion(1.f);
-    camEnt.getComponent<cro::Camera>().setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+    applyShadowPreset(camEnt.getComponent<cro::Camera>(), m_sharedData.shadowQuality);
 
     camEnt.addComponent<cro::Callback>().active = true;
     camEnt.getComponent<cro::Callback>().setUserData<cro::Entity>(); //this is the target ball
@@ -571,6 +577,12 @@ void GolfState::createCameras()
         };
     m_flightCam = camEnt;
 
+    //skips drawing anything hidden behind the surrounding hills
+    for (auto cam : m_cameras)
+    {
+        cam.getComponent<cro::Camera>().occlusionBuffer = &m_terrainBuilder.getOcclusionBuffer();
+    }
+
 
 
     //set up the skybox cameras so they can be updated with the relative active cams
@@ -980,7 +992,7 @@ void GolfState::applyShadowQuality()
 
             cam.shadowMapBuffer.create(shadowMapSize, shadowMapSize);
             cam.setMaxShadowDistance(m_shadowQuality.getMaxDistance(camID));
-            cam.setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+            applyShadowPreset(cam, m_sharedData.shadowQuality);
 
             cam.setPerspective(cam.getFOV(), cam.getAspectRatio(), cam.getNearPlane(), cam.getFarPlane(), m_shadowQuality.cascadeCount);
         };
@@ -1935,6 +1947,104 @@ void GolfState::startFlyBy()
     msg->data = static_cast<std::int32_t>(m_currentHole);
 }
 
+void GolfState::startBenchmarkFlyThrough()
+{
+    m_benchmarkRun.setPhase(BenchmarkRecorder::Phase::FlyThrough);
+    showScoreboard(false);
+
+    //a fixed path which sweeps from the tee over the target
+    //and then orbits the pin. This is driven by the fixed
+    //simulation step so that every run renders the same views.
+    static constexpr float SegmentTime = 2.f;
+    static constexpr std::int32_t OrbitCount = 8;
+    static constexpr float OrbitRadius = 40.f;
+    static constexpr float OrbitHeight = 20.f;
+
+    struct FlyThroughPath final
+    {
+        std::vector<glm::mat4> points;
+        std::size_t currentPoint = 0;
+        float progress = 0.f;
+    }path;
+
+    const auto& holeData = m_holeData[m_currentHole];
+    auto target = holeData.target;
+    if (glm::length2(target - holeData.pin) < 1.f)
+    {
+        target = holeData.tee + ((holeData.pin - holeData.tee) / 2.f);
+    }
+
+    const auto lookAt = [](glm::vec3 position, glm::vec3 target)
+        {
+            return glm::inverse(glm::lookAt(position, target, cro::Transform::Y_AXIS));
+        };
+
+    auto dir = target - holeData.tee;
+    dir.y = 0.f;
+    dir = glm::length2(dir) > 0.f ? glm::normalize(dir) : glm::vec3(1.f, 0.f, 0.f);
+
+    path.points.push_back(lookAt(holeData.tee - (dir * 5.f) + glm::vec3(0.f, 4.f, 0.f), target));
+    path.points.push_back(lookAt(target + glm::vec3(0.f, 10.f, 0.f), holeData.pin));
+
+    for (auto i = 0; i <= OrbitCount; ++i)
+    {
+        const float angle = (static_cast<float>(i) / OrbitCount) * cro::Util::Const::TAU;
+        const glm::vec3 offset(std::cos(angle) * OrbitRadius, OrbitHeight, std::sin(angle) * OrbitRadius);
+        path.points.push_back(lookAt(holeData.pin + offset, holeData.pin));
+    }
+
+    setActiveCamera(CameraID::Transition);
+    m_cameras[CameraID::Transition].getComponent<cro::Transform>().setLocalTransform(path.points[0]);
+
+    auto entity = m_gameScene.createEntity();
+    entity.addComponent<cro::Callback>().active = true;
+    entity.getComponent<cro::Callback>().setUserData<FlyThroughPath>(path);
+    entity.getComponent<cro::Callback>().function =
+        [&](cro::Entity e, float dt)
+        {
+            auto& data = e.getComponent<cro::Callback>().getUserData<FlyThroughPath>();
+            data.progress += dt / SegmentTime;
+
+            if (data.progress >= 1.f)
+            {
+                data.progress -= 1.f;
+                data.currentPoint++;
+            }
+
+            auto& camTx = m_cameras[CameraID::Transition].getComponent<cro::Transform>();
+
+            if (data.currentPoint + 1 < data.points.size())
+            {
+                const auto& a = data.points[data.currentPoint];
+                const auto& b = data.points[data.currentPoint + 1];
+
+                camTx.setRotation(glm::slerp(glm::quat_cast(a), glm::quat_cast(b), data.progress));
+                camTx.setPosition(interpolate(glm::vec3(a[3]), glm::vec3(b[3]), cro::Util::Easing::easeInOutQuad(data.progress)));
+
+                glm::vec3 intersection(0.f);
+                if (planeIntersect(camTx.getLocalTransform(), intersection))
+                {
+                    intersection.y = WaterLevel;
+                    m_cameras[CameraID::Transition].getComponent<TargetInfo>().waterPlane = m_waterEnt;
+                    m_waterEnt.getComponent<cro::Transform>().setPosition(intersection);
+                }
+            }
+            else
+            {
+                m_gameScene.getSystem<CameraFollowSystem>()->resetCamera();
+                setActiveCamera(CameraID::Player);
+
+                m_benchmarkRun.setPhase(BenchmarkRecorder::Phase::Play);
+
+                auto* msg = cro::App::getInstance().getMessageBus().post<SceneEvent>(MessageID::SceneMessage);
+                msg->type = SceneEvent::TransitionComplete;
+
+                e.getComponent<cro::Callback>().active = false;
+                m_gameScene.destroyEntity(e);
+            }
+        };
+}
+
 void GolfState::setCameraPosition(glm::vec3 position, float height, float viewOffset)
 {
     static constexpr float MinDist = 6.f;
@@ -40,8 +40,10 @@ source distribution.
 #include <crogine/audio/AudioMixer.hpp>
 #include <crogine/ecs/components/Camera.hpp>
 #include <crogine/ecs/systems/LightVolumeSystem.hpp>
+#include <crogine/ecs/systems/ModelRenderer.hpp>
 #include <crogine/core/SysTime.hpp>
 #include <crogine/detail/OpenGL.hpp>
+#include <crogine/graphics/GPUProfiler.hpp>
 #include <crogine/gui/Gui.hpp>
 
 namespace
@@ -60,6 +62,34 @@ namespace
     {
         "None", "Even", "One", "Two", "Three", "Four"
     };
+
+    //shots played by the benchmark in place of the CPU golfer. Each
+    //list starts again from the top once it has been played through
+    struct ScriptedShot final
+    {
+        std::int32_t club = ClubID::Driver;
+        float power = 1.f; //0-1
+        float rotation = 0.f; //radians relative to the hole direction
+    };
+
+    constexpr std::array<ScriptedShot, 4u> BenchmarkShots =
+    {
+        ScriptedShot{ ClubID::Driver, 0.9f, 0.f },
+        ScriptedShot{ ClubID::FiveIron, 0.8f, 0.04f },
+        ScriptedShot{ ClubID::NineIron, 0.7f, -0.04f },
+        ScriptedShot{ ClubID::PitchWedge, 0.5f, 0.f }
+    };
+
+    //on the green the club is always the putter
+    constexpr std::array<ScriptedShot, 3u> BenchmarkPutts =
+    {
+        ScriptedShot{ ClubID::Putter, 0.6f, 0.f },
+        ScriptedShot{ ClubID::Putter, 0.4f, 0.02f },
+        ScriptedShot{ ClubID::Putter, 0.3f, -0.02f }
+    };
+
+    //the play phase always lasts this many fixed steps (60 per second)
+    constexpr std::uint32_t BenchmarkPlaySteps = 60 * 45;
 }
 
 #include <crogine/graphics/MeshData.hpp>
@@ -544,6 +574,56 @@ void GolfState::registerDebugCommands()
             }
         });
 
+    registerCommand("cl_render_graph", [&](const std::string& param)
+        {
+            if (param == "1" || param == "true")
+            {
+                m_renderGraph.setReducedRatesEnabled(true);
+            }
+            else if (param == "0" || param == "false")
+            {
+                m_renderGraph.setReducedRatesEnabled(false);
+            }
+            else if (!param.empty())
+            {
+                try
+                {
+                    m_renderGraph.setBudget(std::max(0.f, std::stof(param)));
+                }
+                catch (...)
+                {
+                    cro::Console::print("Usage: cl_render_graph <0|1|budget_ms>");
+                    return;
+                }
+            }
+            m_renderGraph.printStats();
+        });
+
+    registerCommand("cl_occlusion", [&](const std::string& param)
+        {
+            auto& occlusionBuffer = m_terrainBuilder.getOcclusionBuffer();
+            if (param == "1" || param == "true")
+            {
+                occlusionBuffer.setEnabled(true);
+            }
+            else if (param == "0" || param == "false")
+            {
+                occlusionBuffer.setEnabled(false);
+            }
+            else if (!param.empty())
+            {
+                cro::Console::print("Usage: cl_occlusion <0|1>");
+                return;
+            }
+
+            const auto& cam = m_gameScene.getActiveCamera().getComponent<cro::Camera>();
+            const auto* renderer = m_gameScene.getSystem<cro::ModelRenderer>();
+            cro::Console::print("Occlusion culling " + std::string(occlusionBuffer.isEnabled() ? "enabled" : "disabled")
+                + ", " + std::to_string(occlusionBuffer.getOccluderCount()) + " occluder triangles");
+            cro::Console::print("Drawn: " + std::to_string(renderer->getVisibleCount(cam.getDrawListIndex(), cro::Camera::Pass::Final))
+                + ", Occluded: " + std::to_string(renderer->getOccludedCount(cam.getDrawListIndex(), cro::Camera::Pass::Final)));
+        });
+
     registerCommand("cl_drawmesh", [&](const std::string& param)
         {
             if (param == "true" || param == "1")
@@ -1186,6 +1266,20 @@ void GolfState::dumpBenchmark()
         SDL_RWwrite(file.file, dateTime.c_str(), dateTime.length(), 1);
         SDL_RWwrite(file.file, stat.c_str(), stat.length(), 1);
         SDL_RWwrite(file.file, settings.c_str(), settings.length(), 1);
+
+        //only available if the GPU timer was enabled via the console
+        const auto& gpuResults = cro::GPUProfiler::getResults();
+        if (!gpuResults.empty())
+        {
+            std::string gpuTimes = "GPU pass times (ms, inclusive / exclusive):\n";
+            for (const auto& result : gpuResults)
+            {
+                gpuTimes += std::string(result.depth * 2, ' ') + result.name
+                    + ": " + std::to_string(result.inclusiveMs) + " / " + std::to_string(result.exclusiveMs) + "\n";
+            }
+            gpuTimes += "\n";
+            SDL_RWwrite(file.file, gpuTimes.c_str(), gpuTimes.length(), 1);
+        }
     }
     else
     {
@@ -1194,4 +1288,87 @@ void GolfState::dumpBenchmark()
     }
 
     m_benchmark.reset();
-}
\ No newline at end of file
+}
+
+void GolfState::updateBenchmarkRun(float dt)
+{
+    m_benchmarkRun.update(dt);
+
+    if (m_benchmarkRun.getPhase() != BenchmarkRecorder::Phase::Play)
+    {
+        return;
+    }
+
+    //take the next scripted shot once the player's turn has settled
+    if (m_benchmarkShot.pending)
+    {
+        if (m_benchmarkShot.delay != 0)
+        {
+            m_benchmarkShot.delay--;
+        }
+        else if (m_inputParser.getActive()
+            && m_inputParser.isAiming())
+        {
+            const auto& shot = m_currentPlayer.terrain == TerrainID::Green ?
+                BenchmarkPutts[m_benchmarkShot.index % BenchmarkPutts.size()] :
+                BenchmarkShots[m_benchmarkShot.index % BenchmarkShots.size()];
+            m_benchmarkShot.index++;
+            m_benchmarkShot.pending = false;
+
+            m_inputParser.syncClub(shot.club);
+            m_inputParser.setRotation(shot.rotation);
+            m_inputParser.doFastStroke(0.f, shot.power);
+        }
+    }
+
+    //the play phase runs for a fixed number of steps whether or
+    //not the hole is completed, so every run simulates the same
+    if (m_benchmarkRun.getPhaseSteps() < BenchmarkPlaySteps)
+    {
+        return;
+    }
+
+    m_benchmarkRun.setPhase(BenchmarkRecorder::Phase::Complete);
+
+    const std::array<std::string, 3u> TreeTypes
+    {
+        "Classic", "Low", "High"
+    };
+
+    const auto windowSize = cro::App::getWindow().getSize();
+    const auto epoch = cro::SysTime::epoch();
+
+    BenchmarkRecorder::Info info;
+    info.emplace_back("date", cro::SysTime::dateString(epoch) + " " + cro::SysTime::timeString(epoch));
+    info.emplace_back("course", m_sharedData.mapDirectory);
+    info.emplace_back("hole", std::to_string(m_sharedData.benchmark.hole));
+    info.emplace_back("resolution", std::to_string(m_sharedData.benchmark.resolution.x) + "x" + std::to_string(m_sharedData.benchmark.resolution.y));
+    info.emplace_back("window_size", std::to_string(windowSize.x) + "x" + std::to_string(windowSize.y));
+    info.emplace_back("night", m_sharedData.nightTime ? "true" : "false");
+    info.emplace_back("tree_quality", TreeTypes[m_sharedData.treeQuality]);
+    info.emplace_back("shadow_quality", m_sharedData.shadowQuality ? "High" : "Low");
+    info.emplace_back("vsync", cro::App::getWindow().getVsyncEnabled() ? "true" : "false");
+    info.emplace_back("vendor", reinterpret_cast<const char*>(glGetString(GL_VENDOR)));
+    info.emplace_back("renderer", reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+    info.emplace_back("shots", std::to_string(m_benchmarkShot.index));
+    info.emplace_back("round_completed", m_roundEnded ? "true" : "false");
+#ifdef CRO_DEBUG_
+    info.emplace_back("build", "debug");
+#else
+    info.emplace_back("build", "release");
+#endif
+
+    auto outFile = m_sharedData.benchmark.outputPath;
+    if (outFile.empty())
+    {
+        outFile = cro::App::getPreferencePath() + "benchmark/";
+        if (!cro::FileSystem::directoryExists(outFile))
+        {
+            cro::FileSystem::createDirectory(outFile);
+        }
+        outFile += m_sharedData.mapDirectory + "_" + std::to_string(m_sharedData.benchmark.hole) + ".json";
+    }
+    m_benchmarkRun.write(outFile, info);
+
+    cro::App::quit();
+}
@@ -2023,6 +2023,11 @@ void GolfState::buildUI()
 
         courseEnt.getComponent<cro::Transform>().setPosition(glm::vec3(size / 2.f, -1.f));
         courseEnt.getComponent<cro::Transform>().setScale(courseScale);
+        if (m_sharedData.benchmark.enabled)
+        {
+            //benchmarks render the scene at a fixed size so stretch it to fit the window
+            courseEnt.getComponent<cro::Transform>().setScale(size / glm::vec2(m_sharedData.benchmark.resolution));
+        }
         courseEnt.getComponent<cro::Callback>().active = true; //makes sure to delay so updating the texture size is complete first
 
         trophyEnt.getComponent<cro::Transform>().setPosition(glm::vec3(size / 2.f, 3.5f));
@@ -3142,7 +3147,7 @@ void GolfState::showCountdown(std::uint8_t seconds)
         {
         default: break;
         case ScoreType::Stroke:
-            m_statResult = std::async(std::launch::async, &GolfState::updateProfileDB, this);
+            updateProfileDB();
             [[fallthrough]];
         case ScoreType::Stableford:
         case ScoreType::StablefordPro:
@@ -6570,74 +6575,72 @@ void GolfState::updateProfileDB() const
         const auto& localPlayers = m_sharedData.localConnectionData.playerData;
         const auto& playerData = m_sharedData.connectionData[clientID].playerData;
 
-        ProfileDB db;
+        //these are only queued here, and written on the DB thread
+        auto& db = m_sharedData.profileDB;
         for (auto i = 0u; i < localCount; ++i)
         {
             auto dbPath = Content::getUserContentPath(Content::UserContent::Profile) + localPlayers[i].profileID + "/profile.db3";
-            if (db.open(dbPath))
-            {
-                CourseRecord record;
-                auto scores = playerData[i].holeScores;
+            CourseRecord record;
+            auto scores = playerData[i].holeScores;
 
-                switch (m_sharedData.holeCount)
+            switch (m_sharedData.holeCount)
+            {
+            default: continue;
+            case 0:
+                if (m_sharedData.reverseCourse)
                 {
-                default: continue;
-                case 0:
-                    if (m_sharedData.reverseCourse)
-                    {
-                        std::reverse(scores.begin(), scores.end());
-                        std::reverse(m_personalBests[i].begin(), m_personalBests[i].end());
-                    }
-                    for (auto j = 0; j < 18; ++j)
-                    {
-                        record.holeScores[j] = scores[j];
-                        record.total += scores[j];
+                    std::reverse(scores.begin(), scores.end());
+                    std::reverse(m_personalBests[i].begin(), m_personalBests[i].end());
+                }
+                for (auto j = 0; j < 18; ++j)
+                {
+                    record.holeScores[j] = scores[j];
+                    record.total += scores[j];
 
-                        m_personalBests[i][j].hole = j;
-                        db.insertPersonalBestRecord(m_personalBests[i][j]);
-                    }
-                    break;
-                case 1:
-                    if (m_sharedData.reverseCourse)
-                    {
-                        std::reverse(scores.begin(), scores.begin() + 9);
-                        std::reverse(m_personalBests[i].begin(), m_personalBests[i].begin() + 9);
-                    }
-                    for (auto j = 0; j < 9; ++j)
-                    {
-                        record.holeScores[j] = scores[j];
-                        record.total += scores[j];
+                    m_personalBests[i][j].hole = j;
+                    db.insertPersonalBestRecord(dbPath, m_personalBests[i][j]);
+                }
+                break;
+            case 1:
+                if (m_sharedData.reverseCourse)
+                {
+                    std::reverse(scores.begin(), scores.begin() + 9);
+                    std::reverse(m_personalBests[i].begin(), m_personalBests[i].begin() + 9);
+                }
+                for (auto j = 0; j < 9; ++j)
+                {
+                    record.holeScores[j] = scores[j];
+                    record.total += scores[j];
 
-                        m_personalBests[i][j].hole = j;
-                        db.insertPersonalBestRecord(m_personalBests[i][j]);
-                    }
-                    break;
-                case 2:
-                    if (m_sharedData.reverseCourse)
-                    {
-                        std::reverse(scores.begin(), scores.begin() + 9);
-                        std::reverse(m_personalBests[i].begin(), m_personalBests[i].begin() + 9);
-                    }
-                    for (auto j = 0; j < 9; ++j)
-                    {
-                        record.holeScores[j + 9] = scores[j];
-                        record.total += scores[j];
+                    m_personalBests[i][j].hole = j;
+                    db.insertPersonalBestRecord(dbPath, m_personalBests[i][j]);
+                }
+                break;
+            case 2:
+                if (m_sharedData.reverseCourse)
+                {
+                    std::reverse(scores.begin(), scores.begin() + 9);
+                    std::reverse(m_personalBests[i].begin(), m_personalBests[i].begin() + 9);
+                }
+                for (auto j = 0; j < 9; ++j)
+                {
+                    record.holeScores[j + 9] = scores[j];
+                    record.total += scores[j];
 
-                        m_personalBests[i][j].hole = j + 9;
-                        db.insertPersonalBestRecord(m_personalBests[i][j]);
-                    }
-                    break;
+                    m_personalBests[i][j].hole = j + 9;
+                    db.insertPersonalBestRecord(dbPath, m_personalBests[i][j]);
                 }
+                break;
+            }
 
-                record.totalPar = playerData[i].parScore;
-                record.holeCount = m_sharedData.holeCount;
-                record.courseIndex = courseID;
-                record.wasCPU = localPlayers[i].isCPU ? 1 : 0;
+            record.totalPar = playerData[i].parScore;
+            record.holeCount = m_sharedData.holeCount;
+            record.courseIndex = courseID;
+            record.wasCPU = localPlayers[i].isCPU ? 1 : 0;
 
-                if (m_sharedData.scoreType == ScoreType::Stroke)
-                {
-                    db.insertCourseRecord(record);
-                }
+            if (m_sharedData.scoreType == ScoreType::Stroke)
+            {
+                db.insertCourseRecord(dbPath, record);
             }
         }
     }
@@ -884,6 +884,11 @@ void InputParser::setMaxRotation(float rotation)
     m_maxRotation = std::max(0.05f, std::min(cro::Util::Const::PI / 2.f/*MaxRotation*/, rotation));
 }
 
+void InputParser::setRotation(float rotation)
+{
+    m_rotation = std::clamp(rotation, -m_maxRotation, m_maxRotation);
+}
+
 InputParser::StrokeResult InputParser::getStroke(std::int32_t club, std::int32_t facing, float distanceToHole) const
 {
     auto pitch = Clubs[club].getAngle();
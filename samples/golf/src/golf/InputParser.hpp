@@ -91,6 +91,7 @@ public:
 
     void setMaxRotation(float);
     float getMaxRotation() const { return m_maxRotation; }
+    void setRotation(float); //relative to the hole direction, clamped to max rotation. Used by scripted benchmark shots
 
     glm::vec2 getSpin() const { return m_spin; }
     bool isSpinputActive() const { return (m_inputFlags & InputFlag::SpinMenu) != 0; }
@@ -145,6 +145,45 @@ FRAG_OUT = colour + (gridColour * contourAmount * u_gridAmount);
             }
         )";
 
+    //each slope arrow is a fixed set of verts per grid cell. The position
+    //is the pixel coord of the cell, and the tex coords are the distance
+    //along and across the arrow, which are scaled by the normal read here
+    const std::string MiniSlopeVertex =
+        R"(
+            uniform mat4 u_worldMatrix;
+            uniform mat4 u_viewProjectionMatrix;
+
+            uniform sampler2D u_normalMap;
+            uniform sampler2D u_maskMap;
+            uniform vec2 u_mapSize;
+
+            ATTRIBUTE vec2 a_position;
+            ATTRIBUTE vec2 a_texCoord0;
+            ATTRIBUTE vec4 a_colour;
+
+            VARYING_OUT vec4 v_colour;
+
+            void main()
+            {
+                vec2 uv = (a_position + 0.5) / u_mapSize;
+                vec3 normal = TEXTURE(u_normalMap, uv).rgb;
+                float mask = TEXTURE(u_maskMap, uv).r;
+
+                //more than this we kinda assume the normal is vertical and skip it
+                float visible = step(0.5, mask) * (1.0 - step(0.9999, normal.y));
+
+                vec2 direction = vec2(normal.x, -normal.z) * 50.0;
+                vec2 cross = vec2(-direction.y, direction.x) * 0.16;
+                vec2 position = a_position + (((direction * a_texCoord0.x) + (cross * a_texCoord0.y)) * visible);
+
+                gl_Position = u_viewProjectionMatrix * u_worldMatrix * vec4(position, 0.0, 1.0);
+
+                v_colour = a_colour;
+                v_colour.g *= mix(1.0, 1.0 - min(1.0, dot(direction, direction) / 64.0), step(0.01, a_texCoord0.x));
+                v_colour.a *= visible;
+            }
+        )";
+
     const std::string MiniSlopeFragment = 
         R"(
             OUTPUT
@@ -565,7 +604,7 @@ void MapOverviewState::loadAssets()
     m_mapQuad.setTexture(m_sharedData.minimapData.mrt->getTexture(MRTIndex::Colour), m_renderBuffer.getSize());
     m_mapQuad.setShader(m_mapShader);
 
-    m_slopeShader.loadFromString(cro::RenderSystem2D::getDefaultVertexShader(), MiniSlopeFragment);
+    m_slopeShader.loadFromString(MiniSlopeVertex, MiniSlopeFragment);
     m_shaderUniforms.transparency = m_slopeShader.getUniformID("u_transparency");
 
     m_mapString.setFont(m_sharedData.sharedResources->fonts.get(FontID::Label));
@@ -761,6 +800,33 @@ void MapOverviewState::buildScene()
     entity.addComponent<cro::Drawable2D>().setPrimitiveType(GL_LINES);
     entity.getComponent<cro::Drawable2D>().setShader(&m_slopeShader);
 
+    //the grid never changes so it's only built once - the
+    //tex coords are the distance along/across the arrow
+    const auto imageSize = m_renderBuffer.getSize();
+    const auto PixelsPerMetre = (imageSize.x / MapSize.x) * 2;
+    const std::array<glm::vec2, 8u> ArrowCoords =
+    {
+        glm::vec2(0.f), glm::vec2(1.f, 0.f),
+        glm::vec2(0.8f, 1.f), glm::vec2(0.8f, -1.f),
+        glm::vec2(0.8f, -1.f), glm::vec2(1.f, 0.f),
+        glm::vec2(1.f, 0.f), glm::vec2(0.8f, 1.f)
+    };
+
+    std::vector<cro::Vertex2D> arrowVerts;
+    arrowVerts.reserve((imageSize.x / PixelsPerMetre) * (imageSize.y / PixelsPerMetre) * ArrowCoords.size());
+    for (auto y = 0u; y < imageSize.y; y += PixelsPerMetre)
+    {
+        for (auto x = 0u; x < imageSize.x; x += PixelsPerMetre)
+        {
+            const glm::vec2 position(x, y);
+            for (const auto& coord : ArrowCoords)
+            {
+                arrowVerts.emplace_back(position, coord, cro::Colour::Yellow);
+            }
+        }
+    }
+    entity.getComponent<cro::Drawable2D>().setVertexData(arrowVerts);
+
     m_mapEnt.getComponent<cro::Transform>().addChild(entity.getComponent<cro::Transform>());
     m_mapNormals = entity;
 
@@ -915,60 +981,12 @@ void MapOverviewState::refreshMap()
 
 void MapOverviewState::updateNormals()
 {
-    const auto imageSize = m_renderBuffer.getSize();
-
-    //so much for doing this all in the shader...
-    std::vector<float> image(imageSize.x * imageSize.y * 4);
-    glBindTexture(GL_TEXTURE_2D, m_sharedData.minimapData.mrt->getTexture(MRTIndex::Normal).textureID);
-    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_FLOAT, image.data());
-
-    //TODO we already have an image mask stored from which we could get the terrain
-    std::vector<float> mask(imageSize.x * imageSize.y);
-    glBindTexture(GL_TEXTURE_2D, m_sharedData.minimapData.mrt->getTexture(MRTIndex::Count).textureID);
-    glGetTexImage(GL_TEXTURE_2D, 0, GL_RED, GL_FLOAT, mask.data());
-
-
-    const auto PixelsPerMetre = (imageSize.x / MapSize.x) * 2;
-    const auto Stride = 4 * PixelsPerMetre;
-
-    //TODO remind ourself how to do the vert building with std::async
-    std::vector<cro::Vertex2D> verts;
-    for (auto y = 0u; y < imageSize.y; y += PixelsPerMetre)
-    {
-        for (auto x = 0u; x < (imageSize.x * 4); x += Stride)
-        {
-            const auto index = y * (imageSize.x * 4) + x;
-
-            if (mask[index / 4] > 0.5f &&
-                image[index + 1] < 0.9999f) //more than this we kinda assume the normal is vertical and skip it
-            {
-                glm::vec2 normal = glm::vec2(image[index], -image[index + 2]) * 50.f;
-                glm::vec2 position(x / 4, y);
-
-                //TODO how do we clamp the length without normalising?
-
-                auto c = cro::Colour::Yellow;
-                verts.emplace_back(position, c);
-                float g = 1.f - std::min(1.f, glm::length2(normal) / (8.f * 8.f));
-                c.setGreen(g);
-                verts.emplace_back((position + normal), c);
-
-                auto endPoint = verts.back().position;
-
-                normal *= 0.8f;
-                glm::vec2 cross(-normal.y, normal.x);
-                cross *= 0.2f;
-                verts.emplace_back(position + normal + cross, c);
-                verts.emplace_back(position + normal - cross, c);
-                verts.emplace_back(position + normal - cross, c);
-                verts.emplace_back(endPoint, c);
-                verts.emplace_back(endPoint, c);
-                verts.emplace_back(position + normal + cross, c);
-            }
-        }
-    }
-
-    m_mapNormals.getComponent<cro::Drawable2D>().setVertexData(verts);
+    //the arrows are all worked out in the vertex shader
+    //so we only need to make sure the current textures are bound
+    auto& drawable = m_mapNormals.getComponent<cro::Drawable2D>();
+    drawable.bindUniform("u_normalMap", m_sharedData.minimapData.mrt->getTexture(MRTIndex::Normal));
+    drawable.bindUniform("u_maskMap", m_sharedData.minimapData.mrt->getTexture(MRTIndex::Count));
+    drawable.bindUniform("u_mapSize", glm::vec2(m_renderBuffer.getSize()));
 }
 
 void MapOverviewState::onCachedPush()
@@ -1941,6 +1941,9 @@ void MenuState::eraseCurrentProfile()
     path += profileID;
     if (cro::FileSystem::directoryExists(path))
     {
+        //the stats DB may still be held open by the profile DB thread
+        m_sharedData.profileDB.close();
+
         std::error_code ec;
         std::filesystem::remove_all(path, ec);
     }
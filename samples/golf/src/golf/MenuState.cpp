@@ -373,6 +373,21 @@ MenuState::MenuState(cro::StateStack& stack, cro::State::Context context, Shared
         sd.quickplayOpponents = 0; //make sure to always reset this
         sd.activeTournament = TournamentIndex::NullVal; //make sure to always reset this
 
+        //benchmarks skip the menu entirely and launch straight into a game
+        if (sd.benchmark.enabled)
+        {
+            auto entity = m_uiScene.createEntity();
+            entity.addComponent<cro::Callback>().active = true;
+            entity.getComponent<cro::Callback>().function =
+                [&](cro::Entity e, float)
+                {
+                    e.getComponent<cro::Callback>().active = false;
+                    m_uiScene.destroyEntity(e);
+
+                    launchBenchmark();
+                };
+        }
+
 
         //we returned from a previous game (this will have been disconnected above, otherwise)
         if (sd.clientConnection.connected)
@@ -2973,7 +2988,7 @@ void MenuState::createScene()
 
         const auto res = m_sharedData.shadowQuality ? ShadowMapHigh : ShadowMapLow;
         cam.shadowMapBuffer.create(res, res);
-        cam.setBlurPassCount(getBlurPassCount(m_sharedData.shadowQuality));
+        applyShadowPreset(cam, m_sharedData.shadowQuality);
 
         cam.setPerspective(m_sharedData.fov * cro::Util::Const::degToRad, texSize.x / texSize.y, 0.1f, 600.f);
         cam.viewport = { 0.f, 0.f, 1.f, 1.f };
@@ -3609,6 +3624,55 @@ void MenuState::launchQuickPlay()
     }
 }
 
+void MenuState::launchBenchmark()
+{
+    const auto& settings = m_sharedData.benchmark;
+    const auto& courses = m_sharedCourseData.courseData;
+    auto course = std::find_if(courses.begin(), courses.end(), 
+        [&settings](const SharedCourseData::CourseData& cd)
+        {
+            return cd.directory == settings.course;
+        });
+
+    if (course == courses.end())
+    {
+        LogE << "Benchmark: course " << settings.course << " not found" << std::endl;
+        cro::App::quit();
+        return;
+    }
+
+    //always use the default profile, controlled by the CPU
+    m_rosterMenu.activeIndex = 0;
+    setProfileIndex(0, false);
+    m_profileData.activeProfileIndex = 0;
+
+    m_sharedData.hosting = true;
+    m_sharedData.gameMode = GameMode::FreePlay;
+    m_sharedData.localConnectionData.playerCount = 1;
+    m_sharedData.localConnectionData.playerData[0].isCPU = true;
+
+    m_sharedData.leagueRoundID = LeagueRoundID::Club;
+    m_sharedData.clubLimit = 0;
+
+    if (quickConnect(m_sharedData))
+    {
+        m_sharedData.serverInstance.setBenchmarkHole(settings.hole);
+
+        m_sharedData.courseIndex = std::distance(courses.begin(), course);
+        m_sharedData.mapDirectory = course->directory;
+
+        auto data = serialiseString(m_sharedData.mapDirectory);
+        m_sharedData.clientConnection.netClient.sendPacket(PacketID::MapInfo, data.data(), data.size(), net::NetFlag::Reliable, ConstVal::NetChannelStrings);
+
+        //PacketID::ConnectionAccepted applies the fixed benchmark rules
+    }
+    else
+    {
+        LogE << "Benchmark: failed to start local server" << std::endl;
+        cro::App::quit();
+    }
+}
+
 void MenuState::launchTournament(std::int32_t tournamentID)
 {
     CRO_ASSERT(tournamentID == 0 || tournamentID == 1, "");
@@ -3906,6 +3970,10 @@ void MenuState::handleNetEvent(const net::NetEvent& evt)
                 {
                     applyTournamentConnection();
                 }
+                else if (m_sharedData.benchmark.enabled)
+                {
+                    applyBenchmarkConnection();
+                }
                 else if (m_sharedData.quickplayOpponents != 0)
                 {
                     //this will also be true if we're in a tournament,
@@ -4020,7 +4088,8 @@ void MenuState::handleNetEvent(const net::NetEvent& evt)
                 //moved to PacketID::ConnectionAcccepted - must happen after sending player info
                 //m_sharedData.clientConnection.netClient.sendPacket(PacketID::RequestGameStart, std::uint8_t(0), cro::NetFlag::Reliable, ConstVal::NetChannelReliable);
             }
-            else if (m_sharedData.quickplayOpponents != 0)
+            else if (m_sharedData.quickplayOpponents != 0
+                || m_sharedData.benchmark.enabled)
             {
                 //see above (this clause just consumes the case so below doesn't happen)
             }
@@ -4890,6 +4959,31 @@ void MenuState::applyQuickPlayConnection()
     m_sharedData.clientConnection.netClient.sendPacket(PacketID::RequestGameStart, std::uint8_t(sv::StateID::Golf), net::NetFlag::Reliable, ConstVal::NetChannelReliable);
 }
 
+void MenuState::applyBenchmarkConnection()
+{
+    //fixed rules so that every run is as similar as possible
+    m_sharedData.reverseCourse = 0;
+    m_sharedData.scoreType = ScoreType::Stroke;
+    m_sharedData.weatherType = WeatherType::Clear;
+    m_sharedData.holeCount = 0; //the server only loads the benchmark hole
+    m_sharedData.gimmeRadius = GimmeSize::Leather;
+    m_sharedData.teamMode = 0;
+
+    m_sharedData.clientConnection.netClient.sendPacket(PacketID::ClubLimit, m_sharedData.clubLimit, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+    m_sharedData.clientConnection.netClient.sendPacket(PacketID::ReverseCourse, m_sharedData.reverseCourse, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+    m_sharedData.clientConnection.netClient.sendPacket(PacketID::ScoreType, m_sharedData.scoreType, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+    m_sharedData.clientConnection.netClient.sendPacket(PacketID::WeatherType, m_sharedData.weatherType, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+    m_sharedData.clientConnection.netClient.sendPacket(PacketID::HoleCount, m_sharedData.holeCount, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+    m_sharedData.clientConnection.netClient.sendPacket(PacketID::NightTime, m_sharedData.nightTime, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+    m_sharedData.clientConnection.netClient.sendPacket(PacketID::GimmeRadius, m_sharedData.gimmeRadius, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+    m_sharedData.clientConnection.netClient.sendPacket(PacketID::TeamMode, m_sharedData.teamMode, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+
+    m_sharedData.clientConnection.netClient.sendPacket(PacketID::RandomWind, std::uint8_t(0), net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+    m_sharedData.clientConnection.netClient.sendPacket(PacketID::MaxWind, std::uint8_t(1), net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+
+    m_sharedData.clientConnection.netClient.sendPacket(PacketID::RequestGameStart, std::uint8_t(sv::StateID::Golf), net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+}
+
 void MenuState::applyTournamentConnection()
 {
     //assuming we have a similar menu in the tournament screen,
@@ -467,6 +467,7 @@ private:
     void togglePreviousScoreCard();
 
     void launchQuickPlay();
+    void launchBenchmark();
     void launchTournament(std::int32_t);
     void handleNetEvent(const net::NetEvent&);
 
@@ -474,6 +475,7 @@ private:
     void applyTutorialConnection();
     void applyCareerConnection();
     void applyQuickPlayConnection();
+    void applyBenchmarkConnection();
     void applyTournamentConnection();
 
     friend struct MainMenuContext;
@@ -270,6 +270,10 @@ namespace PacketID
         SnekUpdate, //< uint16 client|player has been given the snek
         BigBallUpdate, //< uint16(client|player) | uint16 scale 0-11 (rescaled on client to +/-5)
 
+        //spectator relay only, see SpectatorRelay.hpp
+        SpectatorKeyframe, //< list of uint8 PacketID | uint16 size | data describing the current game
+        SpectatorFrame, //< list of uint8 PacketID | uint16 size | data published during the last network tick
+
         //special cases for websocket
         RichPresence = 127
     };
@@ -32,6 +32,8 @@ source distribution.
 #include "GameConsts.hpp"
 #include "spooky2.hpp"
 #include "server/ServerState.hpp"
+#include "shaders/PaletteSwap.inl"
+#include "../ErrorCheck.hpp"
 
 #include <Social.hpp>
 #include <Content.hpp>
@@ -40,6 +42,9 @@ source distribution.
 #include <crogine/core/ConfigFile.hpp>
 
 #include <crogine/graphics/ImageArray.hpp>
+#include <crogine/graphics/Shader.hpp>
+
+#include <unordered_map>
 
 PlayerData& PlayerData::operator=(const sv::PlayerInfo& pi)
 {
@@ -328,81 +333,241 @@ bool PlayerData::loadProfile(const std::string& path, const std::string& uid)
 
 //------------------------------------------------------------
 
-ProfileTexture::ProfileTexture(const std::string& path)
-    : m_imageBuffer (std::make_unique<cro::Image>(true)),
-    m_texture       (std::make_unique<cro::Texture>())
+struct ProfileTexture::Source final
 {
-    if (m_imageBuffer->loadFromFile(path) //MUST be RGBA for colour replace to work.
-        && m_imageBuffer->getFormat() == cro::ImageFormat::RGBA)
+    cro::Texture baseMap;
+    cro::Texture indexMap; //colour key + 1 in the red channel, or 0 if not keyed
+};
+
+class ProfileTexture::Recolourer final
+{
+public:
+    Recolourer()
     {
-        //cache color indices
-        auto stride = 4u;
-        auto length = m_imageBuffer->getSize().x * m_imageBuffer->getSize().y * stride;
-        const auto* pixels = m_imageBuffer->getPixelData();
+        if (m_shader.loadFromString(AvatarRecolourVertex, AvatarRecolourFragment, "#define KEY_COUNT " + std::to_string(pc::ColourKey::Count) + "\n"))
+        {
+            const auto handle = m_shader.getGLHandle();
+            m_baseUniform = glGetUniformLocation(handle, "u_baseMap");
+            m_indexUniform = glGetUniformLocation(handle, "u_indexMap");
+            m_paletteUniform = glGetUniformLocation(handle, "u_palette");
+
+            glCheck(glGenFramebuffers(1, &m_fbo));
+#ifdef PLATFORM_DESKTOP
+            //core profile requires a VAO to draw, even with no attributes
+            glCheck(glGenVertexArrays(1, &m_vao));
+#endif
+        }
+        else
+        {
+            LogE << "Failed compiling avatar recolour shader" << std::endl;
+        }
+    }
 
-        for (auto i = 0u; i < length; i += stride)
+    ~Recolourer()
+    {
+        if (m_fbo)
+        {
+            glCheck(glDeleteFramebuffers(1, &m_fbo));
+        }
+#ifdef PLATFORM_DESKTOP
+        if (m_vao)
         {
-            auto alpha = pixels[i + (stride - 1)];
+            glCheck(glDeleteVertexArrays(1, &m_vao));
+        }
+#endif
+    }
+
+    Recolourer(const Recolourer&) = delete;
+    Recolourer& operator = (const Recolourer&) = delete;
+
+    void draw(const Source& source, const std::array<glm::vec4, pc::ColourKey::Count>& palette, cro::Texture& dst)
+    {
+        if (m_fbo == 0)
+        {
+            return;
+        }
+
+        const auto size = source.baseMap.getSize();
+        if (dst.getSize() != size
+            || dst.getFormat() != cro::ImageFormat::RGBA)
+        {
+            dst.create(size.x, size.y);
+        }
+
+        //store the current state so we can draw this any time, eg
+        //while a menu is being updated, without breaking other targets
+        GLint prevFbo = 0;
+        GLint prevViewport[4];
+        glCheck(glGetIntegerv(GL_FRAMEBUFFER_BINDING, &prevFbo));
+        glCheck(glGetIntegerv(GL_VIEWPORT, prevViewport));
+        const bool blend = glIsEnabled(GL_BLEND);
+        const bool depthTest = glIsEnabled(GL_DEPTH_TEST);
+        const bool cullFace = glIsEnabled(GL_CULL_FACE);
+        const bool scissor = glIsEnabled(GL_SCISSOR_TEST);
+
+        glCheck(glBindFramebuffer(GL_FRAMEBUFFER, m_fbo));
+        glCheck(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, dst.getGLHandle(), 0));
+        glCheck(glViewport(0, 0, size.x, size.y));
+        glCheck(glDisable(GL_BLEND));
+        glCheck(glDisable(GL_DEPTH_TEST));
+        glCheck(glDisable(GL_CULL_FACE));
+        glCheck(glDisable(GL_SCISSOR_TEST));
+
+        glCheck(glUseProgram(m_shader.getGLHandle()));
+        glCheck(glActiveTexture(GL_TEXTURE0));
+        glCheck(glBindTexture(GL_TEXTURE_2D, source.baseMap.getGLHandle()));
+        glCheck(glUniform1i(m_baseUniform, 0));
+        glCheck(glActiveTexture(GL_TEXTURE1));
+        glCheck(glBindTexture(GL_TEXTURE_2D, source.indexMap.getGLHandle()));
+        glCheck(glUniform1i(m_indexUniform, 1));
+        glCheck(glUniform4fv(m_paletteUniform, pc::ColourKey::Count, &palette[0][0]));
+
+#ifdef PLATFORM_DESKTOP
+        glCheck(glBindVertexArray(m_vao));
+        glCheck(glDrawArrays(GL_TRIANGLES, 0, 3));
+        glCheck(glBindVertexArray(0));
+#else
+        glCheck(glDrawArrays(GL_TRIANGLES, 0, 3));
+#endif
+
+        glCheck(glBindTexture(GL_TEXTURE_2D, 0));
+        glCheck(glActiveTexture(GL_TEXTURE0));
+        glCheck(glBindTexture(GL_TEXTURE_2D, 0));
+        glCheck(glUseProgram(0));
+
+        glCheck(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0));
+        glCheck(glBindFramebuffer(GL_FRAMEBUFFER, prevFbo));
+        glCheck(glViewport(prevViewport[0], prevViewport[1], prevViewport[2], prevViewport[3]));
+        if (blend) glCheck(glEnable(GL_BLEND));
+        if (depthTest) glCheck(glEnable(GL_DEPTH_TEST));
+        if (cullFace) glCheck(glEnable(GL_CULL_FACE));
+        if (scissor) glCheck(glEnable(GL_SCISSOR_TEST));
+    }
+
+private:
+    cro::Shader m_shader;
+    std::int32_t m_baseUniform = -1;
+    std::int32_t m_indexUniform = -1;
+    std::int32_t m_paletteUniform = -1;
+
+    std::uint32_t m_fbo = 0;
+    std::uint32_t m_vao = 0;
+};
+
+namespace
+{
+    //profile textures are created and recoloured many times over in
+    //the menus, so share the GPU resources between all of them while
+    //at least one is alive.
+    std::unordered_map<std::string, std::weak_ptr<const ProfileTexture::Source>> sourceCache;
+    std::weak_ptr<ProfileTexture::Recolourer> sharedRecolourer;
 
-            switch (pixels[i])
+    std::shared_ptr<const ProfileTexture::Source> loadSource(const std::string& path)
+    {
+        if (auto source = sourceCache[path].lock(); source)
+        {
+            return source;
+        }
+
+        auto source = std::make_shared<ProfileTexture::Source>();
+
+        cro::Image img(true);
+        if (img.loadFromFile(path) //MUST be RGBA for colour replace to work.
+            && img.getFormat() == cro::ImageFormat::RGBA)
+        {
+            //store the colour key for each pixel so that
+            //recolouring is just a palette look up
+            constexpr auto stride = 4u;
+            const auto size = img.getSize();
+            const auto length = size.x * size.y * stride;
+            const auto* pixels = img.getPixelData();
+
+            std::vector<std::uint8_t> indices(length);
+            for (auto i = 0u; i < length; i += stride)
             {
-            default: break;
-            case pc::Keys[pc::ColourKey::BottomDark]:
-                if (alpha) m_keyIndices[pc::ColourKey::BottomDark].push_back(i / stride);
-                break;
-            case pc::Keys[pc::ColourKey::BottomLight]:
-                if (alpha) m_keyIndices[pc::ColourKey::BottomLight].push_back(i / stride);
-                break;
-
-            case pc::Keys[pc::ColourKey::TopDark]:
-                if (alpha) m_keyIndices[pc::ColourKey::TopDark].push_back(i / stride);
-                break;
-            case pc::Keys[pc::ColourKey::TopLight]:
-                if (alpha) m_keyIndices[pc::ColourKey::TopLight].push_back(i / stride);
-                break;
-
-            case pc::Keys[pc::ColourKey::Skin]:
-            case 0x3c: //hack around old textures having two tone skin
-                if (alpha) m_keyIndices[pc::ColourKey::Skin].push_back(i / stride);
-                break;
-
-            case pc::Keys[pc::ColourKey::Hair]:
-                if (alpha) m_keyIndices[pc::ColourKey::Hair].push_back(i / stride);
-                break;
-
-            case pc::Keys[pc::ColourKey::Hat]:
-                if (alpha) m_keyIndices[pc::ColourKey::Hat].push_back(i / stride);
-                break;
+                auto alpha = pixels[i + (stride - 1)];
+                if (alpha == 0)
+                {
+                    continue;
+                }
+
+                std::uint8_t key = 0;
+                switch (pixels[i])
+                {
+                default: break;
+                case pc::Keys[pc::ColourKey::BottomDark]:
+                    key = pc::ColourKey::BottomDark + 1;
+                    break;
+                case pc::Keys[pc::ColourKey::BottomLight]:
+                    key = pc::ColourKey::BottomLight + 1;
+                    break;
+
+                case pc::Keys[pc::ColourKey::TopDark]:
+                    key = pc::ColourKey::TopDark + 1;
+                    break;
+                case pc::Keys[pc::ColourKey::TopLight]:
+                    key = pc::ColourKey::TopLight + 1;
+                    break;
+
+                case pc::Keys[pc::ColourKey::Skin]:
+                case 0x3c: //hack around old textures having two tone skin
+                    key = pc::ColourKey::Skin + 1;
+                    break;
+
+                case pc::Keys[pc::ColourKey::Hair]:
+                    key = pc::ColourKey::Hair + 1;
+                    break;
+
+                case pc::Keys[pc::ColourKey::Hat]:
+                    key = pc::ColourKey::Hat + 1;
+                    break;
+                }
+                indices[i] = key;
             }
+
+            source->baseMap.loadFromImage(img);
+
+            //stored as RGBA so rows are always correctly aligned
+            source->indexMap.create(size.x, size.y);
+            source->indexMap.update(indices.data());
+        }
+        else
+        {
+            LogE << path << ": file not loaded or not RGBA" << std::endl;
+            img.create(48, 52, cro::Colour::Magenta);
+            source->baseMap.loadFromImage(img);
+
+            std::vector<std::uint8_t> indices(48 * 52 * 4);
+            source->indexMap.create(48, 52);
+            source->indexMap.update(indices.data());
         }
 
-        apply();
+        sourceCache[path] = source;
+        return source;
     }
-    else
+}
+
+ProfileTexture::ProfileTexture(const std::string& path)
+    : m_source  (loadSource(path)),
+    m_recolourer(sharedRecolourer.lock()),
+    m_texture   (std::make_unique<cro::Texture>())
+{
+    if (!m_recolourer)
     {
-        LogE << path << ": file not loaded or not RGBA" << std::endl;
-        m_imageBuffer->create(48, 52, cro::Colour::Magenta);
+        m_recolourer = std::make_shared<Recolourer>();
+        sharedRecolourer = m_recolourer;
     }
+
+    apply();
 }
 
 void ProfileTexture::setColour(pc::ColourKey::Index idx, std::int8_t cIdx)
 {
     CRO_ASSERT(cIdx < pc::Palette.size(), "");
 
-    const auto imgWidth = m_imageBuffer->getSize().x;
-    //cache the colour and only update if it changed.
-    if ( m_colours[idx] != pc::Palette[cIdx])
-    {
-        for (auto i : m_keyIndices[idx])
-        {
-            //set the colour in the image at this index
-            auto x = i % imgWidth;
-            auto y = i / imgWidth;
-
-            m_imageBuffer->setPixel(x, y, pc::Palette[cIdx]);
-        }
-        m_colours[idx] = pc::Palette[cIdx];
-    }
+    //only stored here - the texture is updated on the GPU by apply()
+    m_colours[idx] = pc::Palette[cIdx];
+    m_coloursSet[idx] = true;
 }
 
 const cro::Colour& ProfileTexture::getColour(pc::ColourKey::Index idx) const
@@ -412,14 +577,14 @@ const cro::Colour& ProfileTexture::getColour(pc::ColourKey::Index idx) const
 
 void ProfileTexture::apply(cro::Texture* dst)
 {
-    if (dst)
+    //keys which have never been set keep their original colour
+    std::array<glm::vec4, pc::ColourKey::Count> palette = {};
+    for (auto i = 0u; i < palette.size(); ++i)
     {
-        dst->loadFromImage(*m_imageBuffer);
-    }
-    else
-    {
-        m_texture->loadFromImage(*m_imageBuffer);
+        palette[i] = m_coloursSet[i] ? m_colours[i].getVec4() : glm::vec4(-2.f);
     }
+
+    m_recolourer->draw(*m_source, palette, dst ? *dst : *m_texture);
 }
 
 void ProfileTexture::setMugshot(const std::string& path)
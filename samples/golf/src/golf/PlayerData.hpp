@@ -144,14 +144,20 @@ struct ProfileTexture
     void setMugshot(const std::string&);
     const cro::Texture* getMugshot() const;
 
+    //base texture and colour key index map, shared by
+    //all profile textures loaded from the same file
+    struct Source;
+    //draws a source with a palette into a destination texture
+    class Recolourer;
+
 private:
     //make these pointers because this struct is
     //stored in a vector
-    std::unique_ptr<cro::Image> m_imageBuffer;
+    std::shared_ptr<const Source> m_source;
+    std::shared_ptr<Recolourer> m_recolourer;
     std::unique_ptr<cro::Texture> m_texture;
     std::unique_ptr<cro::Texture> m_mugshot;
 
-    std::array<std::vector<std::uint32_t>, pc::ColourKey::Count> m_keyIndices;
-
     std::array<cro::Colour, pc::ColourKey::Count> m_colours;
+    std::array<bool, pc::ColourKey::Count> m_coloursSet = {};
 };
\ No newline at end of file
@@ -0,0 +1,237 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+Super Video Golf - zlib licence.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include "RenderGraph.hpp"
+
+#include <crogine/core/Console.hpp>
+#include <crogine/core/HiResTimer.hpp>
+#include <crogine/ecs/components/Camera.hpp>
+#include <crogine/graphics/GPUProfiler.hpp>
+#include <crogine/detail/Assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+    //weights the running average of each pass's cost
+    constexpr float CostSmoothing = 0.1f;
+}
+
+RenderGraph::PassID RenderGraph::addPass(Pass pass)
+{
+    CRO_ASSERT(pass.render, "");
+    pass.interval = std::max(1u, pass.interval);
+
+    auto& state = m_passes.emplace_back();
+    state.pass = std::move(pass);
+    state.requested = state.pass.rate == Rate::OnDemand;
+
+    return m_passes.size() - 1;
+}
+
+void RenderGraph::requestUpdate(PassID id)
+{
+    CRO_ASSERT(id < m_passes.size(), "");
+    m_passes[id].requested = true;
+
+    //make sure the cameras are culled before it's drawn
+    if (!m_passes[id].scheduled)
+    {
+        m_passes[id].scheduled = true;
+        for (auto cam : m_passes[id].pass.cameras)
+        {
+            cam.getComponent<cro::Camera>().refreshDrawLists = true;
+        }
+    }
+}
+
+void RenderGraph::setInterval(PassID id, std::uint32_t interval)
+{
+    CRO_ASSERT(id < m_passes.size(), "");
+    m_passes[id].pass.interval = std::max(1u, interval);
+}
+
+void RenderGraph::setReducedRatesEnabled(bool enabled)
+{
+    m_reducedRates = enabled;
+    schedule();
+}
+
+void RenderGraph::execute()
+{
+    m_frameCount++;
+
+    for (auto& state : m_passes)
+    {
+        const bool enabled = isEnabled(state);
+
+        //a pass which has just been enabled has nothing
+        //worth showing in its target so draw it right away
+        if (enabled && !state.wasEnabled)
+        {
+            state.requested = true;
+        }
+        state.wasEnabled = enabled;
+
+        if (!enabled
+            || !(state.scheduled || state.requested))
+        {
+            state.framesSinceUpdate++;
+            continue;
+        }
+
+        {
+            CRO_GPU_SCOPE(state.pass.name);
+            cro::HiResTimer timer;
+            state.pass.render();
+
+            const float cost = timer.restart() * 1000.f;
+            state.averageCost = state.drawCount == 0 ? cost : state.averageCost + ((cost - state.averageCost) * CostSmoothing);
+        }
+
+        state.framesSinceUpdate = 0;
+        state.requested = false;
+        state.drawCount++;
+    }
+
+    schedule();
+}
+
+void RenderGraph::printStats() const
+{
+    cro::Console::print("Reduced rates: " + std::string(m_reducedRates ? "on" : "off") + ", budget " + std::to_string(m_budget) + "ms");
+
+    for (const auto& state : m_passes)
+    {
+        static const std::array<std::string, 3u> RateNames = { "every frame", "reduced", "on demand" };
+
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(3);
+        ss << state.pass.name << ": " << RateNames[static_cast<std::int32_t>(state.pass.rate)];
+        if (state.pass.rate == Rate::Reduced)
+        {
+            ss << " (1/" << state.pass.interval << ")";
+        }
+        ss << ", " << state.averageCost << "ms, drawn " << state.drawCount << "/" << m_frameCount << " frames";
+
+        cro::Console::print(ss.str());
+    }
+}
+
+//private
+bool RenderGraph::isEnabled(const PassState& state) const
+{
+    return !state.pass.enabled || state.pass.enabled();
+}
+
+void RenderGraph::schedule()
+{
+    //passes which are due but may be deferred if over budget
+    std::vector<PassState*> candidates;
+    float remainingBudget = m_budget;
+
+    for (auto& state : m_passes)
+    {
+        const auto frames = state.framesSinceUpdate + 1;
+
+        switch (state.pass.rate)
+        {
+        default:
+        case Rate::EveryFrame:
+            state.scheduled = true;
+            break;
+        case Rate::Reduced:
+            if (!m_reducedRates
+                || state.requested
+                || frames >= state.pass.interval * 2) //don't let it starve
+            {
+                state.scheduled = true;
+                remainingBudget -= state.averageCost;
+            }
+            else
+            {
+                state.scheduled = false;
+                if (frames >= state.pass.interval)
+                {
+                    candidates.push_back(&state);
+                }
+            }
+            break;
+        case Rate::OnDemand:
+            state.scheduled = state.requested;
+            if (state.scheduled)
+            {
+                remainingBudget -= state.averageCost;
+            }
+            break;
+        }
+    }
+
+    //most overdue first, then by declaration order
+    std::stable_sort(candidates.begin(), candidates.end(),
+        [](const PassState* a, const PassState* b)
+        {
+            return (a->framesSinceUpdate + 1) * b->pass.interval > (b->framesSinceUpdate + 1) * a->pass.interval;
+        });
+
+    for (auto* state : candidates)
+    {
+        if (state->averageCost <= remainingBudget)
+        {
+            state->scheduled = true;
+            remainingBudget -= state->averageCost;
+        }
+    }
+
+    //cameras may be shared between passes, so only skip culling
+    //if none of their passes are drawn. Cameras of disabled passes
+    //are left alone so that they're ready when the pass is enabled
+    for (auto& state : m_passes)
+    {
+        for (auto cam : state.pass.cameras)
+        {
+            cam.getComponent<cro::Camera>().refreshDrawLists = false;
+        }
+    }
+
+    for (auto& state : m_passes)
+    {
+        if (state.scheduled
+            || !isEnabled(state))
+        {
+            for (auto cam : state.pass.cameras)
+            {
+                cam.getComponent<cro::Camera>().refreshDrawLists = true;
+            }
+        }
+    }
+}
@@ -0,0 +1,106 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+Super Video Golf - zlib licence.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include <crogine/ecs/Entity.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+//declares the passes which make up a frame, in the order in
+//which they're drawn. Passes which draw secondary views such
+//as reflections or the overhead map can update at a reduced
+//rate, or only on request, and are scheduled within a CPU
+//budget so they don't all land on the same frame. Cameras
+//belonging to a pass are only culled when the pass is drawn.
+class RenderGraph final
+{
+public:
+    enum class Rate
+    {
+        EveryFrame,
+        Reduced, //drawn every interval frames, deferred up to twice that if over budget
+        OnDemand //only drawn when requestUpdate() is called
+    };
+
+    struct Pass final
+    {
+        const char* name = nullptr; //must have static storage as it's used for GPU timing
+        std::function<void()> render; //clears, draws and displays the pass's target(s)
+        std::function<bool()> enabled; //optional, the pass is skipped while this returns false
+        std::vector<cro::Entity> cameras; //draw lists are only refreshed on frames when the pass is drawn
+        Rate rate = Rate::EveryFrame;
+        std::uint32_t interval = 1;
+    };
+    using PassID = std::size_t;
+
+    PassID addPass(Pass pass);
+
+    //forces the pass to be drawn on the next frame regardless
+    //of budget, eg when the view it draws has changed
+    void requestUpdate(PassID id);
+
+    void setInterval(PassID id, std::uint32_t interval);
+
+    //time in milliseconds reduced rate passes may spend per frame
+    void setBudget(float ms) { m_budget = ms; }
+    float getBudget() const { return m_budget; }
+
+    //when disabled all enabled passes are drawn every frame
+    void setReducedRatesEnabled(bool enabled);
+    bool getReducedRatesEnabled() const { return m_reducedRates; }
+
+    //draws all passes scheduled for this frame, then schedules the next
+    void execute();
+
+    void printStats() const;
+
+private:
+    struct PassState final
+    {
+        Pass pass;
+        std::uint32_t framesSinceUpdate = 0;
+        float averageCost = 0.f; //ms
+        bool requested = false;
+        bool scheduled = true;
+        bool wasEnabled = false;
+
+        std::uint64_t drawCount = 0;
+    };
+    std::vector<PassState> m_passes;
+
+    float m_budget = 1.5f;
+    bool m_reducedRates = true;
+    std::uint64_t m_frameCount = 0;
+
+    bool isEnabled(const PassState&) const;
+    void schedule();
+};
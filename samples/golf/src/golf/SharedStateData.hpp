@@ -37,6 +37,7 @@ source distribution.
 #include "Tournament.hpp"
 #include "Inventory.hpp"
 #include "server/Server.hpp"
+#include "../sqlite/AsyncProfileDB.hpp"
 
 #include <crogine/audio/MumbleLink.hpp>
 #include <crogine/audio/sound_system/Playlist.hpp>
@@ -153,6 +154,7 @@ struct SharedStateData final
     }minimapData;
 
     Server serverInstance;
+    AsyncProfileDB profileDB; //all profile stats are read and written through this so they never block a frame
 
     struct ClientConnection final
     {
@@ -351,6 +353,17 @@ struct SharedStateData final
     };
     std::int32_t shadowQuality = ShadowQuality::Low;
     bool logBenchmarks = false;
+
+    //set from the command line with --benchmark
+    struct BenchmarkSettings final
+    {
+        bool enabled = false;
+        std::string course = "course_01";
+        std::int32_t hole = 0;
+        glm::uvec2 resolution = glm::uvec2(1280, 720);
+        bool nightTime = false;
+        std::string outputPath; //if empty written to the benchmark directory in the prefs path
+    }benchmark;
     bool showCustomCourses = true;
     bool showTutorialTip = true;
     bool showPuttingPower = true;
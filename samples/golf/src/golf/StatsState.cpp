@@ -354,6 +354,19 @@ void StatsState::handleMessage(const cro::Message& msg)
 
 bool StatsState::simulate(float dt)
 {
+    //apply any DB queries which have completed
+    if (m_pendingPerformance.records.valid()
+        && m_pendingPerformance.records.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+        applyPerformanceRecords(m_pendingPerformance.records.get(), m_pendingPerformance.maxPoints);
+    }
+
+    if (m_pendingPerformance.personalBests.valid()
+        && m_pendingPerformance.personalBests.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+        applyPersonalBests(m_pendingPerformance.personalBests.get());
+    }
+
     m_scene.simulate(dt);
     return true;
 }
@@ -1042,7 +1055,7 @@ void StatsState::createPerformanceTab(cro::Entity parent, const cro::SpriteSheet
                     titleText.getComponent<cro::Text>().setString(m_courseStrings[m_courseIndex].second);
                     centreText(titleText);
 
-                    refreshPerformanceTab(false);
+                    refreshPerformanceTab();
 
                     m_audioEnts[AudioID::Accept].getComponent<cro::AudioEmitter>().play();
                 }
@@ -1075,7 +1088,7 @@ void StatsState::createPerformanceTab(cro::Entity parent, const cro::SpriteSheet
                     titleText.getComponent<cro::Text>().setString(m_courseStrings[m_courseIndex].second);
                     centreText(titleText);
 
-                    refreshPerformanceTab(false);
+                    refreshPerformanceTab();
 
                     m_audioEnts[AudioID::Accept].getComponent<cro::AudioEmitter>().play();
                 }
@@ -1117,7 +1130,7 @@ void StatsState::createPerformanceTab(cro::Entity parent, const cro::SpriteSheet
                 if (activated(evt))
                 {
                     m_showCPUStat = !m_showCPUStat;
-                    refreshPerformanceTab(false);
+                    refreshPerformanceTab();
 
                     m_audioEnts[AudioID::Accept].getComponent<cro::AudioEmitter>().play();
                 }
@@ -1189,7 +1202,7 @@ void StatsState::createPerformanceTab(cro::Entity parent, const cro::SpriteSheet
                         profileName.getComponent<cro::Text>().setString(m_profileData[m_profileIndex].name);
                         centreText(profileName);
 
-                        refreshPerformanceTab(true);
+                        refreshPerformanceTab();
 
                         m_audioEnts[AudioID::Accept].getComponent<cro::AudioEmitter>().play();
                     }
@@ -1232,7 +1245,7 @@ void StatsState::createPerformanceTab(cro::Entity parent, const cro::SpriteSheet
                         profileName.getComponent<cro::Text>().setString(m_profileData[m_profileIndex].name);
                         centreText(profileName);
 
-                        refreshPerformanceTab(true);
+                        refreshPerformanceTab();
 
                         m_audioEnts[AudioID::Accept].getComponent<cro::AudioEmitter>().play();
                     }
@@ -1295,7 +1308,7 @@ void StatsState::createPerformanceTab(cro::Entity parent, const cro::SpriteSheet
                     rangeText.getComponent<cro::Text>().setString(RangeStrings[m_dateRange]);
                     centreText(rangeText);
 
-                    refreshPerformanceTab(false);
+                    refreshPerformanceTab();
 
                     m_audioEnts[AudioID::Accept].getComponent<cro::AudioEmitter>().play();
                 }
@@ -1499,7 +1512,7 @@ void StatsState::createPerformanceTab(cro::Entity parent, const cro::SpriteSheet
 
     m_recordCountEntity = entity;
 
-    refreshPerformanceTab(true);
+    refreshPerformanceTab();
 }
 
 void StatsState::createHistoryTab(cro::Entity parent)
@@ -2146,22 +2159,13 @@ void StatsState::activateTab(std::int32_t tabID)
     }
 }
 
-void StatsState::refreshPerformanceTab(bool newProfile)
+void StatsState::refreshPerformanceTab()
 {
     if (m_profileData.empty())
     {
         return;
     }
 
-    if (newProfile)
-    {
-        if (!m_profileDB.open(m_profileData[m_profileIndex].dbPath))
-        {
-            LogE << "Failed opening " << m_profileData[m_profileIndex].dbPath << std::endl;
-            return;
-        }
-    }
-
     std::size_t maxPoints = 52; //8px apart
 
     //set a max number of entries in a given period
@@ -2190,7 +2194,16 @@ void StatsState::refreshPerformanceTab(bool newProfile)
         break;
     }
 
-    auto records = m_profileDB.getCourseRecords(m_courseIndex, ts, m_showCPUStat);
+    //the results are applied in simulate() when they're ready. Any
+    //outstanding results are replaced as they'll be out of date
+    const auto& dbPath = m_profileData[m_profileIndex].dbPath;
+    m_pendingPerformance.records = m_sharedData.profileDB.getCourseRecords(dbPath, static_cast<std::int32_t>(m_courseIndex), ts, m_showCPUStat);
+    m_pendingPerformance.personalBests = m_sharedData.profileDB.getPersonalBest(dbPath, static_cast<std::int32_t>(m_courseIndex));
+    m_pendingPerformance.maxPoints = maxPoints;
+}
+
+void StatsState::applyPerformanceRecords(const std::vector<CourseRecord>& records, std::size_t maxPoints)
+{
     if (records.empty())
     {
         //reset the graph
@@ -2250,8 +2263,11 @@ void StatsState::refreshPerformanceTab(bool newProfile)
     centreText(m_recordCountEntity);
 
 
+}
+
+void StatsState::applyPersonalBests(const std::vector<PersonalBestRecord>& personalBest)
+{
     //personal best info for each hole
-    auto personalBest = m_profileDB.getPersonalBest(m_courseIndex);
     for (auto i = 0u; i < m_holeDetailEntities.size(); ++i)
     {
         m_holeDetailEntities[i].getComponent<cro::Callback>().getUserData<GraphFadeData>().detailString = "Hole " +std::to_string(i+1) +"\n\nNo Hole Information";
@@ -42,6 +42,8 @@ source distribution.
 #include <crogine/graphics/SimpleQuad.hpp>
 #include <crogine/graphics/SimpleText.hpp>
 
+#include <future>
+
 struct SharedStateData;
 namespace cro
 {
@@ -172,7 +174,12 @@ private:
         static constexpr glm::vec2 Top = glm::vec2(27.f, 126.f);
     }m_holeDetail;
 
-    ProfileDB m_profileDB;
+    struct PendingPerformance final
+    {
+        std::future<std::vector<CourseRecord>> records;
+        std::future<std::vector<PersonalBestRecord>> personalBests;
+        std::size_t maxPoints = 0;
+    }m_pendingPerformance;
 
     cro::RenderTexture m_awardsTexture;
     cro::SimpleQuad m_awardQuad;
@@ -221,6 +228,8 @@ private:
     void createAwardsTab(cro::Entity, const cro::SpriteSheet&);
     void refreshAwardsTab(std::int32_t page);
     void activateTab(std::int32_t);
-    void refreshPerformanceTab(bool newProfile);
+    void refreshPerformanceTab();
+    void applyPerformanceRecords(const std::vector<CourseRecord>&, std::size_t maxPoints);
+    void applyPersonalBests(const std::vector<PersonalBestRecord>&);
     void quitState();
 };
\ No newline at end of file
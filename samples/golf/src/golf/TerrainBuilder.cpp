@@ -37,6 +37,7 @@ source distribution.
 #include "VatAnimationSystem.hpp"
 #include "SharedStateData.hpp"
 
+#include <crogine/core/Profiler.hpp>
 #include <crogine/ecs/Scene.hpp>
 #include <crogine/ecs/components/Transform.hpp>
 #include <crogine/ecs/components/Callback.hpp>
@@ -60,7 +61,10 @@ source distribution.
 
 #include "../ErrorCheck.hpp"
 
-#include <chrono>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <random>
 
 using namespace cl;
 
@@ -179,8 +183,7 @@ TerrainBuilder::TerrainBuilder(SharedStateData& sd, const std::vector<HoleData>&
     m_currentHole   (0),
     m_swapIndex     (0),
     m_terrainBuffer ((MapSize.x * MapSize.y) / QuadsPerMetre),
-    m_threadRunning (false),
-    m_wantsUpdate   (false)
+    m_normalMapReadback(0)
 {
     m_slopeBuffer.reserve(SlopeGridSize * SlopeGridSize * 4);
 #ifdef CRO_DEBUG_
@@ -218,11 +221,15 @@ TerrainBuilder::TerrainBuilder(SharedStateData& sd, const std::vector<HoleData>&
 
 TerrainBuilder::~TerrainBuilder()
 {
-    m_threadRunning = false;
+    cro::GPUReadback::cancel(m_normalMapReadback);
+    cro::JobSystem::wait(m_layoutJob);
 
-    if (m_thread)
+    for (const auto& chunk : m_terrainChunks)
     {
-        m_thread->join();
+        if (chunk.ibo)
+        {
+            glCheck(glDeleteBuffers(1, &chunk.ibo));
+        }
     }
 }
 
@@ -241,31 +248,6 @@ void TerrainBuilder::create(cro::ResourceCollection& resources, cro::Scene& scen
         m_terrainBuffer[i].colour = theme.grassColour.getVec4();
     }
 
-    static constexpr auto xCount = static_cast<std::uint32_t>(MapSize.x / QuadsPerMetre);
-    static constexpr auto yCount = static_cast<std::uint32_t>(MapSize.y / QuadsPerMetre);
-    std::vector<std::uint32_t> indices;// (xCount * yCount * 6);
-
-
-    for (auto y = 0u; y < yCount - 1; ++y)
-    {
-        if (y > 0)
-        {
-            indices.push_back((y + 1) * xCount);
-        }
-
-        for (auto x = 0u; x < xCount; x++)
-        {
-            indices.push_back(((y + 1) * xCount) + x);
-            indices.push_back((y * xCount) + x);
-        }
-
-        if (y < yCount - 2)
-        {
-            indices.push_back((y * xCount) + (xCount - 1));
-        }
-    }
-
-
     //use a custom material for morphage
     std::string wobble;
     if (m_sharedData.vertexSnap)
@@ -285,7 +267,8 @@ void TerrainBuilder::create(cro::ResourceCollection& resources, cro::Scene& scen
     auto materialID = resources.materials.add(shader);
     auto flags = cro::VertexProperty::Position | cro::VertexProperty::Colour | cro::VertexProperty::Normal |
         cro::VertexProperty::Tangent | cro::VertexProperty::Bitangent; //use tan/bitan slots to store target position/normal
-    auto meshID = resources.meshes.loadMesh(cro::DynamicMeshBuilder(flags, 1, GL_TRIANGLE_STRIP));
+    //the index buffer of this mesh isn't used as each chunk has its own
+    auto meshID = resources.meshes.loadMesh(cro::DynamicMeshBuilder(flags, 1, GL_TRIANGLES));
     auto terrainMat = resources.materials.get(materialID);
     terrainMat.setProperty("u_noiseColour", theme.grassTint);
     terrainMat.addCustomSetting(GL_CLIP_DISTANCE1);
@@ -316,28 +299,14 @@ void TerrainBuilder::create(cro::ResourceCollection& resources, cro::Scene& scen
             e.getComponent<cro::Callback>().active = false;
         }
     };
-    entity.addComponent<cro::Model>(resources.meshes.getMesh(meshID), terrainMat);
-    entity.getComponent<cro::Model>().setShadowMaterial(0, terrainShadowMat);
-    entity.getComponent<cro::Model>().setRenderFlags(~(RenderFlags::MiniMap | RenderFlags::MiniGreen));
-    entity.addComponent<cro::ShadowCaster>();
-
-    auto* meshData = &entity.getComponent<cro::Model>().getMeshData();
-    meshData->vertexCount = static_cast<std::uint32_t>(m_terrainBuffer.size());
-    meshData->boundingBox[0] = glm::vec3(0.f, -10.f, 0.f);
-    meshData->boundingBox[1] = glm::vec3(MaxBounds[0], 10.f, -MaxBounds[1]);
-    meshData->boundingSphere.centre = { MaxBounds[0] / 2.f, 0.f, -MaxBounds[1] / 2.f };
-    meshData->boundingSphere.radius = glm::length(meshData->boundingSphere.centre);
-    m_terrainProperties.vbo = meshData->vbo;
-    //vert data is uploaded to vbo via update()
+    m_terrainEntity = entity;
 
-    auto* submesh = &meshData->indexData[0];
-    submesh->indexCount = static_cast<std::uint32_t>(indices.size());
-    glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, submesh->ibo));
-    glCheck(glBufferData(GL_ELEMENT_ARRAY_BUFFER, submesh->indexCount * sizeof(std::uint32_t), indices.data(), GL_STATIC_DRAW));
-    glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+    auto meshData = resources.meshes.getMesh(meshID);
+    meshData.vertexCount = m_terrainBuffer.size();
+    m_terrainProperties.vbo = meshData.vbo;
+    //vert data is uploaded to vbo via update()
 
-    //parent the shrubbery so they always stay the same relative height
-    m_terrainEntity = entity;
+    createTerrainChunks(meshData, terrainMat, terrainShadowMat, scene);
 
     //modified billboard shader - shader loading is done in GolfState::loadAssets()
     auto billboardMatID = resources.materials.add(resources.shaders.get(ShaderID::Billboard));
@@ -389,6 +358,7 @@ void TerrainBuilder::create(cro::ResourceCollection& resources, cro::Scene& scen
         auto transition = ShrubTransition();
         transition.terrainEntity = m_terrainEntity;
         entity.addComponent<cro::Callback>().function = transition;
+        //parent the shrubbery so they always stay the same relative height
         m_terrainEntity.getComponent<cro::Transform>().addChild(entity.getComponent<cro::Transform>());
 
 
@@ -545,8 +515,7 @@ void TerrainBuilder::create(cro::ResourceCollection& resources, cro::Scene& scen
                 crowdDef.createModel(childEnt);
 
                 //setup material
-                std::unique_ptr<cro::ArrayTexture<float, 4u, cro::TexturePrecision::Low>> tex =
-                    std::make_unique<cro::ArrayTexture<float, 4u, cro::TexturePrecision::Low>>();
+                auto tex = std::make_unique<VatFile::ArrayTexture>();
                 if (!m_sharedData.vertexSnap && vatFile.fillArrayTexture(*tex))
                 {
                     auto material = resources.materials.get(crowdArrayMaterialID);
@@ -730,31 +699,31 @@ void TerrainBuilder::create(cro::ResourceCollection& resources, cro::Scene& scen
         renderNormalMap();
     }
 
-    //launch the thread - wants update is initially true
-    //so we should create the first layout right away
-    m_wantsUpdate = m_holeData.size() > m_currentHole;
-    m_threadRunning = true;
-    m_thread = std::make_unique<std::thread>(&TerrainBuilder::threadFunc, this);
+    //the first layout is created as soon as
+    //the normal map above has been read back
 }
 
 void TerrainBuilder::applyHoleIndex(std::size_t idx)
 {
-    while (m_wantsUpdate) {};
+    cro::GPUReadback::complete(m_normalMapReadback);
+    cro::JobSystem::wait(m_layoutJob);
     if (idx < m_holeData.size()
         && idx > m_currentHole)
     {
         m_currentHole = idx;
         renderNormalMap(true);
-        m_wantsUpdate = true;
     }
 }
 
 void TerrainBuilder::update(std::size_t holeIndex, bool forceAnim)
 {
-    //wait for thread to finish (usually only the first time)
+    //wait for the layout job to finish (usually only the first time)
     //this *shouldn't* ever block unless something goes wrong
     //in which case we need to implement a get-out clause
-    while (m_wantsUpdate) {}
+    //the normal map should have been read back long before
+    //now, but if not we need to wait for it to start the update
+    cro::GPUReadback::complete(m_normalMapReadback);
+    cro::JobSystem::wait(m_layoutJob);
 
     if (holeIndex == m_currentHole)
     {
@@ -851,6 +820,8 @@ void TerrainBuilder::update(std::size_t holeIndex, bool forceAnim)
             glCheck(glUseProgram(m_terrainProperties.shaderIDShadow));
             glCheck(glUniform1f(m_terrainProperties.morphUniformShadow, m_terrainProperties.morphTime));
             //terrain callback is set active when shrubbery callback switches
+
+            updateOccluders();
         }
         //upload the slope buffer data - this might be different even if the hole model is the same
         glCheck(glBindBuffer(GL_ARRAY_BUFFER, m_slopeProperties.meshData->vbo));
@@ -871,7 +842,6 @@ void TerrainBuilder::update(std::size_t holeIndex, bool forceAnim)
         if (m_currentHole < m_holeData.size())
         {
             renderNormalMap();
-            m_wantsUpdate = true;
         }
     }
 }
@@ -1003,7 +973,254 @@ void TerrainBuilder::onChunkUpdate(const std::vector<std::int32_t>& visibleChunk
     }
 }
 
-void TerrainBuilder::threadFunc()
+void TerrainBuilder::createTerrainChunks(const cro::Mesh::Data& meshData, const cro::Material::Data& material, const cro::Material::Data& shadowMaterial, cro::Scene& scene)
+{
+    static constexpr auto xCount = static_cast<std::uint32_t>(MapSize.x / QuadsPerMetre);
+    static constexpr auto yCount = static_cast<std::uint32_t>(MapSize.y / QuadsPerMetre);
+
+    for (auto y = 0; y < ChunkVisSystem::RowCount; ++y)
+    {
+        for (auto x = 0; x < ChunkVisSystem::ColCount; ++x)
+        {
+            //neighbouring chunks share their edge verts
+            auto& chunk = m_terrainChunks[y * ChunkVisSystem::ColCount + x];
+            chunk.start = { (x * (xCount - 1)) / ChunkVisSystem::ColCount, (y * (yCount - 1)) / ChunkVisSystem::RowCount };
+            chunk.end = { ((x + 1) * (xCount - 1)) / ChunkVisSystem::ColCount, ((y + 1) * (yCount - 1)) / ChunkVisSystem::RowCount };
+
+            glCheck(glGenBuffers(1, &chunk.ibo));
+
+            auto chunkData = meshData;
+            chunkData.indexData[0].ibo = chunk.ibo;
+            chunkData.indexData[0].indexCount = 0;
+
+            chunkData.boundingBox[0] = glm::vec3(chunk.start.x * QuadsPerMetre, -10.f, -static_cast<float>(chunk.start.y * QuadsPerMetre));
+            chunkData.boundingBox[1] = glm::vec3(chunk.end.x * QuadsPerMetre, 10.f, -static_cast<float>(chunk.end.y * QuadsPerMetre));
+            chunkData.boundingSphere.centre = chunkData.boundingBox.getCentre();
+            chunkData.boundingSphere.radius = glm::length(chunkData.boundingBox[1] - chunkData.boundingSphere.centre);
+
+            auto entity = scene.createEntity();
+            entity.addComponent<cro::Transform>();
+            entity.addComponent<cro::Model>(chunkData, material);
+            entity.getComponent<cro::Model>().setShadowMaterial(0, shadowMaterial);
+            entity.getComponent<cro::Model>().setRenderFlags(~(RenderFlags::MiniMap | RenderFlags::MiniGreen));
+            entity.addComponent<cro::ShadowCaster>();
+            m_terrainEntity.getComponent<cro::Transform>().addChild(entity.getComponent<cro::Transform>());
+            chunk.entity = entity;
+        }
+    }
+
+    //start everything at the lowest detail until the camera is placed
+    applyTerrainLod();
+}
+
+void TerrainBuilder::updateTerrainLod(glm::vec3 cameraPosition)
+{
+    //distance to the nearest edge of a chunk at which the lod is reduced
+    static constexpr std::array<float, TerrainLodCount - 1> LodDistances = { 50.f, 110.f, 200.f };
+    //prevents chunks flickering between levels when the camera sits on a boundary
+    static constexpr float Hysteresis = 5.f;
+
+    const auto localPos = cameraPosition - m_terrainEntity.getComponent<cro::Transform>().getPosition();
+    const glm::vec2 camPos(localPos.x / QuadsPerMetre, -localPos.z / QuadsPerMetre);
+
+    const auto getLod = [](float distance)
+    {
+        std::int32_t lod = 0;
+        while (lod < (TerrainLodCount - 1)
+            && distance > LodDistances[lod])
+        {
+            lod++;
+        }
+        return lod;
+    };
+
+    bool changed = false;
+    for (auto& chunk : m_terrainChunks)
+    {
+        const auto nearest = glm::clamp(camPos, glm::vec2(chunk.start), glm::vec2(chunk.end));
+        const auto distance = glm::length(camPos - nearest) * QuadsPerMetre;
+
+        auto lod = getLod(distance);
+        if (lod < chunk.lod)
+        {
+            //only add detail once we're clearly inside the boundary
+            lod = std::min(chunk.lod, getLod(distance + Hysteresis));
+        }
+
+        if (lod != chunk.lod)
+        {
+            chunk.lod = lod;
+            changed = true;
+        }
+    }
+
+    if (changed)
+    {
+        applyTerrainLod();
+    }
+}
+
+void TerrainBuilder::applyTerrainLod()
+{
+    const auto stride = [&](std::int32_t x, std::int32_t y)
+    {
+        if (x < 0 || x >= ChunkVisSystem::ColCount
+            || y < 0 || y >= ChunkVisSystem::RowCount)
+        {
+            return 0u;
+        }
+        return 1u << m_terrainChunks[y * ChunkVisSystem::ColCount + x].lod;
+    };
+
+    for (auto y = 0; y < ChunkVisSystem::RowCount; ++y)
+    {
+        for (auto x = 0; x < ChunkVisSystem::ColCount; ++x)
+        {
+            auto& chunk = m_terrainChunks[y * ChunkVisSystem::ColCount + x];
+
+            //edges shared with a lower detail neighbour are
+            //stitched to the neighbour's stride to prevent cracks
+            std::array<std::uint32_t, TerrainChunk::Edge::Count> strides = {};
+            strides[TerrainChunk::Self] = stride(x, y);
+            strides[TerrainChunk::Left] = std::max(strides[TerrainChunk::Self], stride(x - 1, y));
+            strides[TerrainChunk::Right] = std::max(strides[TerrainChunk::Self], stride(x + 1, y));
+            strides[TerrainChunk::Bottom] = std::max(strides[TerrainChunk::Self], stride(x, y - 1));
+            strides[TerrainChunk::Top] = std::max(strides[TerrainChunk::Self], stride(x, y + 1));
+
+            if (strides != chunk.strides)
+            {
+                chunk.strides = strides;
+                buildChunkIndices(chunk);
+            }
+        }
+    }
+}
+
+void TerrainBuilder::buildChunkIndices(TerrainChunk& chunk)
+{
+    static constexpr auto xCount = static_cast<std::uint32_t>(MapSize.x / QuadsPerMetre);
+
+    //moves a vertex along an edge on to the nearest vert of the neighbouring grid
+    const auto snap = [](std::uint32_t v, std::uint32_t start, std::uint32_t end, std::uint32_t step)
+    {
+        return v == end ? end : start + (((v - start) / step) * step);
+    };
+
+    const auto index = [&](std::uint32_t x, std::uint32_t y)
+    {
+        if (x == chunk.start.x)
+        {
+            y = snap(y, chunk.start.y, chunk.end.y, chunk.strides[TerrainChunk::Left]);
+        }
+        else if (x == chunk.end.x)
+        {
+            y = snap(y, chunk.start.y, chunk.end.y, chunk.strides[TerrainChunk::Right]);
+        }
+
+        if (y == chunk.start.y)
+        {
+            x = snap(x, chunk.start.x, chunk.end.x, chunk.strides[TerrainChunk::Bottom]);
+        }
+        else if (y == chunk.end.y)
+        {
+            x = snap(x, chunk.start.x, chunk.end.x, chunk.strides[TerrainChunk::Top]);
+        }
+        return y * xCount + x;
+    };
+
+    const auto addTriangle = [&](std::uint32_t a, std::uint32_t b, std::uint32_t c)
+    {
+        //snapping collapses some triangles on stitched edges
+        if (a != b && b != c && c != a)
+        {
+            m_chunkIndices.push_back(a);
+            m_chunkIndices.push_back(b);
+            m_chunkIndices.push_back(c);
+        }
+    };
+
+    m_chunkIndices.clear();
+    const auto step = chunk.strides[TerrainChunk::Self];
+    for (auto y = chunk.start.y; y < chunk.end.y; y += step)
+    {
+        const auto y1 = std::min(y + step, chunk.end.y);
+        for (auto x = chunk.start.x; x < chunk.end.x; x += step)
+        {
+            const auto x1 = std::min(x + step, chunk.end.x);
+
+            const auto a = index(x, y);
+            const auto b = index(x1, y);
+            const auto c = index(x, y1);
+            const auto d = index(x1, y1);
+            addTriangle(c, a, d);
+            addTriangle(a, b, d);
+        }
+    }
+
+    auto& submesh = chunk.entity.getComponent<cro::Model>().getMeshData().indexData[0];
+    submesh.indexCount = static_cast<std::uint32_t>(m_chunkIndices.size());
+    glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, chunk.ibo));
+    glCheck(glBufferData(GL_ELEMENT_ARRAY_BUFFER, submesh.indexCount * sizeof(std::uint32_t), m_chunkIndices.data(), GL_DYNAMIC_DRAW));
+    glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+}
+
+void TerrainBuilder::updateOccluders()
+{
+    //each occluder vert takes the lowest height of the terrain around it
+    //so the occluder never rises above the visible surface. The lower of
+    //the current and target heights is used so it's valid during the morph
+    static constexpr std::uint32_t OccluderSpacing = 8;
+    static constexpr auto xCount = static_cast<std::uint32_t>(MapSize.x / QuadsPerMetre);
+    static constexpr auto yCount = static_cast<std::uint32_t>(MapSize.y / QuadsPerMetre);
+    static constexpr auto OccluderCountX = ((xCount - 1) / OccluderSpacing) + 1;
+    static constexpr auto OccluderCountY = ((yCount - 1) / OccluderSpacing) + 1;
+
+    std::vector<glm::vec3> vertices;
+    vertices.reserve(OccluderCountX * OccluderCountY);
+    for (auto y = 0u; y < OccluderCountY; ++y)
+    {
+        for (auto x = 0u; x < OccluderCountX; ++x)
+        {
+            const auto centreX = x * OccluderSpacing;
+            const auto centreY = y * OccluderSpacing;
+
+            float height = std::numeric_limits<float>::max();
+            for (auto j = centreY - std::min(centreY, OccluderSpacing); j <= std::min(centreY + OccluderSpacing, yCount - 1); ++j)
+            {
+                for (auto i = centreX - std::min(centreX, OccluderSpacing); i <= std::min(centreX + OccluderSpacing, xCount - 1); ++i)
+                {
+                    const auto& vert = m_terrainBuffer[j * xCount + i];
+                    height = std::min(height, std::min(vert.position.y, vert.targetPosition.y));
+                }
+            }
+
+            vertices.emplace_back(static_cast<float>(centreX * QuadsPerMetre), height + TerrainLevel, -static_cast<float>(centreY * QuadsPerMetre));
+        }
+    }
+
+    //terrain below the water is clipped when drawn so it can't hide anything
+    std::vector<std::uint32_t> indices;
+    for (auto y = 0u; y < OccluderCountY - 1; ++y)
+    {
+        for (auto x = 0u; x < OccluderCountX - 1; ++x)
+        {
+            const auto a = (y * OccluderCountX) + x;
+            const auto b = a + 1;
+            const auto c = a + OccluderCountX;
+            const auto d = c + 1;
+
+            if (vertices[a].y > WaterLevel && vertices[b].y > WaterLevel
+                && vertices[c].y > WaterLevel && vertices[d].y > WaterLevel)
+            {
+                indices.insert(indices.end(), { c, a, d, a, b, d });
+            }
+        }
+    }
+
+    m_occlusionBuffer.setOccluders(std::move(vertices), std::move(indices));
+}
+
+void TerrainBuilder::buildLayout()
 {
     const auto readHeightMap = [&](std::uint32_t x, std::uint32_t y, std::int32_t gridRes = 1)
     {
@@ -1054,406 +1271,509 @@ void TerrainBuilder::threadFunc()
         return false;
     };
 
-    while (m_threadRunning)
+    //placement is split into jobs per chunk cell
+    const auto cellIndexAt = [](float x, float y)
+    {
+        auto xCell = std::clamp(static_cast<std::int32_t>(std::floor(x / ChunkSize.x)), 0, ChunkVisSystem::ColCount - 1);
+        auto yCell = std::clamp(static_cast<std::int32_t>(std::floor(y / ChunkSize.y)), 0, ChunkVisSystem::RowCount - 1);
+        return static_cast<std::size_t>(yCell * ChunkVisSystem::ColCount + xCell);
+    };
+
+    struct PlacementCell final
     {
-        if (m_wantsUpdate)
+        enum
         {
-            //should be empty anyway because we clear after assigning them
-            m_instanceTransforms.clear();
-            for (auto& tx : m_shrubTransforms)
+            Grass, Tree, Flower,
+            Count
+        };
+        std::array<std::vector<std::array<float, 2>>, Count> samples = {};
+
+        //output of the job, merged once all jobs are complete
+        std::vector<cro::Billboard> billboards;
+        std::vector<cro::Billboard> treeBillboards;
+        std::vector<glm::mat4> instanceTransforms;
+        std::array<std::vector<glm::mat4>, MaxShrubInstances> shrubTransforms = {};
+
+        void clear()
+        {
+            for (auto& s : samples)
             {
-                tx.clear();
+                s.clear();
             }
-
-            auto cellIndex = (m_swapIndex + 1) % 2;
-            for (auto& cellData : m_cellData[cellIndex])
+            billboards.clear();
+            treeBillboards.clear();
+            instanceTransforms.clear();
+            for (auto& tx : shrubTransforms)
             {
-                for (auto& cell : cellData)
-                {
-                    cell.normalMats.clear();
-                    cell.transforms.clear();
-                }
+                tx.clear();
             }
+        }
+    };
+    std::vector<PlacementCell> placementCells(ChunkVisSystem::RowCount * ChunkVisSystem::ColCount);
+    std::vector<std::vector<SlopeVertex>> slopeTiles(SlopeGridSize);
+
+    CRO_PROFILE_SCOPE("TerrainBuilder::buildLayout");
+    //should be empty anyway because we clear after assigning them
+    m_instanceTransforms.clear();
+    for (auto& tx : m_shrubTransforms)
+    {
+        tx.clear();
+    }
+
+    auto cellIndex = (m_swapIndex + 1) % 2;
+    for (auto& cellData : m_cellData[cellIndex])
+    {
+        for (auto& cell : cellData)
+        {
+            cell.normalMats.clear();
+            cell.transforms.clear();
+        }
+    }
+
+    //we checked the file validity when the game starts.
+    //if the map file is broken now something more drastic happened...
+    cro::ImageArray<std::uint8_t> mapImage;
+    if (mapImage.loadFromFile(m_holeData[m_currentHole].mapPath, true))
+    {
+        //partition the prop entities;
+        propGrid.clear();
+        propGrid.resize(GridCount);
+
+        const auto& props = m_holeData[m_currentHole].propEntities;
+        for (const auto prop : props)
+        {
+            auto propPos = prop.getComponent<cro::Transform>().getPosition();
+            std::int32_t gridX = static_cast<std::int32_t>(propPos.x / GridSize);
+            std::int32_t gridY = static_cast<std::int32_t>(-propPos.z / GridSize);
+            auto index = std::min(GridCount - 1, std::max(0u, gridY * MapSize.x + gridX));
+            propGrid[index].push_back(prop);
+        }
+
+        //recreate the distribution(s)
+        auto seed = static_cast<std::uint32_t>(std::time(nullptr));
+        auto grass = pd::PoissonDiskSampling(GrassDensity, MinBounds, MaxBounds, 30u, seed);
+        auto trees = pd::PoissonDiskSampling(TreeDensity, MinBounds, MaxBounds);
+        auto flowers = pd::PoissonDiskSampling(TreeDensity * 0.5f, MinBounds, MaxBounds, 30u, seed / 2);
+
+        //bin the samples into the same cells used for chunk culling
+        //so that each cell can be filtered by a separate job
+        for (auto& cell : placementCells)
+        {
+            cell.clear();
+        }
+        for (auto [x, y] : grass)
+        {
+            placementCells[cellIndexAt(x, y)].samples[PlacementCell::Grass].push_back({ x, y });
+        }
+        for (auto [x, y] : trees)
+        {
+            placementCells[cellIndexAt(x, y)].samples[PlacementCell::Tree].push_back({ x, y });
+        }
+        for (auto [x, y] : flowers)
+        {
+            placementCells[cellIndexAt(x, y)].samples[PlacementCell::Flower].push_back({ x, y });
+        }
 
-            //we checked the file validity when the game starts.
-            //if the map file is broken now something more drastic happened...
-            cro::ImageArray<std::uint8_t> mapImage;
-            if (mapImage.loadFromFile(m_holeData[m_currentHole].mapPath, true))
+        //filter distribution by map area
+        const auto placeCell = [&](std::size_t cellIdx)
+        {
+            auto& cell = placementCells[cellIdx];
+
+            //Random::value() isn't thread safe, so each job has its own engine
+            std::minstd_rand rndEngine(seed + static_cast<std::uint32_t>(cellIdx));
+            const auto randInt = [&rndEngine](std::int32_t begin, std::int32_t end)
+            {
+                return std::uniform_int_distribution<std::int32_t>(begin, end)(rndEngine);
+            };
+            const auto randFloat = [&rndEngine](float begin, float end)
             {
-                //partition the prop entities;
-                propGrid.clear();
-                propGrid.resize(GridCount);
+                return std::uniform_real_distribution<float>(begin, end)(rndEngine);
+            };
 
-                const auto& props = m_holeData[m_currentHole].propEntities;
-                for (const auto prop : props)
+            for (auto [x, y] : cell.samples[PlacementCell::Grass])
+            {
+                auto [terrain, terrainHeight] = readMap(mapImage, x, y);
+                if (terrain == TerrainID::Rough)
                 {
-                    auto propPos = prop.getComponent<cro::Transform>().getPosition();
-                    std::int32_t gridX = static_cast<std::int32_t>(propPos.x / GridSize);
-                    std::int32_t gridY = static_cast<std::int32_t>(-propPos.z / GridSize);
-                    auto index = std::min(GridCount - 1, std::max(0u, gridY * MapSize.x + gridX));
-                    propGrid[index].push_back(prop);
-                }
+                    float scale = static_cast<float>(randInt(14, 16)) / 10.f;
+                    float height = readHeightMap(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y));
 
-                //recreate the distribution(s)
-                auto seed = static_cast<std::uint32_t>(std::time(nullptr));
-                auto grass = pd::PoissonDiskSampling(GrassDensity, MinBounds, MaxBounds, 30u, seed);
-                auto trees = pd::PoissonDiskSampling(TreeDensity, MinBounds, MaxBounds);
-                auto flowers = pd::PoissonDiskSampling(TreeDensity * 0.5f, MinBounds, MaxBounds, 30u, seed / 2);
-
-                //filter distribution by map area
-                m_billboardBuffer.clear();
-                m_billboardTreeBuffer.clear();
-                
-                for (auto [x, y] : grass)
-                {
-                    auto [terrain, terrainHeight] = readMap(mapImage, x, y);
-                    if (terrain == TerrainID::Rough)
+                    if (height > WaterLevel)
                     {
-                        float scale = static_cast<float>(cro::Util::Random::value(14, 16)) / 10.f;
-                        float height = readHeightMap(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y));
-
-                        if (height > WaterLevel)
+                        auto n = readNormal(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y));
+                        //don't place on steep slopes
+                        if (glm::dot(n, cro::Transform::Y_AXIS) > 0.3f)
                         {
-                            auto n = readNormal(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y));
-                            //don't place on steep slopes
-                            if (glm::dot(n, cro::Transform::Y_AXIS) > 0.3f)
-                            {
-                                glm::vec3 bbPos({ x, height - 0.02f, -y });
-                                
-                                auto& bb = m_billboardBuffer.emplace_back(m_billboardTemplates[cro::Util::Random::value(BillboardID::Grass01, BillboardID::Grass02)]);
-                                bb.position = bbPos;
-                                bb.size *= scale;
-                                bb.origin *= scale;
-                            }
+                            glm::vec3 bbPos({ x, height - 0.02f, -y });
+
+                            auto& bb = cell.billboards.emplace_back(m_billboardTemplates[randInt(BillboardID::Grass01, BillboardID::Grass02)]);
+                            bb.position = bbPos;
+                            bb.size *= scale;
+                            bb.origin *= scale;
                         }
                     }
-                    //reeds at water edge
-                    if (terrain == TerrainID::Rough
-                        || terrain == TerrainID::Scrub)
-                    {
-                        float height = readHeightMap(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y));
-                        height = std::max(height, terrainHeight + TerrainLevel);
+                }
+                //reeds at water edge
+                if (terrain == TerrainID::Rough
+                    || terrain == TerrainID::Scrub)
+                {
+                    float height = readHeightMap(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y));
+                    height = std::max(height, terrainHeight + TerrainLevel);
 
-                        if (height < 0.1f)
-                        {
-                            float scale = static_cast<float>(cro::Util::Random::value(9, 16)) / 10.f;
+                    if (height < 0.1f)
+                    {
+                        float scale = static_cast<float>(randInt(9, 16)) / 10.f;
 
-                            glm::mat4 tx = glm::translate(glm::mat4(1.f), { x, height - 0.01f, -y });
-                            tx = glm::rotate(tx, cro::Util::Random::value(-cro::Util::Const::PI, cro::Util::Const::PI), cro::Transform::Y_AXIS);
-                            tx = glm::scale(tx, glm::vec3(scale));
-                            m_instanceTransforms.push_back(tx);
-                        }
+                        glm::mat4 tx = glm::translate(glm::mat4(1.f), { x, height - 0.01f, -y });
+                        tx = glm::rotate(tx, randFloat(-cro::Util::Const::PI, cro::Util::Const::PI), cro::Transform::Y_AXIS);
+                        tx = glm::scale(tx, glm::vec3(scale));
+                        cell.instanceTransforms.push_back(tx);
                     }
                 }
-                
-                for (auto [x, y] : trees)
+            }
+
+            //offset by cell so neighbouring cells don't all start with the same shrub
+            std::size_t shrubIdx = cellIdx;
+            for (auto [x, y] : cell.samples[PlacementCell::Tree])
+            {
+                auto [terrain, height] = readMap(mapImage, x, y);
+                if (terrain == TerrainID::Scrub)
                 {
-                    auto [terrain, height] = readMap(mapImage, x, y);
-                    if (terrain == TerrainID::Scrub)
+                    //check if model mesh is higher than terrain
+                    float height2 = readHeightMap(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y));
+                    height = std::max(height + TerrainLevel, height2);
+
+                    //check we're actually above water height
+                    if (height > -(TerrainLevel - WaterLevel))
                     {
-                        //check if model mesh is higher than terrain
-                        float height2 = readHeightMap(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y));
-                        height = std::max(height + TerrainLevel, height2);
+                        glm::vec3 position(x, height - 0.01f, -y);
 
-                        //check we're actually above water height
-                        if (height > -(TerrainLevel - WaterLevel))
+                        bool isNearProp = false;
+                        for (auto v = position.z - 1; v < position.z + 2; ++v)
                         {
-                            glm::vec3 position(x, height - 0.01f, -y);
-
-                            bool isNearProp = false;
-                            for (auto v = position.z - 1; v < position.z + 2; ++v)
+                            for (auto u = position.x - 1; u < position.x + 2; ++u)
                             {
-                                for (auto u = position.x - 1; u < position.x + 2; ++u)
-                                {
-                                    isNearProp = nearProp({ u, height, v });
-                                    if (isNearProp)
-                                    {
-                                        break;
-                                    }
-                                }
+                                isNearProp = nearProp({ u, height, v });
                                 if (isNearProp)
                                 {
                                     break;
                                 }
                             }
-
-                            if (!isNearProp)
+                            if (isNearProp)
                             {
-                                static std::size_t shrubIdx = 0;
-                                auto currIndex = shrubIdx % MaxShrubInstances;
+                                break;
+                            }
+                        }
 
-                                if (m_instancedShrubs[0][currIndex].isValid())
-                                {
-                                    glm::vec3 position(x, height - 0.05f, -y);
-                                    float rotation = static_cast<float>(cro::Util::Random::value(0, 36) * 10) * cro::Util::Const::degToRad;
-                                    float scale = static_cast<float>(cro::Util::Random::value(16, 20)) / 10.f;
-
-                                    auto& mat4 = m_shrubTransforms[currIndex].emplace_back(1.f);
-                                    mat4 = glm::translate(mat4, position);
-                                    mat4 = glm::rotate(mat4, rotation, cro::Transform::Y_AXIS);
-                                    mat4 = glm::scale(mat4, glm::vec3(scale));
-
-                                    //find which chunk this is in based on position and update the 
-                                    //appropriate cell data for culling
-                                    auto norm = glm::inverseTranspose(mat4);
-
-                                    auto xCell = std::floor(x / ChunkSize.x);
-                                    auto yCell = std::floor(y / ChunkSize.y);
-
-                                    auto idx = static_cast<std::int32_t>(yCell * ChunkVisSystem::ColCount + xCell);
-                                    //LogI << idx <<std::endl;
-                                    m_cellData[cellIndex][currIndex][idx].transforms.push_back(mat4);
-                                    m_cellData[cellIndex][currIndex][idx].normalMats.push_back(norm);
-                                }
+                        if (!isNearProp)
+                        {
+                            auto currIndex = shrubIdx % MaxShrubInstances;
+
+                            if (m_instancedShrubs[0][currIndex].isValid())
+                            {
+                                glm::vec3 position(x, height - 0.05f, -y);
+                                float rotation = static_cast<float>(randInt(0, 36) * 10) * cro::Util::Const::degToRad;
+                                float scale = static_cast<float>(randInt(16, 20)) / 10.f;
+
+                                auto& mat4 = cell.shrubTransforms[currIndex].emplace_back(1.f);
+                                mat4 = glm::translate(mat4, position);
+                                mat4 = glm::rotate(mat4, rotation, cro::Transform::Y_AXIS);
+                                mat4 = glm::scale(mat4, glm::vec3(scale));
+
+                                //the cell data for culling is only ever touched by this job
+                                auto norm = glm::inverseTranspose(mat4);
+                                m_cellData[cellIndex][currIndex][cellIdx].transforms.push_back(mat4);
+                                m_cellData[cellIndex][currIndex][cellIdx].normalMats.push_back(norm);
+                            }
 
-                                //low quality version - always rendered on flight cam and optionally on LQ settings
-                                glm::vec3 bbPos({ x, height - 0.05f, -y });
+                            //low quality version - always rendered on flight cam and optionally on LQ settings
+                            glm::vec3 bbPos({ x, height - 0.05f, -y });
 
-                                float scale = static_cast<float>(cro::Util::Random::value(12, 22)) / 10.f;
-                                auto& bb = m_billboardTreeBuffer.emplace_back(m_billboardTemplates[BillboardID::Tree01 + currIndex]);
-                                bb.position = bbPos; //small vertical offset to stop floating billboards
-                                bb.size *= scale;
-                                bb.origin *= scale;
-                                    
-                                if (cro::Util::Random::value(0, 1) == 0)
-                                {
-                                    //flip billboard
-                                    auto rect = bb.textureRect;
-                                    bb.textureRect.left = rect.left + rect.width;
-                                    bb.textureRect.width = -rect.width;
-                                }
+                            float scale = static_cast<float>(randInt(12, 22)) / 10.f;
+                            auto& bb = cell.treeBillboards.emplace_back(m_billboardTemplates[BillboardID::Tree01 + currIndex]);
+                            bb.position = bbPos; //small vertical offset to stop floating billboards
+                            bb.size *= scale;
+                            bb.origin *= scale;
 
-                                shrubIdx++;
+                            if (randInt(0, 1) == 0)
+                            {
+                                //flip billboard
+                                auto rect = bb.textureRect;
+                                bb.textureRect.left = rect.left + rect.width;
+                                bb.textureRect.width = -rect.width;
                             }
+
+                            shrubIdx++;
                         }
                     }
                 }
-                
-                for (auto [x, y] : flowers)
+            }
+
+            for (auto [x, y] : cell.samples[PlacementCell::Flower])
+            {
+                auto [terrain, height] = readMap(mapImage, x, y);
+                if (terrain == TerrainID::Scrub
+                    /*&& height > 0.6f*/)
                 {
-                    auto [terrain, height] = readMap(mapImage, x, y);
-                    if (terrain == TerrainID::Scrub
-                        /*&& height > 0.6f*/)
+                    float height2 = readHeightMap(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y));
+                    height = std::max(height + TerrainLevel, height2);
+
+                    if (height > /*-(TerrainLevel - WaterLevel)*/0)
                     {
-                        float height2 = readHeightMap(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y));
-                        height = std::max(height + TerrainLevel, height2);
+                        glm::vec3 position(x, height - 0.001f, -y);
 
-                        if (height > /*-(TerrainLevel - WaterLevel)*/0)
+                        if (!nearProp(position))
                         {
-                            glm::vec3 position(x, height - 0.001f, -y);
+                            glm::vec3 bbPos({ x, height - 0.05f, -y });
 
-                            if (!nearProp(position))
-                            {
-                                glm::vec3 bbPos({ x, height - 0.05f, -y });
-                                
-                                float scale = static_cast<float>(cro::Util::Random::value(13, 17)) / 10.f;
-                                auto& bb = m_billboardBuffer.emplace_back(m_billboardTemplates[cro::Util::Random::value(BillboardID::Flowers01, BillboardID::Bush02)]);
-                                bb.position = bbPos;
-                                bb.size *= scale;
-                                bb.origin *= scale;
-                            }
-                            else
-                            {
-                                //TODO not sure how this position is different, but hey
-                                glm::vec3 bbPos({ x, height - 0.05f, -y });
-                                
-                                float scale = static_cast<float>(cro::Util::Random::value(14, 16)) / 10.f;
-                                auto& bb = m_billboardBuffer.emplace_back(m_billboardTemplates[cro::Util::Random::value(BillboardID::Grass01, BillboardID::Grass02)]);
-                                bb.position = bbPos;
-                                bb.size *= scale;
-                                bb.origin *= scale;
-                            }
+                            float scale = static_cast<float>(randInt(13, 17)) / 10.f;
+                            auto& bb = cell.billboards.emplace_back(m_billboardTemplates[randInt(BillboardID::Flowers01, BillboardID::Bush02)]);
+                            bb.position = bbPos;
+                            bb.size *= scale;
+                            bb.origin *= scale;
+                        }
+                        else
+                        {
+                            //TODO not sure how this position is different, but hey
+                            glm::vec3 bbPos({ x, height - 0.05f, -y });
+
+                            float scale = static_cast<float>(randInt(14, 16)) / 10.f;
+                            auto& bb = cell.billboards.emplace_back(m_billboardTemplates[randInt(BillboardID::Grass01, BillboardID::Grass02)]);
+                            bb.position = bbPos;
+                            bb.size *= scale;
+                            bb.origin *= scale;
                         }
                     }
                 }
+            }
+        };
 
-                //this isn't the same as the readHeightMap above - it scales the
-                //result to MaxTerrainHeight, whereas the above returns world coords
-                const auto heightAt = [&](std::uint32_t x, std::uint32_t y)
-                {
-                    auto size = mapImage.getDimensions();
+        {
+            CRO_PROFILE_SCOPE("TerrainBuilder::placement");
+            cro::JobSystem::parallelFor(placementCells.size(), placeCell);
+        }
 
-                    if (x < 0 || x >= size.x)
-                    {
-                        return 0.f;
-                    }
-                    if (y < 0 || y >= size.y)
-                    {
-                        return 0.f;
-                    }
+        //merge in cell order so the result doesn't depend on job scheduling
+        m_billboardBuffer.clear();
+        m_billboardTreeBuffer.clear();
+        for (const auto& cell : placementCells)
+        {
+            m_billboardBuffer.insert(m_billboardBuffer.end(), cell.billboards.begin(), cell.billboards.end());
+            m_billboardTreeBuffer.insert(m_billboardTreeBuffer.end(), cell.treeBillboards.begin(), cell.treeBillboards.end());
+            m_instanceTransforms.insert(m_instanceTransforms.end(), cell.instanceTransforms.begin(), cell.instanceTransforms.end());
 
-                    x = std::min(size.x - 1, std::max(0u, x));
-                    y = std::min(size.y - 1, std::max(0u, y));
+            for (auto i = 0u; i < MaxShrubInstances; ++i)
+            {
+                m_shrubTransforms[i].insert(m_shrubTransforms[i].end(), cell.shrubTransforms[i].begin(), cell.shrubTransforms[i].end());
+            }
+        }
 
-                    auto index = y * size.x + x;
-                    index *= 4;
-                    return (static_cast<float>(mapImage[index + 1]) / 255.f) * MaxTerrainHeight;
-                };
+        //this isn't the same as the readHeightMap above - it scales the
+        //result to MaxTerrainHeight, whereas the above returns world coords
+        const auto heightAt = [&](std::uint32_t x, std::uint32_t y)
+        {
+            auto size = mapImage.getDimensions();
 
-                //update vertex data for scrub terrain mesh
-                for (auto i = 0u; i < m_terrainBuffer.size(); ++i)
-                {
-                    //for each vert copy the target to the current (as this is where we should be)
-                    //then update the target with the new map height at that position
-                    std::uint32_t x = i % (MapSize.x / QuadsPerMetre) * QuadsPerMetre;
-                    std::uint32_t y = i / (MapSize.x / QuadsPerMetre) * QuadsPerMetre;
-
-                    auto height = heightAt(x, y);
-
-                    //normal calc
-                    auto l = heightAt(x - 1, y);
-                    auto r = heightAt(x + 1, y);
-                    auto u = heightAt(x, y + 1);
-                    auto d = heightAt(x, y - 1);
-
-                    glm::vec3 normal = { l - r, 2.f, -(d - u) };
-                    normal = glm::normalize(normal);
-
-                    m_terrainBuffer[i].position = m_terrainBuffer[i].targetPosition;
-                    m_terrainBuffer[i].normal = m_terrainBuffer[i].targetNormal;
-                    m_terrainBuffer[i].targetPosition.y = height;
-                    m_terrainBuffer[i].targetNormal = normal;
-                } 
-
-                //update the vertex data for the slope indicator
-                m_slopeBuffer.clear();
-                m_slopeIndices.clear();
-
-                std::uint32_t currIndex = 0u;
-                auto pinPos = m_holeData[m_currentHole].pin;
-
-                //we can optimise this by only looping the grid around the pin pos
-                const std::int32_t startX = std::max(0, static_cast<std::int32_t>(std::floor(pinPos.x)) - HalfGridSize);
-                const std::int32_t startY = std::max(0, static_cast<std::int32_t>(-std::floor(pinPos.z)) - HalfGridSize);
-                static constexpr float DashCount = 2.f;// 80.f;
-                static constexpr float SlopeSpeed = -40.f;//REMEMBER this const is also used in the slope frag shader
-                static constexpr std::int32_t AvgDistance = 1;
-                static constexpr std::int32_t GridDensity = NormalMapMultiplier; //verts per metre, however grid size is half this.
-                static constexpr float GridSpacing = 1.f / GridDensity;
-
-                static constexpr float SurfaceOffset = 0.02f; //verts are pushed along normal by this much
-
-                for (auto y = 0; y < (SlopeGridSize * GridDensity); ++y)
+            if (x < 0 || x >= size.x)
+            {
+                return 0.f;
+            }
+            if (y < 0 || y >= size.y)
+            {
+                return 0.f;
+            }
+
+            x = std::min(size.x - 1, std::max(0u, x));
+            y = std::min(size.y - 1, std::max(0u, y));
+
+            auto index = y * size.x + x;
+            index *= 4;
+            return (static_cast<float>(mapImage[index + 1]) / 255.f) * MaxTerrainHeight;
+        };
+
+        //update vertex data for scrub terrain mesh, a row per job
+        static constexpr std::size_t RowWidth = MapSize.x / QuadsPerMetre;
+        const auto updateTerrainRow = [&](std::size_t row)
+        {
+            const auto end = std::min(m_terrainBuffer.size(), (row + 1) * RowWidth);
+            for (auto i = row * RowWidth; i < end; ++i)
+            {
+                //for each vert copy the target to the current (as this is where we should be)
+                //then update the target with the new map height at that position
+                std::uint32_t x = static_cast<std::uint32_t>(i % RowWidth) * QuadsPerMetre;
+                std::uint32_t y = static_cast<std::uint32_t>(i / RowWidth) * QuadsPerMetre;
+
+                auto height = heightAt(x, y);
+
+                //normal calc
+                auto l = heightAt(x - 1, y);
+                auto r = heightAt(x + 1, y);
+                auto u = heightAt(x, y + 1);
+                auto d = heightAt(x, y - 1);
+
+                glm::vec3 normal = { l - r, 2.f, -(d - u) };
+                normal = glm::normalize(normal);
+
+                m_terrainBuffer[i].position = m_terrainBuffer[i].targetPosition;
+                m_terrainBuffer[i].normal = m_terrainBuffer[i].targetNormal;
+                m_terrainBuffer[i].targetPosition.y = height;
+                m_terrainBuffer[i].targetNormal = normal;
+            }
+        };
+
+        {
+            CRO_PROFILE_SCOPE("TerrainBuilder::terrain");
+            cro::JobSystem::parallelFor((m_terrainBuffer.size() + RowWidth - 1) / RowWidth, updateTerrainRow);
+        }
+
+        //update the vertex data for the slope indicator. Unlike the map overview
+        //this is still built on the CPU (split into tiles with the job system)
+        //as it reads the same height data as the terrain update above
+        auto pinPos = m_holeData[m_currentHole].pin;
+
+        //we can optimise this by only looping the grid around the pin pos
+        const std::int32_t startX = std::max(0, static_cast<std::int32_t>(std::floor(pinPos.x)) - HalfGridSize);
+        const std::int32_t startY = std::max(0, static_cast<std::int32_t>(-std::floor(pinPos.z)) - HalfGridSize);
+        static constexpr float DashCount = 2.f;// 80.f;
+        static constexpr float SlopeSpeed = -40.f;//REMEMBER this const is also used in the slope frag shader
+        static constexpr std::int32_t AvgDistance = 1;
+        static constexpr std::int32_t GridDensity = NormalMapMultiplier; //verts per metre, however grid size is half this.
+        static constexpr float GridSpacing = 1.f / GridDensity;
+
+        static constexpr float SurfaceOffset = 0.02f; //verts are pushed along normal by this much
+
+        //each job processes a tile one metre deep
+        const auto updateSlopeTile = [&](std::size_t tile)
+        {
+            auto& tileBuffer = slopeTiles[tile];
+            tileBuffer.clear();
+
+            const auto tileStart = static_cast<std::int32_t>(tile) * GridDensity;
+            for (auto y = tileStart; y < tileStart + GridDensity; ++y)
+            {
+                for (auto x = 0; x < (SlopeGridSize * GridDensity); ++x)
                 {
-                    for (auto x = 0; x < (SlopeGridSize * GridDensity); ++x)
-                    {
-                        auto worldX = startX + (x / GridDensity);
-                        auto worldY = startY + (y / GridDensity);
+                    auto worldX = startX + (x / GridDensity);
+                    auto worldY = startY + (y / GridDensity);
 
-                        auto terrain = readMap(mapImage, worldX, worldY).first;
-                        if (terrain == TerrainID::Green)
+                    auto terrain = readMap(mapImage, worldX, worldY).first;
+                    if (terrain == TerrainID::Green)
+                    {
+                        float posX = static_cast<float>(x / GridDensity) + ((x % GridDensity) * GridSpacing) + startX;
+                        float posZ = -(static_cast<float>(y / GridDensity) + ((y % GridDensity) * GridSpacing) + startY);
+
+                        posX -= pinPos.x;
+                        posZ -= pinPos.z;
+
+                        worldX = startX * GridDensity + x;
+                        worldY = startY * GridDensity + y;
+
+                        auto height = (readHeightMap(worldX, worldY, GridDensity) - pinPos.y);
+                        SlopeVertex vert;
+                        vert.position = { posX, height, posZ };
+                        vert.normal = readNormal(worldX, worldY, GridDensity);
+
+                        //this is the number of times the 'dashes' repeat if enabled in the shader
+                        //and the speed/direction based on height difference
+                        vert.texCoord = { 0.f, 0.f };
+
+                        glm::vec3 offset(GridSpacing, 0.f, 0.f);
+                        height = (readHeightMap(worldX + 1, worldY, GridDensity) - pinPos.y);
+
+                        //because of the low precision of the height map
+                        //we average out the slope over a greater distance
+                        glm::vec3 avgPosition = vert.position + glm::vec3(AvgDistance, 0.f, 0.f);
+                        avgPosition.y = (readHeightMap(worldX + AvgDistance, worldY, GridDensity) - pinPos.y);
+
+                        SlopeVertex vert2;
+                        vert2.position = vert.position + offset;
+                        vert2.position.y = height;
+                        vert2.normal = readNormal(worldX + 1, worldY, GridDensity);
+                        vert2.texCoord = { vert2.position.x * DashCount, std::min(glm::dot(glm::vec3(0.f, 1.f, 0.f), glm::normalize(avgPosition - vert.position)) * SlopeSpeed, 1.f) };
+                        vert.texCoord.x = vert.position.x * DashCount;
+                        vert.texCoord.y = vert2.texCoord.y; //must be constant across segment
+
+
+                        //we have to copy first vert as the tex coords will be different
+                        //shame we can't just recycle the index...
+                        auto vert3 = vert;
+
+                        offset = glm::vec3(0.f, 0.f, -GridSpacing);
+                        height = (readHeightMap(worldX, worldY + 1, GridDensity) - pinPos.y);
+
+                        avgPosition = vert.position + glm::vec3(0.f, 0.f, -AvgDistance);
+                        avgPosition.y = (readHeightMap(worldX, worldY + AvgDistance, GridDensity) - pinPos.y);
+
+                        SlopeVertex vert4;
+                        vert4.position = vert.position + offset;
+                        vert4.position.y = height;
+                        vert4.normal = readNormal(worldX, worldY + 1, GridDensity);
+                        vert4.texCoord = { vert4.position.z * DashCount, std::min(-glm::dot(glm::vec3(0.f, 1.f, 0.f), glm::normalize(avgPosition - vert3.position)) * SlopeSpeed, 1.f) };
+                        vert3.texCoord.x = vert3.position.z * DashCount;
+                        vert3.texCoord.y = vert4.texCoord.y;
+
+                        vert.position += vert.normal * SurfaceOffset;
+                        vert2.position += vert2.normal * SurfaceOffset;
+                        vert3.position += vert3.normal * SurfaceOffset;
+                        vert4.position += vert4.normal * SurfaceOffset;
+
+                        //do this last once we know everything was modified
+                        //TODO this is a lazy addition where we could really skip
+                        //all vert processing entirely when not needed, but it
+                        //doesn't actually make processing time *worse*
+                        if ((y % (NormalMapMultiplier / 2) == 0))
                         {
-                            float posX = static_cast<float>(x / GridDensity) + ((x % GridDensity) * GridSpacing) + startX;
-                            float posZ = -(static_cast<float>(y / GridDensity) + ((y % GridDensity) * GridSpacing) + startY);
-
-                            posX -= pinPos.x;
-                            posZ -= pinPos.z;
-
-                            worldX = startX * GridDensity + x;
-                            worldY = startY * GridDensity + y;
-
-                            auto height = (readHeightMap(worldX, worldY, GridDensity) - pinPos.y);
-                            SlopeVertex vert;
-                            vert.position = { posX, height, posZ };
-                            vert.normal = readNormal(worldX, worldY, GridDensity);
-
-                            //this is the number of times the 'dashes' repeat if enabled in the shader
-                            //and the speed/direction based on height difference
-                            vert.texCoord = { 0.f, 0.f };
-
-                            glm::vec3 offset(GridSpacing, 0.f, 0.f);
-                            height = (readHeightMap(worldX + 1, worldY, GridDensity) - pinPos.y);
-
-                            //because of the low precision of the height map
-                            //we average out the slope over a greater distance
-                            glm::vec3 avgPosition = vert.position + glm::vec3(AvgDistance, 0.f, 0.f);
-                            avgPosition.y = (readHeightMap(worldX + AvgDistance, worldY, GridDensity) - pinPos.y);
-
-                            SlopeVertex vert2;
-                            vert2.position = vert.position + offset;
-                            vert2.position.y = height;
-                            vert2.normal = readNormal(worldX + 1, worldY, GridDensity);
-                            vert2.texCoord = { vert2.position.x * DashCount, std::min(glm::dot(glm::vec3(0.f, 1.f, 0.f), glm::normalize(avgPosition - vert.position)) * SlopeSpeed, 1.f) };
-                            vert.texCoord.x = vert.position.x * DashCount;
-                            vert.texCoord.y = vert2.texCoord.y; //must be constant across segment
-                            
-
-                            //we have to copy first vert as the tex coords will be different
-                            //shame we can't just recycle the index...
-                            auto vert3 = vert;
-
-                            offset = glm::vec3(0.f, 0.f, -GridSpacing);
-                            height = (readHeightMap(worldX, worldY + 1, GridDensity) - pinPos.y);
-
-                            avgPosition = vert.position + glm::vec3(0.f, 0.f, -AvgDistance);
-                            avgPosition.y = (readHeightMap(worldX, worldY + AvgDistance, GridDensity) - pinPos.y);
-
-                            SlopeVertex vert4;
-                            vert4.position = vert.position + offset;
-                            vert4.position.y = height;
-                            vert4.normal = readNormal(worldX, worldY + 1, GridDensity);
-                            vert4.texCoord = { vert4.position.z * DashCount, std::min(-glm::dot(glm::vec3(0.f, 1.f, 0.f), glm::normalize(avgPosition - vert3.position)) * SlopeSpeed, 1.f) };
-                            vert3.texCoord.x = vert3.position.z * DashCount;
-                            vert3.texCoord.y = vert4.texCoord.y;
-
-                            vert.position += vert.normal * SurfaceOffset;
-                            vert2.position += vert2.normal * SurfaceOffset;
-                            vert3.position += vert3.normal * SurfaceOffset;
-                            vert4.position += vert4.normal * SurfaceOffset;
-
-                            //do this last once we know everything was modified
-                            //TODO this is a lazy addition where we could really skip
-                            //all vert processing entirely when not needed, but it
-                            //doesn't actually make processing time *worse*
-                            if ((y % (NormalMapMultiplier / 2) == 0))
-                            {
-                                m_slopeBuffer.push_back(vert);
-                                m_slopeIndices.push_back(currIndex++);
-                                m_slopeBuffer.push_back(vert2);
-                                m_slopeIndices.push_back(currIndex++);
-                            }
+                            tileBuffer.push_back(vert);
+                            tileBuffer.push_back(vert2);
+                        }
 
-                            if ((x % (NormalMapMultiplier / 2)) == 0)
-                            {
-                                m_slopeBuffer.push_back(vert3);
-                                m_slopeIndices.push_back(currIndex++);
-                                m_slopeBuffer.push_back(vert4);
-                                m_slopeIndices.push_back(currIndex++);
-                            }
+                        if ((x % (NormalMapMultiplier / 2)) == 0)
+                        {
+                            tileBuffer.push_back(vert3);
+                            tileBuffer.push_back(vert4);
                         }
                     }
                 }
-                
-                //static constexpr float LowestHeight = -0.04f;
-                //static constexpr float HighestHeight = 0.04f;
-                //static constexpr float MaxHeight = HighestHeight - LowestHeight;
-                ////if (MaxHeight != 0)
-                //{
-                //    for (auto& v : m_slopeBuffer)
-                //    {
-                //        auto vertHeight = (v.position.y - epsilon) - LowestHeight;
-                //        vertHeight /= MaxHeight;
-                //        //v.colour = { 0.f, 0.4f * vertHeight, 1.f - vertHeight, 0.8f };
-                //        v.colour = 
-                //        { 
-                //            cro::Util::Easing::easeInQuint(std::max(0.f, (vertHeight - 0.5f) * 2.f)),
-                //            //0.f,
-                //            0.5f,
-                //            cro::Util::Easing::easeInQuint(0.8f + (std::min(1.f, vertHeight * 2.f) * 0.2f)),
-                //            0.8f
-                //        };
-                //    }
-                //}
-
-                m_slopeProperties.meshData->vertexCount = static_cast<std::uint32_t>(m_slopeBuffer.size());
             }
+        };
 
-            m_wantsUpdate = false;
+        {
+            CRO_PROFILE_SCOPE("TerrainBuilder::slope");
+            cro::JobSystem::parallelFor(slopeTiles.size(), updateSlopeTile);
         }
-        else
+
+        m_slopeBuffer.clear();
+        for (const auto& tile : slopeTiles)
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            m_slopeBuffer.insert(m_slopeBuffer.end(), tile.begin(), tile.end());
         }
+
+        //indices are simply sequential as each segment has its own verts
+        m_slopeIndices.resize(m_slopeBuffer.size());
+        std::iota(m_slopeIndices.begin(), m_slopeIndices.end(), 0u);
+
+        //static constexpr float LowestHeight = -0.04f;
+        //static constexpr float HighestHeight = 0.04f;
+        //static constexpr float MaxHeight = HighestHeight - LowestHeight;
+        ////if (MaxHeight != 0)
+        //{
+        //    for (auto& v : m_slopeBuffer)
+        //    {
+        //        auto vertHeight = (v.position.y - epsilon) - LowestHeight;
+        //        vertHeight /= MaxHeight;
+        //        //v.colour = { 0.f, 0.4f * vertHeight, 1.f - vertHeight, 0.8f };
+        //        v.colour = 
+        //        { 
+        //            cro::Util::Easing::easeInQuint(std::max(0.f, (vertHeight - 0.5f) * 2.f)),
+        //            //0.f,
+        //            0.5f,
+        //            cro::Util::Easing::easeInQuint(0.8f + (std::min(1.f, vertHeight * 2.f) * 0.2f)),
+        //            0.8f
+        //        };
+        //    }
+        //}
+
+        m_slopeProperties.meshData->vertexCount = static_cast<std::uint32_t>(m_slopeBuffer.size());
     }
 }
 
@@ -1463,6 +1783,8 @@ void TerrainBuilder::renderNormalMap(bool forceUpdate)
     if (m_currentHole && !forceUpdate &&
         m_holeData[m_currentHole].modelEntity == m_holeData[m_currentHole - 1].modelEntity)
     {
+        //existing values are still valid
+        cro::JobSystem::run([&]() { buildLayout(); }, &m_layoutJob);
         return;
     }
 
@@ -1511,8 +1833,17 @@ void TerrainBuilder::renderNormalMap(bool forceUpdate)
     glCheck(glDeleteVertexArrays(vaoCount, vaos.data()));
 
 
-    //copy the texture to an array we can query
-    m_normalMapValues.resize(m_normalMap.getSize().x * m_normalMap.getSize().y * 4);
-    glBindTexture(GL_TEXTURE_2D, m_normalMap.getTexture(1).textureID);
-    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_FLOAT, m_normalMapValues.data());
+    //copy the texture to an array we can query once the GPU has
+    //finished with it, rather than stalling here - the layout job
+    //isn't running until then so it's safe to write the values from the callback
+    cro::GPUReadback::cancel(m_normalMapReadback);
+    m_normalMapReadback = cro::GPUReadback::readTexture(m_normalMap.getTexture(1).textureID, m_normalMap.getSize(), cro::GPUReadback::Format::RGBA32F,
+        [&](const std::byte* data, std::size_t size)
+        {
+            m_normalMapValues.resize(size / sizeof(float));
+            std::memcpy(m_normalMapValues.data(), data, size);
+
+            m_normalMapReadback = 0;
+            cro::JobSystem::run([&]() { buildLayout(); }, &m_layoutJob);
+        });
 }
\ No newline at end of file
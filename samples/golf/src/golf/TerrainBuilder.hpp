@@ -34,17 +34,19 @@ source distribution.
 #include "Treeset.hpp"
 #include "ChunkVisSystem.hpp"
 
+#include <crogine/core/JobSystem.hpp>
 #include <crogine/gui/GuiClient.hpp>
 #include <crogine/ecs/Entity.hpp>
 #include <crogine/ecs/components/BillboardCollection.hpp>
+#include <crogine/graphics/MaterialData.hpp>
 #include <crogine/graphics/MeshData.hpp>
 #include <crogine/graphics/Image.hpp>
 #include <crogine/graphics/MultiRenderTexture.hpp>
+#include <crogine/graphics/OcclusionBuffer.hpp>
 #include <crogine/graphics/ArrayTexture.hpp>
+#include <crogine/graphics/GPUReadback.hpp>
 
 #include <vector>
-#include <thread>
-#include <atomic>
 #include <memory>
 #include <array>
 
@@ -96,12 +98,15 @@ public:
 
     void applyCrowdDensity();
 
+    //contains a coarse copy of the terrain for culling anything hidden behind hills
+    cro::OcclusionBuffer& getOcclusionBuffer() { return m_occlusionBuffer; }
+
 private:
     SharedStateData& m_sharedData;
     const std::vector<HoleData>& m_holeData;
     std::size_t m_currentHole;
 
-    std::vector<std::unique_ptr<cro::ArrayTexture<float, 4, cro::TexturePrecision::Low>>> m_arrayTextures;
+    std::vector<std::unique_ptr<cro::ArrayTexture<std::uint16_t, 4, cro::TexturePrecision::Half>>> m_arrayTextures;
 
     std::array<cro::Billboard, BillboardID::Count> m_billboardTemplates = {};
     std::vector<cro::Billboard> m_billboardBuffer;
@@ -156,6 +161,38 @@ private:
     }m_terrainProperties;
     cro::Entity m_terrainEntity;
 
+    //the terrain is split into chunks on the same grid as the ChunkVisSystem
+    //so each one can be culled individually, and drawn with fewer verts
+    //the further it is from the camera. All chunks share the same VBO
+    static constexpr std::int32_t TerrainChunkCount = ChunkVisSystem::RowCount * ChunkVisSystem::ColCount;
+    static constexpr std::int32_t TerrainLodCount = 4;
+    struct TerrainChunk final
+    {
+        enum Edge
+        {
+            Self, Left, Right, Bottom, Top, Count
+        };
+
+        glm::uvec2 start = glm::uvec2(0u); //first and last vertex on each axis
+        glm::uvec2 end = glm::uvec2(0u);
+        std::uint32_t ibo = 0;
+        std::int32_t lod = TerrainLodCount - 1;
+
+        //vertex stride of this chunk and the stride each edge was stitched to
+        std::array<std::uint32_t, Edge::Count> strides = {};
+        cro::Entity entity;
+    };
+    std::array<TerrainChunk, TerrainChunkCount> m_terrainChunks = {};
+    std::vector<std::uint32_t> m_chunkIndices;
+
+    void createTerrainChunks(const cro::Mesh::Data&, const cro::Material::Data&, const cro::Material::Data&, cro::Scene&);
+    void updateTerrainLod(glm::vec3 cameraPosition); //called by ChunkVisSystem
+    void applyTerrainLod();
+    void buildChunkIndices(TerrainChunk&);
+
+    cro::OcclusionBuffer m_occlusionBuffer;
+    void updateOccluders();
+
 
     struct SlopeVertex final
     {
@@ -177,16 +214,18 @@ private:
     }m_slopeProperties;
 
 
-    std::atomic_bool m_threadRunning;
-    std::atomic_bool m_wantsUpdate;
-    std::unique_ptr<std::thread> m_thread;
+    //completes when the billboard and slope layout
+    //for the current hole has been built
+    cro::JobSystem::Counter m_layoutJob;
 
-    void threadFunc();
+    void buildLayout();
 
     cro::MultiRenderTexture m_normalMap;
     cro::Shader m_normalShader;
     std::vector<float> m_normalMapValues;
+    cro::GPUReadback::ID m_normalMapReadback;
 
+    //starts the thread update once the normal map has been read back
     void renderNormalMap(bool forceUpdate = false); //don't call this from thread!!
 
 
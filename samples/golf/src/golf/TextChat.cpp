@@ -46,6 +46,7 @@ source distribution.
 #include <crogine/util/Easings.hpp>
 
 #include <cstring>
+#include <list>
 
 #ifdef __linux__
 #include <stdio.h>
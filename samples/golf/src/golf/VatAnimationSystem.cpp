@@ -33,64 +33,93 @@ source distribution.
 #include <crogine/ecs/components/Model.hpp>
 #include <crogine/util/Random.hpp>
 
+namespace
+{
+    //matches the number of texture variants in the crowd model
+    constexpr std::size_t DesyncCount = 3;
+    constexpr float DesyncOffset = 0.15f;
+}
+
 void VatAnimation::setVatData(const VatFile& file)
 {
     CRO_ASSERT(file.m_frameCount != 0, "");
 
     totalTime = static_cast<float>(file.m_frameCount) / file.m_frameRate;
     loopTime = static_cast<float>(file.m_frameLoop) / file.m_frameRate;
-
-    targetTime = loopTime;
-    //LogI << "Target Time: " << targetTime << std::endl;
 }
 
 void VatAnimation::applaud()
 {
-    targetTime = totalTime;
-    currentTime = loopTime - cro::Util::Random::value(0.2f, 0.7f);
-
-    offsetMultiplier = 0.f;
+    //the start time is only known by the system
+    applaudPending = true;
 }
 
 VatAnimationSystem::VatAnimationSystem(cro::MessageBus& mb)
-    : cro::System(mb, typeid(VatAnimationSystem))
+    : cro::System   (mb, typeid(VatAnimationSystem)),
+    m_elapsedTime   (0.f)
 {
     requireComponent<VatAnimation>();
     requireComponent<cro::Model>();
 }
 
 //public
-void VatAnimationSystem::process(float dt)
+void VatAnimationSystem::process(float)
 {
     const auto& entities = getEntities();
     for (auto entity : entities)
     {
         auto& anim = entity.getComponent<VatAnimation>();
-        anim.currentTime += dt;
+        auto& model = entity.getComponent<cro::Model>();
 
-        if (anim.currentTime > anim.targetTime)
+        //instance data is only written when the crowd changes
+        //or starts applauding - the shader does the rest.
+        const auto instanceCount = model.getInstanceCount();
+        if (instanceCount == 0)
         {
-            anim.currentTime -= anim.targetTime;
-
-            //always default back to idle looping.
-            anim.targetTime = anim.loopTime;
+            anim.applaudPending = false;
+            continue;
         }
 
-        if (anim.targetTime < anim.totalTime)
+        bool dirty = false;
+        if (anim.instanceData.size() != instanceCount)
         {
-            //we're in the idle loop so slow desync instances
-            anim.offsetMultiplier = std::min(1.f, anim.offsetMultiplier + dt);
+            //new instances start in the idle loop
+            const auto oldSize = anim.instanceData.size();
+            anim.instanceData.resize(instanceCount, glm::vec4(0.f));
+            for (auto i = oldSize; i < instanceCount; ++i)
+            {
+                anim.instanceData[i].w = DesyncOffset * static_cast<float>(i % DesyncCount);
+            }
+            dirty = true;
         }
 
-        //would prefer not to do the string lookup, but perf hit is negligable...
-        float normTime = anim.currentTime / anim.totalTime;
-        float targTime = anim.targetTime / anim.totalTime;
-        entity.getComponent<cro::Model>().setMaterialProperty(0, "u_time", normTime);
-        entity.getComponent<cro::Model>().setMaterialProperty(0, "u_maxTime", targTime);
-        entity.getComponent<cro::Model>().setMaterialProperty(0, "u_offsetMultiplier", anim.offsetMultiplier);
+        if (anim.applaudPending)
+        {
+            for (auto& data : anim.instanceData)
+            {
+                data.x = m_elapsedTime;
+                data.y = anim.loopTime - cro::Util::Random::value(0.2f, 0.7f);
+                data.z = anim.totalTime - data.y;
+            }
+            anim.applaudPending = false;
+            dirty = true;
+        }
 
-        entity.getComponent<cro::Model>().setShadowMaterialProperty(0, "u_time", normTime);
-        entity.getComponent<cro::Model>().setShadowMaterialProperty(0, "u_maxTime", targTime);
-        entity.getComponent<cro::Model>().setShadowMaterialProperty(0, "u_offsetMultiplier", anim.offsetMultiplier);
+        if (dirty)
+        {
+            model.setInstanceData(anim.instanceData);
+        }
     }
-}
\ No newline at end of file
+}
+
+//private
+void VatAnimationSystem::onEntityAdded(cro::Entity entity)
+{
+    //the animation length never changes so only needs setting once
+    const auto& anim = entity.getComponent<VatAnimation>();
+    const glm::vec2 timing(anim.loopTime / anim.totalTime, 1.f / anim.totalTime);
+
+    auto& model = entity.getComponent<cro::Model>();
+    model.setMaterialProperty(0, "u_vatTime", timing);
+    model.setShadowMaterialProperty(0, "u_vatTime", timing);
+}
@@ -30,16 +30,21 @@ source distribution.
 #pragma once
 
 #include <crogine/ecs/System.hpp>
+#include <crogine/detail/glm/vec4.hpp>
+
+#include <vector>
 
 class VatFile;
 struct VatAnimation final
 {
     float totalTime = 1.f;
-    float currentTime = 0.f;
     float loopTime = 1.f;
-    float targetTime = 1.f;
 
-    float offsetMultiplier = 0.f;
+    //playback is calculated in the shader from this per-instance
+    //data, so it's only updated when the animation state changes.
+    //x state start time, y start offset, z one shot duration, w desync offset
+    std::vector<glm::vec4> instanceData;
+    bool applaudPending = false;
 
     void setVatData(const VatFile&);
     void applaud();
@@ -52,6 +57,11 @@ public:
 
     void process(float) override;
 
+    //this must match the elapsed time used by the shader wind buffer
+    void setElapsedTime(float time) { m_elapsedTime = time; }
+
 private:
+    float m_elapsedTime;
 
+    void onEntityAdded(cro::Entity) override;
 };
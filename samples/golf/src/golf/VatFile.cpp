@@ -33,6 +33,9 @@ source distribution.
 #include <crogine/core/FileSystem.hpp>
 #include <crogine/graphics/Image.hpp>
 #include <crogine/graphics/ImageArray.hpp>
+#include <crogine/detail/glm/gtc/packing.hpp>
+
+#include <algorithm>
 
 namespace
 {
@@ -226,7 +229,7 @@ bool VatFile::hasTangents() const
     return !m_dataPaths[DataID::Tangent].empty();
 }
 
-bool VatFile::fillArrayTexture(cro::ArrayTexture<float, 4u, cro::TexturePrecision::Low>& arrayTexture) const
+bool VatFile::fillArrayTexture(ArrayTexture& arrayTexture) const
 {
     if (m_binaryDims.x == 0 || m_binaryDims.y == 0)
     {
@@ -238,7 +241,16 @@ bool VatFile::fillArrayTexture(cro::ArrayTexture<float, 4u, cro::TexturePrecisio
     cro::ImageArray<float> diffuseMap;
     if (diffuseMap.loadFromFile(cro::FileSystem::getResourcePath() + m_diffusePath, true))
     {
-        if (!arrayTexture.insertLayer(diffuseMap, 0))
+        if (diffuseMap.getFormat() != cro::ImageFormat::RGBA)
+        {
+            return false;
+        }
+
+        std::vector<std::uint16_t> diffuseData(diffuseMap.size());
+        std::transform(diffuseMap.begin(), diffuseMap.end(), diffuseData.begin(),
+            [](float f) { return glm::packHalf1x16(f); });
+
+        if (!arrayTexture.insertLayer(diffuseData, 0))
         {
             return false;
         }
@@ -266,7 +278,7 @@ bool VatFile::fillArrayTexture(cro::ArrayTexture<float, 4u, cro::TexturePrecisio
 }
 
 //private
-void VatFile::loadBinary(const std::string& path, std::vector<float>& dst, glm::uvec2 dims)
+void VatFile::loadBinary(const std::string& path, std::vector<std::uint16_t>& dst, glm::uvec2 dims)
 {
     dst.clear();
     dst.resize(dims.x * dims.y * 4);
@@ -275,11 +287,21 @@ void VatFile::loadBinary(const std::string& path, std::vector<float>& dst, glm::
     file.file = SDL_RWFromFile(path.c_str(), "rb");
     if (file.file)
     {
-        auto read = SDL_RWread(file.file, dst.data(), dst.size() * sizeof(float), 1);
-        if (read == 0)
+        //read in chunks so we never need to hold a full float copy of the data
+        std::array<float, 4096> buffer = {};
+        for (auto i = 0u; i < dst.size(); i += buffer.size())
         {
-            LogI << SDL_GetError() << std::endl;
-            dst.clear();
+            const auto count = std::min(buffer.size(), dst.size() - i);
+            auto read = SDL_RWread(file.file, buffer.data(), count * sizeof(float), 1);
+            if (read == 0)
+            {
+                LogI << SDL_GetError() << std::endl;
+                dst.clear();
+                return;
+            }
+
+            std::transform(buffer.begin(), buffer.begin() + count, dst.begin() + i,
+                [](float f) { return glm::packHalf1x16(f); });
         }
         //TODO check the file size isn't *greater* than the amount of data we're trying to read.
     }
@@ -51,10 +51,13 @@ public:
 
     bool hasTangents() const;
 
+    //VAT data is stored as 16 bit floats
+    using ArrayTexture = cro::ArrayTexture<std::uint16_t, 4, cro::TexturePrecision::Half>;
+
     //returns false if there was no array texture to create
     //model texture is layer 0, followed by position, normal
     //and optionally tangent
-    bool fillArrayTexture(cro::ArrayTexture<float, 4, cro::TexturePrecision::Low>&) const;
+    bool fillArrayTexture(ArrayTexture&) const;
 
 private:
 
@@ -74,10 +77,12 @@ private:
         };
     };
     std::array<std::string, DataID::Count> m_dataPaths = {};
-    std::array<std::vector<float>, DataID::Count> m_binaryData = {};
+    //packed half floats - full precision isn't needed
+    //and this halves the memory and upload size
+    std::array<std::vector<std::uint16_t>, DataID::Count> m_binaryData = {};
     glm::uvec2 m_binaryDims;
 
-    void loadBinary(const std::string& path, std::vector<float>& dst, glm::uvec2 dims);
+    void loadBinary(const std::string& path, std::vector<std::uint16_t>& dst, glm::uvec2 dims);
 
     void reset();
 
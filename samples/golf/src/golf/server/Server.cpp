@@ -38,6 +38,7 @@ source distribution.
 #include <crogine/core/Log.hpp>
 #include <crogine/core/Clock.hpp>
 #include <crogine/core/HiResTimer.hpp>
+#include <crogine/core/Profiler.hpp>
 
 #include <Social.hpp>
 
@@ -52,6 +53,7 @@ namespace
 Server::Server()
     : m_maxConnections  (ConstVal::MaxClients),
     m_running           (false),
+    m_spectatorRelayEnabled(false),
     m_gameMode          (GameMode::None),
     m_maxPlayers        (MaxGolfPlayers),
     m_playerCount       (0),
@@ -154,21 +156,39 @@ void Server::setLeagueID(std::int32_t id)
     m_sharedData.leagueID = id;
 }
 
+void Server::setBenchmarkHole(std::int32_t hole)
+{
+    m_sharedData.benchmarkHole = hole;
+}
+
 //private
 void Server::run()
 {
+    cro::Profiler::setThreadName("Server");
+
     if (!m_sharedData.host.start("", ConstVal::GamePort, m_maxConnections, 4))
     {
         m_running = false;
         cro::Logger::log("Failed to start host service", cro::Logger::Type::Error);
         return;
     }    
+
+#ifndef USE_GNS
+    //coalesces the many small reliable updates sent each tick
+    m_sharedData.host.setBatchingEnabled(true);
+#endif
     
     if (!m_voiceHost.start(ConstVal::VoicePort))
     {
         LogW << "Unable to start voice channel server" << std::endl;
     }
 
+    if (m_spectatorRelayEnabled
+        && !m_sharedData.relay.start(ConstVal::SpectatorPort))
+    {
+        LogW << "Unable to start spectator relay" << std::endl;
+    }
+
     LOG("Server launched", cro::Logger::Type::Info);
 
     m_currentState = std::make_unique<sv::LobbyState>(m_sharedData);
@@ -189,6 +209,7 @@ void Server::run()
 
     while (m_running)
     {
+        CRO_PROFILE_SCOPE("Server::frame");
         m_voiceHost.update();
 
         while (!m_sharedData.messageBus.empty())
@@ -210,6 +231,7 @@ void Server::run()
         net::NetEvent evt;
         while(m_sharedData.host.pollEvent(evt))
         {
+            CRO_PROFILE_SCOPE("Server::netEvent");
             m_currentState->netEvent(evt);
         
             //handle connects / disconnects
@@ -302,14 +324,19 @@ void Server::run()
         while (netAccumulatedTime > netFrameTime)
         {
             netAccumulatedTime -= netFrameTime;
+
+            CRO_PROFILE_SCOPE("Server::netBroadcast");
             m_currentState->netBroadcast();
         }
+        m_sharedData.relay.endTick();
 
         //logic updates
         updateAccumulator += updateClock.restart();
         while (updateAccumulator > ConstVal::FixedGameUpdate)
         {
             updateAccumulator -= ConstVal::FixedGameUpdate;
+
+            CRO_PROFILE_SCOPE("Server::process");
             nextState = m_currentState->process(ConstVal::FixedGameUpdate);
         }
 
@@ -333,6 +360,7 @@ void Server::run()
         //switch state if last update returned a new state ID
         if (nextState != m_currentState->stateID())
         {
+            CRO_PROFILE_SCOPE("Server::changeState");
             switch (nextState)
             {
             default: m_running = false; break;
@@ -348,6 +376,15 @@ void Server::run()
             }
 
             m_sharedData.host.broadcastPacket(PacketID::StateChange, std::uint8_t(nextState), net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+
+            //late joining spectators only need the results of the current round
+            if (nextState == sv::StateID::Lobby)
+            {
+                m_sharedData.relay.clearKeyframes(PacketID::SetHole);
+                m_sharedData.relay.clearKeyframes(PacketID::SetPlayer);
+                m_sharedData.relay.clearKeyframes(PacketID::ScoreUpdate);
+            }
+            m_sharedData.relay.setKeyframe(PacketID::StateChange, 0, std::uint8_t(nextState));
             
             //mitigate large DT which may have built up while new state was loading.
             netFrameClock.restart();
@@ -364,6 +401,7 @@ void Server::run()
     }
 
     m_voiceHost.stop();
+    m_sharedData.relay.stop();
     m_sharedData.host.stop();
 
     LOG("Server quit", cro::Logger::Type::Info);
@@ -489,6 +527,8 @@ void Server::removeClient(std::size_t clientID)
 
     //broadcast to all connected clients
     m_sharedData.host.broadcastPacket(PacketID::ClientDisconnected, static_cast<std::uint8_t>(clientID), net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+    m_sharedData.relay.removeKeyframe(PacketID::LobbyUpdate, static_cast<std::uint16_t>(clientID));
+    m_sharedData.relay.publish(PacketID::ClientDisconnected, static_cast<std::uint8_t>(clientID));
     LOG("Client disconnected", cro::Logger::Type::Info);
 
     m_clientCount--;
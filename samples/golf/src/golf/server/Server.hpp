@@ -70,6 +70,14 @@ public:
     //in the case of tournaments it's set to (int32 max - tournamentID)
     void setLeagueID(std::int32_t id);
 
+    //plays only the given hole of the course, or all holes if -1
+    void setBenchmarkHole(std::int32_t hole);
+
+    //starts a relay for read-only spectators on ConstVal::SpectatorPort
+    //the next time the server is launched
+    void setSpectatorRelayEnabled(bool enabled) { m_spectatorRelayEnabled = enabled; }
+    bool getSpectatorRelayEnabled() const { return m_spectatorRelayEnabled; }
+
     //note this is not atomic!
     void setPreferredIP(const std::string& ip) { m_preferredIP = ip; }
     const std::string& getPreferredIP() const { return m_preferredIP; }
@@ -79,6 +87,7 @@ private:
     std::size_t m_maxConnections;
     std::string m_preferredIP;
     std::atomic_bool m_running;
+    std::atomic_bool m_spectatorRelayEnabled;
     std::unique_ptr<std::thread> m_thread;
 
     std::unique_ptr<sv::State> m_currentState;
@@ -48,6 +48,7 @@ source distribution.
 
 #include <crogine/core/Log.hpp>
 #include <crogine/core/ConfigFile.hpp>
+#include <crogine/core/Profiler.hpp>
 
 #include <crogine/ecs/components/Transform.hpp>
 #include <crogine/ecs/components/Callback.hpp>
@@ -296,6 +297,7 @@ void GolfState::handleMessage(const cro::Message& msg)
                     //broadcast a hole complete for this client (to update client scores)
                     std::uint16_t pkt = (playerInfo[0].client << 8) | playerInfo[0].player;
                     m_sharedData.host.broadcastPacket(PacketID::HoleComplete, pkt, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+                    m_sharedData.relay.publish(PacketID::HoleComplete, pkt);
                 }
                 else
                 {
@@ -608,11 +610,17 @@ void GolfState::netBroadcast()
                 info.collisionTerrain = ballC.state == Ball::State::Flight ? ballC.lastTerrain : ConstVal::NullValue;
                 ballC.lastTerrain = ConstVal::NullValue;
                 m_sharedData.host.broadcastPacket(PacketID::ActorUpdate, info, net::NetFlag::Unreliable);
+                m_sharedData.relay.publish(PacketID::ActorUpdate, info);
             }
         }
     }
     auto wind = cro::Util::Net::compressVec3(m_scene.getSystem<BallSystem>()->getWindDirection());
     m_sharedData.host.broadcastPacket(PacketID::WindDirection, wind, net::NetFlag::Unreliable);
+    if (wind != m_spectatorWind)
+    {
+        m_spectatorWind = wind;
+        m_sharedData.relay.setKeyframe(PacketID::WindDirection, 0, wind);
+    }
 }
 
 std::int32_t GolfState::process(float dt)
@@ -657,6 +665,7 @@ std::int32_t GolfState::process(float dt)
                                 //broadcast hole complete message so all clients update scores correctly
                                 std::uint16_t pkt = (group.playerInfo[0].client << 8) | group.playerInfo[0].player;
                                 m_sharedData.host.broadcastPacket(PacketID::HoleComplete, pkt, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+                                m_sharedData.relay.publish(PacketID::HoleComplete, pkt);
                             }
                         }
                     }
@@ -992,6 +1001,8 @@ void GolfState::checkReadyQuit(std::uint8_t clientID)
 
 void GolfState::setNextPlayer(std::int32_t groupID, bool newHole)
 {
+    CRO_PROFILE_FUNCTION();
+
     if (m_sharedData.teamMode && newHole)
     {
         //ensure we always alternate team member on the tee
@@ -1035,6 +1046,7 @@ void GolfState::setNextPlayer(std::int32_t groupID, bool newHole)
         su.hole = m_currentHole;
     
         m_sharedData.host.broadcastPacket(PacketID::ScoreUpdate, su, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+        m_sharedData.relay.setKeyframe(PacketID::ScoreUpdate, std::uint16_t((su.client << 8) | su.player), su);
         playerInfo[0].ballEntity.getComponent<Ball>().lastStrokeDistance = 0.f;
 
         if (m_sharedData.bigBalls)
@@ -1073,6 +1085,7 @@ void GolfState::setNextPlayer(std::int32_t groupID, bool newHole)
                 su2.hole = m_currentHole;
 
                 m_sharedData.host.broadcastPacket(PacketID::ScoreUpdate, su2, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+                m_sharedData.relay.setKeyframe(PacketID::ScoreUpdate, std::uint16_t((su2.client << 8) | su2.player), su2);
                 teamMateInfo->ballEntity.getComponent<Ball>().lastStrokeDistance = 0.f;
 
                 if (m_sharedData.bigBalls)
@@ -1309,6 +1322,7 @@ void GolfState::setNextPlayer(std::int32_t groupID, bool newHole)
                     m_sharedData.host.sendPacket(m_sharedData.clients[c].peer, PacketID::SetPlayer, player, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
                     m_sharedData.host.sendPacket(m_sharedData.clients[c].peer, PacketID::ActorAnimation, std::uint8_t(AnimationID::Idle), net::NetFlag::Reliable, ConstVal::NetChannelReliable);
                 }
+                m_sharedData.relay.setKeyframe(PacketID::SetPlayer, std::uint16_t(groupID), player);
             }
             else
             {
@@ -1349,6 +1363,8 @@ void GolfState::setNextPlayer(std::int32_t groupID, bool newHole)
 
 void GolfState::setNextHole()
 {
+    CRO_PROFILE_FUNCTION();
+
     m_currentBest = MaxStrokes;
     
     if (!m_sharedData.randomWind)
@@ -1387,6 +1403,7 @@ void GolfState::setNextHole()
             su.distanceScore = player.distanceScore[scoreHole];
 
             m_sharedData.host.broadcastPacket(PacketID::ScoreUpdate, su, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+            m_sharedData.relay.setKeyframe(PacketID::ScoreUpdate, std::uint16_t((su.client << 8) | su.player), su);
         }
         group.waitingForHole = false;
     }
@@ -1419,6 +1436,7 @@ void GolfState::setNextHole()
         //tell clients to set up next hole
         std::uint16_t newHole = (m_currentHole << 8) | std::uint8_t(m_holeData[m_currentHole].par);
         m_sharedData.host.broadcastPacket(PacketID::SetHole, newHole, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+        m_sharedData.relay.setKeyframe(PacketID::SetHole, 0, newHole);
 
         //create an ent which waits for all clients to load the next hole
         //which include playing the transition animation.
@@ -1530,6 +1548,7 @@ void GolfState::setNextHole()
             {
                 //end of game baby!
                 m_sharedData.host.broadcastPacket(PacketID::GameEnd, ConstVal::SummaryTimeout, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+                m_sharedData.relay.publish(PacketID::GameEnd, ConstVal::SummaryTimeout);
 
                 //create a timer ent which returns to lobby on time out
                 auto entity = m_scene.createEntity();
@@ -1683,6 +1702,13 @@ bool GolfState::validateMap()
         return false;
     }
 
+    //benchmarks only ever play a single hole
+    if (const auto benchmarkHole = m_sharedData.benchmarkHole.load(); benchmarkHole > -1)
+    {
+        const auto idx = std::min(holeStrings.size() - 1, static_cast<std::size_t>(benchmarkHole));
+        holeStrings = { holeStrings[idx] };
+    }
+
     //check the rules and truncate hole list
     //if requested - 1 front holes, 1 back holes
     if (m_sharedData.holeCount == 1)
@@ -2203,6 +2229,7 @@ void GolfState::doServerCommand(const net::NetEvent& evt)
                     //broadcast hole complete message so clients can update scoreboards
                     std::uint16_t pkt = (m_playerInfo[groupID].playerInfo[0].client << 8 ) | m_playerInfo[groupID].playerInfo[0].player;
                     m_sharedData.host.broadcastPacket(PacketID::HoleComplete, pkt, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+                    m_sharedData.relay.publish(PacketID::HoleComplete, pkt);
                 }
             }
             break;
@@ -2267,6 +2294,7 @@ void GolfState::doServerCommand(const net::NetEvent& evt)
         {
             //end of game baby!
             m_sharedData.host.broadcastPacket(PacketID::GameEnd, std::uint8_t(10), net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+            m_sharedData.relay.publish(PacketID::GameEnd, std::uint8_t(10));
 
             //create a timer ent which returns to lobby on time out
             auto entity = m_scene.createEntity();
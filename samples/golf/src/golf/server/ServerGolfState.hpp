@@ -37,6 +37,8 @@ source distribution.
 #include <crogine/core/Clock.hpp>
 #include <crogine/core/HiResTimer.hpp>
 
+#include <limits>
+
 namespace sv
 {
     class GolfState final : public State
@@ -96,6 +98,9 @@ namespace sv
         //this is the group IDs indexed by client ID so we can look up a group for a given client
         std::array<std::int32_t, ConstVal::MaxClients> m_groupAssignments = {};
 
+        //the wind is only sent to spectators when it changes. Starts out of range so the first update is always sent
+        std::array<std::int16_t, 3u> m_spectatorWind = { std::numeric_limits<std::int16_t>::min(), 0, 0 };
+
         void sendInitialGameState(std::uint8_t);
         void handlePlayerInput(const net::NetEvent::Packet&, bool predict);
         void checkReadyQuit(std::uint8_t);
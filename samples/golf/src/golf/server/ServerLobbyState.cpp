@@ -180,6 +180,7 @@ void LobbyState::netEvent(const net::NetEvent& evt)
 
             //forward to all clients (this may have been a request from someone not hosting)
             m_sharedData.host.broadcastPacket(PacketID::MapInfo, evt.packet.getData(), evt.packet.getSize(), net::NetFlag::Reliable, ConstVal::NetChannelStrings);
+            m_sharedData.relay.setKeyframe(PacketID::MapInfo, 0, evt.packet.getData(), evt.packet.getSize());
         }
             break;
         case PacketID::ScoreType:
@@ -187,6 +188,7 @@ void LobbyState::netEvent(const net::NetEvent& evt)
             {
                 m_sharedData.scoreType = evt.packet.as<std::uint8_t>();
                 m_sharedData.host.broadcastPacket(PacketID::ScoreType, m_sharedData.scoreType, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+                m_sharedData.relay.setKeyframe(PacketID::ScoreType, 0, m_sharedData.scoreType);
             }
             break;
         case PacketID::NightTime:
@@ -384,6 +386,7 @@ void LobbyState::insertPlayerInfo(const net::NetEvent& evt)
             auto buffer = cd.serialise();
 
             m_sharedData.host.broadcastPacket(PacketID::LobbyUpdate, buffer.data(), buffer.size(), net::NetFlag::Reliable, ConstVal::NetChannelStrings);
+            m_sharedData.relay.setKeyframe(PacketID::LobbyUpdate, static_cast<std::uint16_t>(i), buffer.data(), buffer.size());
         }
         std::uint8_t ready = m_readyState[i] ? 1 : 0;
         m_sharedData.host.broadcastPacket(PacketID::LobbyReady, std::uint16_t(std::uint8_t(i) << 8 | ready), net::NetFlag::Reliable, ConstVal::NetChannelReliable);
@@ -396,8 +399,10 @@ void LobbyState::broadcastRules()
 {
     auto mapDir = serialiseString(m_sharedData.mapDir);
     m_sharedData.host.broadcastPacket(PacketID::MapInfo, mapDir.data(), mapDir.size(), net::NetFlag::Reliable, ConstVal::NetChannelStrings);
+    m_sharedData.relay.setKeyframe(PacketID::MapInfo, 0, mapDir.data(), mapDir.size());
 
     m_sharedData.host.broadcastPacket(PacketID::ScoreType, m_sharedData.scoreType, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
+    m_sharedData.relay.setKeyframe(PacketID::ScoreType, 0, m_sharedData.scoreType);
     m_sharedData.host.broadcastPacket(PacketID::NightTime, m_sharedData.nightTime, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
     m_sharedData.host.broadcastPacket(PacketID::WeatherType, m_sharedData.weatherType, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
     m_sharedData.host.broadcastPacket(PacketID::HoleCount, m_sharedData.holeCount, net::NetFlag::Reliable, ConstVal::NetChannelReliable);
@@ -32,6 +32,7 @@ source distribution.
 #include "../CommonConsts.hpp"
 #include "../PlayerColours.hpp"
 #include "Networking.hpp"
+#include "SpectatorRelay.hpp"
 
 #include <crogine/core/MessageBus.hpp>
 #include <crogine/core/String.hpp>
@@ -89,6 +90,7 @@ namespace sv
     struct SharedData final
     {
         net::NetHost host;
+        SpectatorRelay relay; //only running if enabled with Server::setSpectatorRelayEnabled()
         std::array<sv::ClientConnection, ConstVal::MaxClients> clients;
         cro::MessageBus messageBus;
         cro::String mapDir;
@@ -113,6 +115,7 @@ namespace sv
 
         std::atomic_int32_t leagueID = 0;
         std::atomic_uint64_t hostID = 0;
+        std::atomic_int32_t benchmarkHole = -1; //if not -1 only this hole is loaded. Set from the client thread
 
         std::int32_t bigBalls = 0;
     };
@@ -0,0 +1,248 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+Super Video Golf - zlib licence.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+
+#include "../PacketIDs.hpp"
+#include "../CommonConsts.hpp"
+#include "SpectatorRelay.hpp"
+
+#include <crogine/core/Log.hpp>
+#include <crogine/detail/Assert.hpp>
+#include <crogine/core/Profiler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+    void appendPacket(std::vector<std::uint8_t>& dst, std::uint8_t id, const void* data, std::size_t size)
+    {
+        CRO_ASSERT(size <= std::numeric_limits<std::uint16_t>::max(), "");
+
+        const auto packetSize = static_cast<std::uint16_t>(size);
+        const auto offset = dst.size();
+        dst.resize(offset + sizeof(id) + sizeof(packetSize) + size);
+        dst[offset] = id;
+        std::memcpy(&dst[offset + sizeof(id)], &packetSize, sizeof(packetSize));
+        if (size)
+        {
+            std::memcpy(&dst[offset + sizeof(id) + sizeof(packetSize)], data, size);
+        }
+    }
+
+    std::uint32_t keyframeKey(std::uint8_t id, std::uint16_t key)
+    {
+        return (std::uint32_t(id) << 16) | key;
+    }
+
+    //ticks are 50ms, so this is frequent enough to
+    //accept connections without waiting on a frame
+    constexpr std::chrono::milliseconds PollTime(10);
+}
+
+SpectatorRelay::SpectatorRelay()
+    : m_running         (false),
+    m_spectatorCount    (0),
+    m_keyframeTimestamp (0)
+{
+
+}
+
+SpectatorRelay::~SpectatorRelay()
+{
+    stop();
+}
+
+//public
+bool SpectatorRelay::start(std::uint16_t port, std::size_t maxSpectators)
+{
+    if (m_running)
+    {
+        return true;
+    }
+
+    if (!m_host.start("", port, maxSpectators, 1))
+    {
+        LogE << "Failed starting spectator relay on port " << port << std::endl;
+        return false;
+    }
+
+    m_pendingFrame.clear();
+    m_outgoingFrame.clear();
+
+    m_running = true;
+    m_thread = std::make_unique<std::thread>(&SpectatorRelay::threadFunc, this);
+
+    LogI << "Spectator relay listening on " << port << std::endl;
+    return true;
+}
+
+void SpectatorRelay::stop()
+{
+    if (m_running)
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            m_running = false;
+        }
+        m_condition.notify_one();
+
+        m_thread->join();
+        m_thread.reset();
+
+        m_host.stop();
+        m_spectatorCount = 0;
+
+        std::scoped_lock lock(m_mutex);
+        m_keyframes.clear();
+    }
+}
+
+void SpectatorRelay::publish(std::uint8_t id, const void* data, std::size_t size)
+{
+    if (m_running)
+    {
+        appendPacket(m_pendingFrame, id, data, size);
+    }
+}
+
+void SpectatorRelay::setKeyframe(std::uint8_t id, std::uint16_t key, const void* data, std::size_t size)
+{
+    if (m_running)
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            auto& keyframe = m_keyframes[keyframeKey(id, key)];
+            keyframe.timestamp = ++m_keyframeTimestamp;
+            keyframe.data.clear();
+            appendPacket(keyframe.data, id, data, size);
+        }
+        publish(id, data, size);
+    }
+}
+
+void SpectatorRelay::removeKeyframe(std::uint8_t id, std::uint16_t key)
+{
+    if (m_running)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_keyframes.erase(keyframeKey(id, key));
+    }
+}
+
+void SpectatorRelay::clearKeyframes(std::uint8_t id)
+{
+    if (m_running)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_keyframes.erase(m_keyframes.lower_bound(keyframeKey(id, 0)), m_keyframes.upper_bound(keyframeKey(id, 0xffff)));
+    }
+}
+
+void SpectatorRelay::endTick()
+{
+    if (m_running
+        && !m_pendingFrame.empty())
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            m_outgoingFrame.insert(m_outgoingFrame.end(), m_pendingFrame.begin(), m_pendingFrame.end());
+        }
+        m_pendingFrame.clear();
+        m_condition.notify_one();
+    }
+}
+
+//private
+void SpectatorRelay::threadFunc()
+{
+    cro::Profiler::setThreadName("Spectator Relay");
+
+    std::vector<std::uint8_t> frame;
+    std::vector<std::uint8_t> keyframe;
+    std::vector<const Keyframe*> sortedKeyframes;
+
+    while (m_running)
+    {
+        cro::NetEvent evt;
+        while (m_host.pollEvent(evt))
+        {
+            if (evt.type == cro::NetEvent::ClientConnect)
+            {
+                m_spectatorCount++;
+
+                keyframe.clear();
+                {
+                    std::scoped_lock lock(m_mutex);
+
+                    //eg the hole must be set before the active player
+                    sortedKeyframes.clear();
+                    for (const auto& [_, k] : m_keyframes)
+                    {
+                        sortedKeyframes.push_back(&k);
+                    }
+                    std::sort(sortedKeyframes.begin(), sortedKeyframes.end(),
+                        [](const Keyframe* a, const Keyframe* b)
+                        {
+                            return a->timestamp < b->timestamp;
+                        });
+
+                    for (const auto* k : sortedKeyframes)
+                    {
+                        keyframe.insert(keyframe.end(), k->data.begin(), k->data.end());
+                    }
+                }
+                m_host.sendPacket(evt.peer, PacketID::SpectatorKeyframe, keyframe.data(), keyframe.size(), cro::NetFlag::Reliable);
+            }
+            else if (evt.type == cro::NetEvent::ClientDisconnect)
+            {
+                m_spectatorCount--;
+            }
+            //spectators are read-only so anything else they send is ignored
+        }
+
+        {
+            std::unique_lock lock(m_mutex);
+            m_condition.wait_for(lock, PollTime, [&]() { return !m_running || !m_outgoingFrame.empty(); });
+            frame.swap(m_outgoingFrame);
+        }
+
+        if (!frame.empty())
+        {
+            //broadcasting creates a single packet shared by all spectators
+            if (m_spectatorCount)
+            {
+                m_host.broadcastPacket(PacketID::SpectatorFrame, frame.data(), frame.size(), cro::NetFlag::Reliable);
+            }
+            frame.clear();
+        }
+    }
+}
@@ -0,0 +1,127 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+Super Video Golf - zlib licence.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+
+#pragma once
+
+#include <crogine/network/NetHost.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+Fans out a compact copy of the game stream to read-only spectators,
+so that large audiences don't take up client slots on the game server,
+nor cost it a peer each. The server thread publishes events, which are
+collected into a single frame each network tick and broadcast from the
+relay's own thread and host.
+
+Spectators receive PacketID::SpectatorKeyframe when they connect, followed
+by a PacketID::SpectatorFrame each tick. Both contain a list of packets,
+each made up of a uint8 PacketID, a uint16 size and the packet data, which
+can be parsed the same way as packets received from the game server.
+
+The relay always uses ENet (cro::NetHost) so that it's available to LAN
+and Steam builds alike.
+*/
+class SpectatorRelay final
+{
+public:
+    static constexpr std::size_t MaxSpectators = 512;
+
+    SpectatorRelay();
+    ~SpectatorRelay();
+
+    SpectatorRelay(const SpectatorRelay&) = delete;
+    SpectatorRelay(SpectatorRelay&&) = delete;
+    SpectatorRelay& operator = (const SpectatorRelay&) = delete;
+    SpectatorRelay& operator = (SpectatorRelay&&) = delete;
+
+    bool start(std::uint16_t port, std::size_t maxSpectators = MaxSpectators);
+    void stop();
+    bool running() const { return m_running; }
+
+    //adds a packet to the current frame
+    template <typename T>
+    void publish(std::uint8_t id, const T& data)
+    {
+        publish(id, &data, sizeof(T));
+    }
+    void publish(std::uint8_t id, const void* data, std::size_t size);
+
+    //as publish() but also stores the packet to be sent to spectators
+    //when they join. Keyframes with the same id and key replace each other,
+    //and joining spectators receive them in the order they were last set
+    template <typename T>
+    void setKeyframe(std::uint8_t id, std::uint16_t key, const T& data)
+    {
+        setKeyframe(id, key, &data, sizeof(T));
+    }
+    void setKeyframe(std::uint8_t id, std::uint16_t key, const void* data, std::size_t size);
+    void removeKeyframe(std::uint8_t id, std::uint16_t key);
+
+    //removes all keyframes with the given id
+    void clearKeyframes(std::uint8_t id);
+
+    //hands anything published since the last call to the relay thread.
+    //call this once per network tick
+    void endTick();
+
+    std::size_t getSpectatorCount() const { return m_spectatorCount; }
+
+private:
+    std::atomic_bool m_running;
+    std::unique_ptr<std::thread> m_thread;
+    cro::NetHost m_host;
+
+    std::atomic<std::size_t> m_spectatorCount;
+
+    //only accessed by the server thread
+    std::vector<std::uint8_t> m_pendingFrame;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::vector<std::uint8_t> m_outgoingFrame;
+
+    struct Keyframe final
+    {
+        std::uint64_t timestamp = 0; //keyframes are sent in the order they were set
+        std::vector<std::uint8_t> data;
+    };
+    std::map<std::uint32_t, Keyframe> m_keyframes; //keyed by packet ID and key, so they can be cleared by ID
+    std::uint64_t m_keyframeTimestamp;
+
+    void threadFunc();
+};
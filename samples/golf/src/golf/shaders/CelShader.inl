@@ -30,6 +30,75 @@ source distribution.
 #pragma once
 
 #include <string>
+#include <cstdint>
+#include <utility>
+
+//feature bits of the cel shader family. Each variant is made
+//from a combination of these, rather than hand written defines
+struct CelFeature final
+{
+    enum
+    {
+        VertexColoured = 0x1,
+        Textured       = 0x2,
+        Dithered       = 0x4,
+        Skinned        = 0x8,
+        Subrect        = 0x10,
+        MaskMap        = 0x20,
+        WindWarp       = 0x40,
+        TerrainClip    = 0x80,
+        BallColour     = 0x100,
+        Reflections    = 0x200,
+        UserColour     = 0x400,
+        Terrain        = 0x800,
+        HoleHeight     = 0x1000,
+        RxShadows      = 0x2000,
+        Contour        = 0x4000,
+        Instancing     = 0x8000,
+        Vats           = 0x10000,
+        ArrayMapping   = 0x20000,
+
+        //these aren't converted by getCelDefines() - they mark
+        //variants which take the user's quality/game mode settings
+        QualitySettings = 0x40000000,
+        TargetSettings  = 0x80000000
+    };
+};
+
+static inline std::string getCelDefines(std::uint32_t features)
+{
+    static constexpr std::pair<std::uint32_t, const char*> Defines[] =
+    {
+        std::make_pair(CelFeature::VertexColoured, "#define VERTEX_COLOURED\n"),
+        std::make_pair(CelFeature::Textured, "#define TEXTURED\n"),
+        std::make_pair(CelFeature::Dithered, "#define DITHERED\n"),
+        std::make_pair(CelFeature::Skinned, "#define SKINNED\n"),
+        std::make_pair(CelFeature::Subrect, "#define SUBRECT\n"),
+        std::make_pair(CelFeature::MaskMap, "#define MASK_MAP\n"),
+        std::make_pair(CelFeature::WindWarp, "#define WIND_WARP\n"),
+        std::make_pair(CelFeature::TerrainClip, "#define TERRAIN_CLIP\n"),
+        std::make_pair(CelFeature::BallColour, "#define BALL_COLOUR\n"),
+        std::make_pair(CelFeature::Reflections, "#define REFLECTIONS\n"),
+        std::make_pair(CelFeature::UserColour, "#define USER_COLOUR\n"),
+        std::make_pair(CelFeature::Terrain, "#define TERRAIN\n#define COMP_SHADE\n#define COLOUR_LEVELS 5.0\n"),
+        std::make_pair(CelFeature::HoleHeight, "#define HOLE_HEIGHT\n"),
+        std::make_pair(CelFeature::RxShadows, "#define RX_SHADOWS\n"),
+        std::make_pair(CelFeature::Contour, "#define CONTOUR\n"),
+        std::make_pair(CelFeature::Instancing, "#define INSTANCING\n"),
+        std::make_pair(CelFeature::Vats, "#define VATS\n"),
+        std::make_pair(CelFeature::ArrayMapping, "#define ARRAY_MAPPING\n"),
+    };
+
+    std::string retVal;
+    for (const auto& [flag, define] : Defines)
+    {
+        if (features & flag)
+        {
+            retVal += define;
+        }
+    }
+    return retVal;
+}
 
 static inline const std::string CelVertexShader = R"(
     ATTRIBUTE vec4 a_position;
@@ -40,6 +109,7 @@ static inline const std::string CelVertexShader = R"(
 #endif
 #if defined (VATS)
     ATTRIBUTE vec2 a_texCoord1;
+    ATTRIBUTE vec4 a_instanceData;
 #endif
 
 #if defined(INSTANCING)
@@ -59,9 +129,7 @@ static inline const std::string CelVertexShader = R"(
     uniform sampler2D u_vatsPosition;
     uniform sampler2D u_vatsNormal;
 #endif
-    uniform float u_time;
-    uniform float u_maxTime;
-    uniform float u_offsetMultiplier;
+    uniform vec2 u_vatTime;
 #endif
 
 #if defined(RX_SHADOWS)
@@ -150,8 +218,7 @@ v_instanceID = gl_InstanceID;
     #if defined (VATS)
         vec2 texCoord = a_texCoord1;
         float scale = texCoord.y;
-        float instanceOffset = mod(gl_InstanceID, MAX_INSTANCE) * u_offsetMultiplier;
-        texCoord.y = mod((0.15 * instanceOffset)+ u_time, u_maxTime);
+        texCoord.y = getVatFrame(a_instanceData, u_vatTime, u_windData.w);
 
     #if defined (ARRAY_MAPPING)
         vec4 position = vec4(decodeVector(u_arrayMap, vec3(texCoord, 1.0)) * scale, 1.0);
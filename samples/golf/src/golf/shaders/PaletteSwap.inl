@@ -75,4 +75,37 @@ void main()
     vec2 paletteCoord = vec2(index / 64.0, 64.0 - mod(index, 64.0));
 
     FRAG_OUT = TEXTURE(u_palette, floor(paletteCoord) / vec2(64.0)) * v_colour;
-})";
\ No newline at end of file
+})";
+//recolours avatar textures by looking up each keyed texel in a small
+//palette. The index map stores the colour key + 1, or 0 for unkeyed texels.
+//Drawn as a single full screen triangle so texels map 1:1 to the target.
+static inline const std::string AvatarRecolourVertex =
+R"(
+void main()
+{
+    vec2 position = vec2(float((gl_VertexID & 1) << 2), float((gl_VertexID & 2) << 1)) - 1.0;
+    gl_Position = vec4(position, 0.0, 1.0);
+})";
+
+static inline const std::string AvatarRecolourFragment =
+R"(
+OUTPUT
+
+uniform sampler2D u_baseMap;
+uniform sampler2D u_indexMap;
+uniform vec4 u_palette[KEY_COUNT];
+
+void main()
+{
+    ivec2 coord = ivec2(gl_FragCoord.xy);
+    vec4 colour = texelFetch(u_baseMap, coord, 0);
+
+    int index = int(texelFetch(u_indexMap, coord, 0).r * 255.0 + 0.5) - 1;
+    if (index > -1
+        && u_palette[index].a > -1.0)
+    {
+        colour = u_palette[index];
+    }
+
+    FRAG_OUT = colour;
+})";
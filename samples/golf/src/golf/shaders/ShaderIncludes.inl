@@ -231,6 +231,23 @@ static inline const std::string VATVector = R"(
 
             return vec;
         }
+
+        //returns the normalised VAT frame position from per-instance data
+        //data: x state start time, y start offset, z one shot duration, w desync offset
+        //timing: x normalised loop length, y 1 / total animation time
+        float getVatFrame(vec4 data, vec2 timing, float elapsedTime)
+        {
+            float stateTime = max(elapsedTime - data.x, 0.0);
+            if (stateTime < data.z)
+            {
+                return mod((data.y + stateTime) * timing.y, 1.0);
+            }
+
+            //back in the idle loop, so slowly desync instances
+            stateTime -= data.z;
+            float offset = data.w * min(1.0, stateTime);
+            return mod((stateTime * timing.y) + offset, timing.x);
+        }
 )";
 
 /*
@@ -43,6 +43,7 @@ static inline const std::string ShadowVertex = R"(
     #endif
     #if defined (VATS)
         ATTRIBUTE vec2 a_texCoord1;
+        ATTRIBUTE vec4 a_instanceData;
     #endif
 
     #if defined(INSTANCING)
@@ -65,15 +66,15 @@ static inline const std::string ShadowVertex = R"(
         uniform vec4 u_clipPlane;
 
     #if defined (VATS)
-        #define MAX_INSTANCE 3
     #if defined (ARRAY_MAPPING)
         uniform sampler2DArray u_arrayMap;
     #else
         uniform sampler2D u_vatsPosition;
     #endif
-        uniform float u_time;
-        uniform float u_maxTime;
-        uniform float u_offsetMultiplier;
+        uniform vec2 u_vatTime;
+    #if !defined(WIND_WARP) && !defined(TREE_WARP) && !defined(LEAF_SIZE)
+    #include WIND_BUFFER
+    #endif
     #endif
 
     #if defined(WIND_WARP) || defined(TREE_WARP) || defined(LEAF_SIZE)
@@ -122,8 +123,7 @@ static inline const std::string ShadowVertex = R"(
         #if defined (VATS)
             vec2 texCoord = a_texCoord1;
             float scale = texCoord.y;
-            float instanceOffset = mod(gl_InstanceID, MAX_INSTANCE) * u_offsetMultiplier;
-            texCoord.y = mod(u_time + (0.15 * instanceOffset), u_maxTime);
+            texCoord.y = getVatFrame(a_instanceData, u_vatTime, u_windData.w);
 
         #if defined (ARRAY_MAPPING)
             vec4 position = vec4(decodeVector(u_arrayMap, vec3(texCoord, 1.0)) * scale, 1.0);
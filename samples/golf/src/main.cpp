@@ -33,26 +33,107 @@ source distribution.
 
 #include "GolfGame.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <string>
 
 
+namespace
+{
+    /*
+    Benchmark mode plays a fixed hole with a scripted list of shots for a
+    fixed number of simulation steps, rendering the scene at the given size,
+    then writes frame times and profiler results to JSON and quits. Usage:
+
+    golf --benchmark [--course course_01] [--hole 0] [--size 1280x720]
+        [--night] [--output path/to/file.json] [--software] [--headless]
+
+    --software forces Mesa's llvmpipe renderer, and --headless uses SDL's
+    offscreen video driver (if SDL was built with it) so that no display
+    is required. Otherwise run headless systems with xvfb-run.
+    */
+    void parseBenchmarkArgs(int argc, char** argsv, SharedStateData::BenchmarkSettings& settings)
+    {
+        for (auto i = 1; i < argc; ++i)
+        {
+            const std::string arg(argsv[i]);
+            const bool hasValue = i + 1 < argc;
+
+            if (arg == "--benchmark")
+            {
+                settings.enabled = true;
+            }
+            else if (arg == "--course" && hasValue)
+            {
+                settings.course = argsv[++i];
+            }
+            else if (arg == "--hole" && hasValue)
+            {
+                try
+                {
+                    settings.hole = std::max(0, std::stoi(argsv[++i]));
+                }
+                catch (...) {}
+            }
+            else if (arg == "--size" && hasValue)
+            {
+                const std::string size(argsv[++i]);
+                try
+                {
+                    auto pos = size.find('x');
+                    if (pos != std::string::npos)
+                    {
+                        settings.resolution.x = std::max(320, std::stoi(size.substr(0, pos)));
+                        settings.resolution.y = std::max(240, std::stoi(size.substr(pos + 1)));
+                    }
+                }
+                catch (...) {}
+            }
+            else if (arg == "--output" && hasValue)
+            {
+                settings.outputPath = argsv[++i];
+            }
+            else if (arg == "--night")
+            {
+                settings.nightTime = true;
+            }
+            else if (arg == "--software")
+            {
+                //must be set before SDL creates the GL context
+                SDL_setenv("LIBGL_ALWAYS_SOFTWARE", "1", 1);
+                SDL_setenv("GALLIUM_DRIVER", "llvmpipe", 1);
+            }
+            else if (arg == "--headless")
+            {
+                SDL_setenv("SDL_VIDEODRIVER", "offscreen", 1);
+            }
+        }
+    }
+}
+
 int main(int argc, char** argsv)
 {
     bool safeMode = false;
+    SharedStateData::BenchmarkSettings benchmark;
 
-    GolfGame game;
     if (argc > 1)
     {
         std::string str(argsv[1]);
         safeMode = (str == "safe_mode");
 
+        //this has to happen before the game is created
+        //as some options set the environment used by SDL
+        parseBenchmarkArgs(argc, argsv, benchmark);
+
 #ifdef _WIN32
         AllocConsole();
 #endif
 
     }
 
+    GolfGame game;
     game.setSafeModeEnabled(safeMode);
+    game.setBenchmarkSettings(benchmark);
     game.run(safeMode);
 
     WebSock::stop();
@@ -0,0 +1,227 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+Super Video Golf - zlib licence.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include "AsyncProfileDB.hpp"
+
+#include <crogine/core/Log.hpp>
+#include <crogine/core/Profiler.hpp>
+
+namespace
+{
+    //an open DB is closed after this long without any queued work
+    constexpr std::chrono::seconds IdleTimeout(10);
+}
+
+AsyncProfileDB::AsyncProfileDB()
+    : m_busy    (false),
+    m_running   (true)
+{
+    m_thread = std::thread(&AsyncProfileDB::threadFunc, this);
+}
+
+AsyncProfileDB::~AsyncProfileDB()
+{
+    {
+        std::scoped_lock lock(m_mutex);
+        m_running = false;
+    }
+    m_workCondition.notify_one();
+    m_thread.join();
+}
+
+//public
+void AsyncProfileDB::insertCourseRecord(const std::string& path, const CourseRecord& record)
+{
+    addTask({ path, [record](ProfileDB& db, bool open)
+        {
+            if (open)
+            {
+                db.insertCourseRecord(record);
+            }
+        } });
+}
+
+void AsyncProfileDB::insertPersonalBestRecord(const std::string& path, const PersonalBestRecord& record)
+{
+    addTask({ path, [record](ProfileDB& db, bool open)
+        {
+            if (open)
+            {
+                db.insertPersonalBestRecord(record);
+            }
+        } });
+}
+
+std::future<std::vector<CourseRecord>> AsyncProfileDB::getCourseRecords(const std::string& path, std::int32_t courseIndex, std::uint64_t oldestTimestamp, bool cpu)
+{
+    //std::function must be copyable, so the promise is shared
+    auto promise = std::make_shared<std::promise<std::vector<CourseRecord>>>();
+    auto result = promise->get_future();
+
+    addTask({ path, [promise, courseIndex, oldestTimestamp, cpu](ProfileDB& db, bool open)
+        {
+            promise->set_value(open ? db.getCourseRecords(courseIndex, oldestTimestamp, cpu) : std::vector<CourseRecord>());
+        } });
+
+    return result;
+}
+
+std::future<std::vector<PersonalBestRecord>> AsyncProfileDB::getPersonalBest(const std::string& path, std::int32_t courseIndex)
+{
+    auto promise = std::make_shared<std::promise<std::vector<PersonalBestRecord>>>();
+    auto result = promise->get_future();
+
+    addTask({ path, [promise, courseIndex](ProfileDB& db, bool open)
+        {
+            promise->set_value(open ? db.getPersonalBest(courseIndex) : std::vector<PersonalBestRecord>());
+        } });
+
+    return result;
+}
+
+void AsyncProfileDB::close()
+{
+    //an empty path closes the current DB
+    addTask({ std::string(), nullptr });
+    flush();
+}
+
+void AsyncProfileDB::flush()
+{
+    std::unique_lock lock(m_mutex);
+    m_doneCondition.wait(lock, [&]() { return m_tasks.empty() && !m_busy; });
+}
+
+//private
+void AsyncProfileDB::addTask(Task&& task)
+{
+    {
+        std::scoped_lock lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+    m_workCondition.notify_one();
+}
+
+void AsyncProfileDB::threadFunc()
+{
+    cro::Profiler::setThreadName("Profile DB");
+
+    ProfileDB db;
+    bool open = false;
+    std::deque<Task> tasks;
+
+    while (true)
+    {
+        bool idle = false;
+        {
+            std::unique_lock lock(m_mutex);
+            const auto hasWork = [&]() { return !m_running || !m_tasks.empty(); };
+
+            if (open)
+            {
+                idle = !m_workCondition.wait_for(lock, IdleTimeout, hasWork);
+            }
+            else
+            {
+                m_workCondition.wait(lock, hasWork);
+            }
+
+            if (!idle)
+            {
+                //outstanding work is still completed when quitting
+                if (m_tasks.empty())
+                {
+                    db.close();
+                    return;
+                }
+
+                tasks.swap(m_tasks);
+                m_busy = true;
+            }
+        }
+
+        if (idle)
+        {
+            //nothing has been queued for a while so close the DB,
+            //which moves the contents of the WAL back into the DB file
+            db.close();
+            open = false;
+            continue;
+        }
+
+        //everything queued together is done in a single transaction
+        //per DB, rather than syncing to disk after each insert
+        if (open)
+        {
+            db.beginTransaction();
+        }
+
+        for (auto& task : tasks)
+        {
+            if (task.path.empty())
+            {
+                db.close();
+                open = false;
+                continue;
+            }
+
+            if (task.path != db.getPath()
+                || !open)
+            {
+                //closing commits any outstanding transaction
+                db.close();
+                open = db.open(task.path);
+
+                if (open)
+                {
+                    db.beginTransaction();
+                }
+                else
+                {
+                    LogE << "Failed opening profile DB " << task.path << std::endl;
+                }
+            }
+            task.action(db, open);
+        }
+        tasks.clear();
+
+        //the connection and its prepared statements are
+        //kept for the next batch, which is usually the same DB
+        if (open)
+        {
+            db.commitTransaction();
+        }
+
+        {
+            std::scoped_lock lock(m_mutex);
+            m_busy = false;
+        }
+        m_doneCondition.notify_all();
+    }
+}
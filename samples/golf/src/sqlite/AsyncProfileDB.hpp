@@ -0,0 +1,96 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+Super Video Golf - zlib licence.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include "ProfileDB.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/*
+Performs ProfileDB reads and writes on a background thread so that
+neither recording a round nor browsing stats stalls a frame. Writes
+queued together are committed in a single transaction. The current
+DB stays open between batches, and is only closed when a different
+path is requested, after a period of idling, or on shutdown - closing
+is what checkpoints the WAL back into the DB file.
+Queries are run after any writes which were queued before them, so
+they always see the most recent data.
+*/
+class AsyncProfileDB final
+{
+public:
+    AsyncProfileDB();
+    ~AsyncProfileDB(); //completes any outstanding work
+
+    AsyncProfileDB(const AsyncProfileDB&) = delete;
+    AsyncProfileDB(AsyncProfileDB&&) = delete;
+    AsyncProfileDB& operator = (const AsyncProfileDB&) = delete;
+    AsyncProfileDB& operator = (AsyncProfileDB&&) = delete;
+
+    //queues the record to be inserted in the DB at the given path
+    void insertCourseRecord(const std::string& path, const CourseRecord&);
+    void insertPersonalBestRecord(const std::string& path, const PersonalBestRecord&);
+
+    //results are empty if the DB at the given path could not be opened
+    std::future<std::vector<CourseRecord>> getCourseRecords(const std::string& path, std::int32_t courseIndex, std::uint64_t oldestTimestamp = 0, bool cpu = true);
+    std::future<std::vector<PersonalBestRecord>> getPersonalBest(const std::string& path, std::int32_t courseIndex);
+
+    //completes all queued work then closes the current DB, eg
+    //before deleting a profile directory. Blocks until done.
+    void close();
+
+    //blocks until all queued work has been completed
+    void flush();
+
+private:
+    struct Task final
+    {
+        std::string path;
+        std::function<void(ProfileDB&, bool)> action; //bool is true if DB is open
+    };
+    std::deque<Task> m_tasks;
+    bool m_busy;
+    bool m_running;
+
+    std::mutex m_mutex;
+    std::condition_variable m_workCondition;
+    std::condition_variable m_doneCondition;
+    std::thread m_thread;
+
+    void addTask(Task&&);
+    void threadFunc();
+};
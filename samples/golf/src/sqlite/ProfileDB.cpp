@@ -34,45 +34,48 @@ source distribution.
 #include <crogine/core/SysTime.hpp>
 #include <crogine/detail/Assert.hpp>
 
+#include <algorithm>
+
 namespace
 {
     constexpr std::int32_t MinCourse = 0;
     constexpr std::int32_t MaxCourse = 11;
+
+    //returns the statement to its initial state ready to be reused
+    void resetStatement(sqlite3_stmt* stmt)
+    {
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
+    }
 }
 
 ProfileDB::ProfileDB()
-    : m_connection(nullptr)
+    : m_connection  (nullptr),
+    m_inTransaction (false)
 {
     for (auto& v : m_courseRecordCounts)
     {
         v.resize(MaxCourse + 1);
         std::fill(v.begin(), v.end(), 0);
     }
+
+    m_insertCourseStatements.resize(MaxCourse + 1);
+    for (auto& v : m_selectCourseStatements)
+    {
+        v.resize(MaxCourse + 1);
+    }
 }
 
 ProfileDB::~ProfileDB()
 {
     //close any open connection
-    if (m_connection)
-    {
-        //TODO we should also finalise pending
-        //queries - must check how we know if there
-        //are any outstanding or if it's just ok
-        //to call finalise regardless.
-
-        sqlite3_close(m_connection);
-    }
+    close();
 }
 
 //public
 bool ProfileDB::open(const std::string& path)
 {
-    if (m_connection)
-    {
-        //TODO finalise any pending actions
-        sqlite3_close(m_connection);
-        m_connection = nullptr;
-    }
+    close();
 
     auto result = sqlite3_open(path.c_str(), &m_connection);
     if (result != SQLITE_OK)
@@ -83,18 +86,68 @@ bool ProfileDB::open(const std::string& path)
 
         return false;
     }
+    m_path = path;
+
+    //write-ahead logging means readers aren't blocked by
+    //writes, and commits don't wait on a full sync
+    execute("PRAGMA journal_mode=WAL");
+    execute("PRAGMA synchronous=NORMAL");
 
     //if the layout is not yet created, do so
+    beginTransaction();
     for (auto i = 0; i <= MaxCourse; ++i)
     {
         createCourseTable(i);
         fetchRecordCount(i);
     }
     createPersonalBestTable();
+    commitTransaction();
 
     return true;
 }
 
+void ProfileDB::close()
+{
+    if (m_connection)
+    {
+        if (m_inTransaction)
+        {
+            commitTransaction();
+        }
+
+        //statements must be finalised else the connection remains open
+        finaliseStatements();
+
+        sqlite3_close(m_connection);
+        m_connection = nullptr;
+        m_path.clear();
+    }
+}
+
+bool ProfileDB::beginTransaction()
+{
+    if (m_connection == nullptr
+        || m_inTransaction)
+    {
+        return false;
+    }
+
+    m_inTransaction = execute("BEGIN TRANSACTION");
+    return m_inTransaction;
+}
+
+bool ProfileDB::commitTransaction()
+{
+    if (m_connection == nullptr
+        || !m_inTransaction)
+    {
+        return false;
+    }
+
+    m_inTransaction = false;
+    return execute("COMMIT TRANSACTION");
+}
+
 bool ProfileDB::insertCourseRecord(const CourseRecord& record)
 {
     //CRO_ASSERT(record.courseIndex >= MinCourse && record.courseIndex <= MaxCourse, "");
@@ -110,32 +163,36 @@ bool ProfileDB::insertCourseRecord(const CourseRecord& record)
         return false;
     }
 
-    auto ts = std::to_string(cro::SysTime::epoch());
-    std::string holeVals;
+    const std::string query = "INSERT INTO " + CourseNames[record.courseIndex]
+        + "(H1,H2,H3,H4,H5,H6,H7,H8,H9,H10,H11,H12,H13,H14,H15,H16,H17,H18,Total,TotalPar,Count,Date,WasCPU)"
+        + "VALUES(?1,?2,?3,?4,?5,?6,?7,?8,?9,?10,?11,?12,?13,?14,?15,?16,?17,?18,?19,?20,?21,?22,?23)";
+
+    auto* stmt = getStatement(m_insertCourseStatements[record.courseIndex], query);
+    if (!stmt)
+    {
+        return false;
+    }
+
+    auto i = 1;
     for (auto h : record.holeScores)
     {
-        holeVals += std::to_string(h) + ",";
+        sqlite3_bind_int(stmt, i++, h);
     }
+    sqlite3_bind_int(stmt, i++, record.total);
+    sqlite3_bind_int(stmt, i++, record.totalPar);
+    sqlite3_bind_int(stmt, i++, record.holeCount);
+    sqlite3_bind_int64(stmt, i++, static_cast<sqlite3_int64>(cro::SysTime::epoch()));
+    sqlite3_bind_int(stmt, i++, record.wasCPU);
 
-    std::string query = "INSERT INTO " + CourseNames[record.courseIndex]
-        + "(H1,H2,H3,H4,H5,H6,H7,H8,H9,H10,H11,H12,H13,H14,H15,H16,H17,H18,Total,TotalPar,Count,Date,WasCPU)"
-        + "VALUES("
-        + holeVals + std::to_string(record.total) + "," + std::to_string(record.totalPar) + ","
-        + std::to_string(record.holeCount) + "," + ts + "," + std::to_string(record.wasCPU)
-        + ")";
+    const auto result = sqlite3_step(stmt);
+    resetStatement(stmt);
 
-    sqlite3_stmt* out = nullptr;
-    int result = sqlite3_prepare_v2(m_connection, query.c_str(), -1, &out, nullptr);
-    if (result != SQLITE_OK)
+    if (result != SQLITE_DONE)
     {
         LogE << sqlite3_errmsg(m_connection) << std::endl;
-        sqlite3_finalize(out);
         return false;
     }
 
-    sqlite3_step(out);
-    sqlite3_finalize(out);
-
     m_courseRecordCounts[record.holeCount][record.courseIndex]++;
 
     return true;
@@ -157,30 +214,28 @@ std::vector<CourseRecord> ProfileDB::getCourseRecords(std::int32_t courseIndex,
     }
 
     std::vector<CourseRecord> retVal;
-    std::string oldestRecord = std::to_string(oldestTimeStamp);
 
     std::string query;
     if (getCPU)
     {
-        query = "SELECT * FROM " + CourseNames[courseIndex] + " WHERE Date >= " + oldestRecord + " ORDER BY Date DESC";
+        query = "SELECT * FROM " + CourseNames[courseIndex] + " WHERE Date >= ?1 ORDER BY Date DESC";
     }
     else
     {
-        query = "SELECT * FROM " + CourseNames[courseIndex] + " WHERE Date >= " + oldestRecord + " AND wasCPU = 0 ORDER BY Date DESC";
+        query = "SELECT * FROM " + CourseNames[courseIndex] + " WHERE Date >= ?1 AND wasCPU = 0 ORDER BY Date DESC";
     }
-    sqlite3_stmt* out = nullptr;
-    int result = sqlite3_prepare_v2(m_connection, query.c_str(), -1, &out, nullptr);
-    if (result != SQLITE_OK)
+
+    auto* stmt = getStatement(m_selectCourseStatements[getCPU ? 1 : 0][courseIndex], query);
+    if (!stmt)
     {
-        LogE << sqlite3_errmsg(m_connection) << std::endl;
-        sqlite3_finalize(out);
         return retVal;
     }
+    sqlite3_bind_int64(stmt, 1, static_cast<sqlite3_int64>(oldestTimeStamp));
 
-
+    int result = SQLITE_OK;
     do
     {
-        result = sqlite3_step(out);
+        result = sqlite3_step(stmt);
         
         if (result == SQLITE_ROW)
         {
@@ -188,18 +243,18 @@ std::vector<CourseRecord> ProfileDB::getCourseRecords(std::int32_t courseIndex,
             
             for (auto i = 0; i < 18; ++i)
             {
-                record.holeScores[i] = sqlite3_column_int(out, i);
+                record.holeScores[i] = sqlite3_column_int(stmt, i);
             }
-            record.total = sqlite3_column_int(out, 18);
-            record.totalPar = sqlite3_column_int(out, 19);
-            record.holeCount = sqlite3_column_int(out, 20);
-            record.timestamp = sqlite3_column_int64(out, 21);
-            record.wasCPU = sqlite3_column_int(out, 22);
+            record.total = sqlite3_column_int(stmt, 18);
+            record.totalPar = sqlite3_column_int(stmt, 19);
+            record.holeCount = sqlite3_column_int(stmt, 20);
+            record.timestamp = sqlite3_column_int64(stmt, 21);
+            record.wasCPU = sqlite3_column_int(stmt, 22);
         }
 
     } while (result == SQLITE_ROW && recordCount-- != 0);
 
-    sqlite3_finalize(out);
+    resetStatement(stmt);
 
     return retVal;
 }
@@ -225,27 +280,23 @@ bool ProfileDB::insertPersonalBestRecord(const PersonalBestRecord& record)
         return false;
     }
 
-    auto newRecord = record;
-    std::string query = "SELECT * FROM PERSONAL_BEST WHERE Hole = " 
-        + std::to_string(record.hole) 
-        + " AND Course = " + std::to_string(record.course)
-        + " AND PuttAssist = " + std::to_string(record.wasPuttAssist);
-
-    sqlite3_stmt* out = nullptr;
-    int result = sqlite3_prepare_v2(m_connection, query.c_str(), -1, &out, nullptr);
-    if (result != SQLITE_OK)
+    auto* stmt = getStatement(m_statements[StatementID::SelectBest], 
+        "SELECT * FROM PERSONAL_BEST WHERE Hole = ?1 AND Course = ?2 AND PuttAssist = ?3");
+    if (!stmt)
     {
-        LogE << sqlite3_errmsg(m_connection) << std::endl;
-        sqlite3_finalize(out);
         return false;
     }
+    sqlite3_bind_int(stmt, 1, record.hole);
+    sqlite3_bind_int(stmt, 2, record.course);
+    sqlite3_bind_int(stmt, 3, record.wasPuttAssist);
 
-
-    if (result = sqlite3_step(out); result == SQLITE_ROW)
+    auto newRecord = record;
+    if (auto result = sqlite3_step(stmt); result == SQLITE_ROW)
     {
-        newRecord.longestDrive = static_cast<float>(sqlite3_column_double(out, 2));
-        newRecord.longestPutt = static_cast<float>(sqlite3_column_double(out, 3));
-        newRecord.score = sqlite3_column_int(out, 4);
+        newRecord.longestDrive = static_cast<float>(sqlite3_column_double(stmt, 2));
+        newRecord.longestPutt = static_cast<float>(sqlite3_column_double(stmt, 3));
+        newRecord.score = sqlite3_column_int(stmt, 4);
+        resetStatement(stmt);
 
         bool updated = false;
         if (newRecord.longestDrive < record.longestDrive)
@@ -264,60 +315,64 @@ bool ProfileDB::insertPersonalBestRecord(const PersonalBestRecord& record)
             updated = true;
         }
 
-        sqlite3_finalize(out);
-        out = nullptr;
-
         if (updated)
         {
             //update entry
-            query = "UPDATE PERSONAL_BEST SET LongestDrive = " + std::to_string(newRecord.longestDrive)
-                + ", LongestPutt = " + std::to_string(newRecord.longestPutt)
-                + ", Score = " + std::to_string(newRecord.score)
-                + " WHERE Hole = " + std::to_string(record.hole) 
-                + " AND Course = " + std::to_string(record.course)
-                + " AND PuttAssist = " + std::to_string(record.wasPuttAssist);
-
-            result = sqlite3_prepare_v2(m_connection, query.c_str(), -1, &out, nullptr);
-            if (result != SQLITE_OK)
+            stmt = getStatement(m_statements[StatementID::UpdateBest],
+                "UPDATE PERSONAL_BEST SET LongestDrive = ?1, LongestPutt = ?2, Score = ?3 WHERE Hole = ?4 AND Course = ?5 AND PuttAssist = ?6");
+            if (!stmt)
+            {
+                return false;
+            }
+            sqlite3_bind_double(stmt, 1, newRecord.longestDrive);
+            sqlite3_bind_double(stmt, 2, newRecord.longestPutt);
+            sqlite3_bind_int(stmt, 3, newRecord.score);
+            sqlite3_bind_int(stmt, 4, record.hole);
+            sqlite3_bind_int(stmt, 5, record.course);
+            sqlite3_bind_int(stmt, 6, record.wasPuttAssist);
+
+            result = sqlite3_step(stmt);
+            resetStatement(stmt);
+
+            if (result != SQLITE_DONE)
             {
                 LogE << sqlite3_errmsg(m_connection) << std::endl;
-                sqlite3_finalize(out);
                 return false;
             }
-            sqlite3_step(out);
-            sqlite3_finalize(out);
         }
     }
     else
     {
         //insert entry
-        sqlite3_finalize(out);
-        out = nullptr;
+        resetStatement(stmt);
 
-        query = "INSERT INTO PERSONAL_BEST (Hole, Course, LongestDrive, LongestPutt, Score, PuttAssist) VALUES ("
-            + std::to_string(record.hole) + ", "
-            + std::to_string(record.course) + ", "
-            + std::to_string(record.longestDrive) + ", "
-            + std::to_string(record.longestPutt) + ", "
-            + std::to_string(record.score) + ", "
-            + std::to_string(record.wasPuttAssist) + ")";
+        stmt = getStatement(m_statements[StatementID::InsertBest],
+            "INSERT INTO PERSONAL_BEST (Hole, Course, LongestDrive, LongestPutt, Score, PuttAssist) VALUES (?1, ?2, ?3, ?4, ?5, ?6)");
+        if (!stmt)
+        {
+            return false;
+        }
+        sqlite3_bind_int(stmt, 1, record.hole);
+        sqlite3_bind_int(stmt, 2, record.course);
+        sqlite3_bind_double(stmt, 3, record.longestDrive);
+        sqlite3_bind_double(stmt, 4, record.longestPutt);
+        sqlite3_bind_int(stmt, 5, record.score);
+        sqlite3_bind_int(stmt, 6, record.wasPuttAssist);
 
+        result = sqlite3_step(stmt);
+        resetStatement(stmt);
 
-        result = sqlite3_prepare_v2(m_connection, query.c_str(), -1, &out, nullptr);
-        if (result != SQLITE_OK)
+        if (result != SQLITE_DONE)
         {
             LogE << sqlite3_errmsg(m_connection) << std::endl;
-            sqlite3_finalize(out);
             return false;
         }
-        sqlite3_step(out);
-        sqlite3_finalize(out);
     }
 
     return true;
 }
 
-std::vector<PersonalBestRecord> ProfileDB::getPersonalBest(std::int32_t courseIndex) const
+std::vector<PersonalBestRecord> ProfileDB::getPersonalBest(std::int32_t courseIndex)
 {
     CRO_ASSERT(courseIndex >= MinCourse && courseIndex <= MaxCourse, "");
     if (courseIndex < MinCourse || courseIndex > MaxCourse)
@@ -333,107 +388,117 @@ std::vector<PersonalBestRecord> ProfileDB::getPersonalBest(std::int32_t courseIn
     }
 
     std::vector<PersonalBestRecord> retVal;
-    std::string query = "SELECT * FROM PERSONAL_BEST WHERE Course = " + std::to_string(courseIndex) + " ORDER BY Hole";
 
-    sqlite3_stmt* out = nullptr;
-    int result = sqlite3_prepare_v2(m_connection, query.c_str(), -1, &out, nullptr);
-    if (result != SQLITE_OK)
+    auto* stmt = getStatement(m_statements[StatementID::SelectCourseBest], "SELECT * FROM PERSONAL_BEST WHERE Course = ?1 ORDER BY Hole");
+    if (!stmt)
     {
-        LogE << sqlite3_errmsg(m_connection) << std::endl;
-        sqlite3_finalize(out);
         return retVal;
     }
+    sqlite3_bind_int(stmt, 1, courseIndex);
 
+    int result = SQLITE_OK;
     do
     {
-        result = sqlite3_step(out);
+        result = sqlite3_step(stmt);
 
         if (result == SQLITE_ROW)
         {
             auto& record = retVal.emplace_back();
 
-            record.hole = sqlite3_column_int(out, 0);
-            record.course = sqlite3_column_int(out, 1);
-            record.longestDrive = static_cast<float>(sqlite3_column_double(out, 2));
-            record.longestPutt = static_cast<float>(sqlite3_column_double(out, 3));
-            record.score = sqlite3_column_int(out, 4);
-            record.wasPuttAssist = sqlite3_column_int(out, 5);
+            record.hole = sqlite3_column_int(stmt, 0);
+            record.course = sqlite3_column_int(stmt, 1);
+            record.longestDrive = static_cast<float>(sqlite3_column_double(stmt, 2));
+            record.longestPutt = static_cast<float>(sqlite3_column_double(stmt, 3));
+            record.score = sqlite3_column_int(stmt, 4);
+            record.wasPuttAssist = sqlite3_column_int(stmt, 5);
         }
 
     } while (result == SQLITE_ROW);
 
-    sqlite3_finalize(out);
+    resetStatement(stmt);
 
     return retVal;
 }
 
 //private
-bool ProfileDB::createCourseTable(std::int32_t index)
+sqlite3_stmt* ProfileDB::getStatement(sqlite3_stmt*& dst, const std::string& query)
 {
-    /*
-    H1 INT - H18 INTEGER, Total INTEGER, TotalPar INTEGER, Count INTEGER, Date INTEGER WasCPU INTEGER
-    */
+    if (!dst)
+    {
+        if (sqlite3_prepare_v2(m_connection, query.c_str(), -1, &dst, nullptr) != SQLITE_OK)
+        {
+            LogE << sqlite3_errmsg(m_connection) << std::endl;
+            sqlite3_finalize(dst);
+            dst = nullptr;
+        }
+    }
+    return dst;
+}
 
-    std::string query = "CREATE TABLE IF NOT EXISTS " + CourseNames[index] 
-        + " (H1 INTEGER, H2 INTEGER, H3 INTEGER, H4 INTEGER, H5 INTEGER, H6 INTEGER, H7 INTEGER, H8 INTEGER, H9 INTEGER, "
-        + "H10 INTEGER, H11 INTEGER, H12 INTEGER, H13 INTEGER, H14 INTEGER, H15 INTEGER, H16 INTEGER, H17 INTEGER, H18 INTEGER, "
-        + "Total INTEGER, TotalPar INTEGER, Count INTEGER, Date INTEGER, WasCPU INTEGER)";
+void ProfileDB::finaliseStatements()
+{
+    auto finalise = [](sqlite3_stmt*& stmt)
+    {
+        //this is a no-op on nullptr
+        sqlite3_finalize(stmt);
+        stmt = nullptr;
+    };
+
+    std::for_each(m_statements.begin(), m_statements.end(), finalise);
+    std::for_each(m_insertCourseStatements.begin(), m_insertCourseStatements.end(), finalise);
+    for (auto& v : m_selectCourseStatements)
+    {
+        std::for_each(v.begin(), v.end(), finalise);
+    }
+}
 
-    sqlite3_stmt* out = nullptr;
-    int result = sqlite3_prepare_v2(m_connection, query.c_str(), -1, &out, nullptr);
-    if (result != SQLITE_OK)
+bool ProfileDB::execute(const std::string& query)
+{
+    char* error = nullptr;
+    if (sqlite3_exec(m_connection, query.c_str(), nullptr, nullptr, &error) != SQLITE_OK)
     {
-        LogE << sqlite3_errmsg(m_connection) << std::endl;
-        sqlite3_finalize(out);
+        LogE << "ProfileDB - " << query << ": " << (error ? error : "unknown error") << std::endl;
+        sqlite3_free(error);
         return false;
     }
+    return true;
+}
 
-    sqlite3_step(out);
-    sqlite3_finalize(out);
+bool ProfileDB::createCourseTable(std::int32_t index)
+{
+    /*
+    H1 INT - H18 INTEGER, Total INTEGER, TotalPar INTEGER, Count INTEGER, Date INTEGER WasCPU INTEGER
+    */
 
-    return true;
+    return execute("CREATE TABLE IF NOT EXISTS " + CourseNames[index] 
+        + " (H1 INTEGER, H2 INTEGER, H3 INTEGER, H4 INTEGER, H5 INTEGER, H6 INTEGER, H7 INTEGER, H8 INTEGER, H9 INTEGER, "
+        + "H10 INTEGER, H11 INTEGER, H12 INTEGER, H13 INTEGER, H14 INTEGER, H15 INTEGER, H16 INTEGER, H17 INTEGER, H18 INTEGER, "
+        + "Total INTEGER, TotalPar INTEGER, Count INTEGER, Date INTEGER, WasCPU INTEGER)");
 }
 
 void ProfileDB::createPersonalBestTable()
 {
-    std::string query = "CREATE TABLE IF NOT EXISTS PERSONAL_BEST (Hole INTEGER, Course INTEGER, LongestDrive REAL, LongestPutt REAL, Score INTEGER, PuttAssist INTEGER)";
+    execute("CREATE TABLE IF NOT EXISTS PERSONAL_BEST (Hole INTEGER, Course INTEGER, LongestDrive REAL, LongestPutt REAL, Score INTEGER, PuttAssist INTEGER)");
+}
 
-    sqlite3_stmt* out = nullptr;
-    int result = sqlite3_prepare_v2(m_connection, query.c_str(), -1, &out, nullptr);
-    if (result != SQLITE_OK)
+void ProfileDB::fetchRecordCount(std::int32_t courseIndex)
+{
+    CRO_ASSERT(courseIndex < MaxCourse + 1, "");
+
+    sqlite3_stmt* stmt = nullptr;
+    if (!getStatement(stmt, "SELECT COUNT(*) FROM " + CourseNames[courseIndex] + " WHERE Count = ?1"))
     {
-        LogE << sqlite3_errmsg(m_connection) << std::endl;
-        sqlite3_finalize(out);
         return;
     }
 
-    sqlite3_step(out);
-    sqlite3_finalize(out);
-}
-
-void ProfileDB::fetchRecordCount(std::int32_t courseIndex)
-{
     for (auto i = 0; i < 3; ++i)
     {
-        CRO_ASSERT(courseIndex < MaxCourse + 1, "");
-        std::string query = "SELECT COUNT(*) FROM " + CourseNames[courseIndex] + " WHERE Count = " + std::to_string(i);
-
-        sqlite3_stmt* out = nullptr;
-        int result = sqlite3_prepare_v2(m_connection, query.c_str(), -1, &out, nullptr);
-        if (result != SQLITE_OK)
+        sqlite3_bind_int(stmt, 1, i);
+        if (sqlite3_step(stmt) == SQLITE_ROW)
         {
-            LogE << sqlite3_errmsg(m_connection) << std::endl;
-            sqlite3_finalize(out);
-            continue;
+            m_courseRecordCounts[i][courseIndex] = sqlite3_column_int(stmt, 0);
         }
-
-        result = sqlite3_step(out);
-        if (result == SQLITE_ROW)
-        {
-            m_courseRecordCounts[i][courseIndex] = sqlite3_column_int(out, 0);
-        }
-
-
-        sqlite3_finalize(out);
+        resetStatement(stmt);
     }
-}
\ No newline at end of file
+    sqlite3_finalize(stmt);
+}
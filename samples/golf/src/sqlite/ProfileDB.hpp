@@ -72,6 +72,18 @@ public:
     //opens the DB at the given path, returns false on failure
     bool open(const std::string& path);
 
+    //closes the DB if it is open
+    void close();
+
+    //returns the path of the currently open DB, or an empty string
+    const std::string& getPath() const { return m_path; }
+
+    //wraps any subsequent inserts in a single transaction
+    //until commitTransaction() is called, rather than each
+    //insert being committed (and synced to disk) individually
+    bool beginTransaction();
+    bool commitTransaction();
+
     //attempts to insert the record into the db
     //creates a table for the hole ID if it doesn't exist
     //returns false if DB isn't open or creating record fails
@@ -86,11 +98,35 @@ public:
 
     bool insertPersonalBestRecord(const PersonalBestRecord&);
     //returns the personal bests for the given course, sorted by hole number
-    std::vector<PersonalBestRecord> getPersonalBest(std::int32_t courseIndex) const;
+    std::vector<PersonalBestRecord> getPersonalBest(std::int32_t courseIndex);
 
 private:
     sqlite3* m_connection;
+    std::string m_path;
+    bool m_inTransaction;
+
+    //statements are prepared once when first used and
+    //then reset and rebound with new values each time
+    struct StatementID final
+    {
+        enum
+        {
+            SelectBest,
+            UpdateBest,
+            InsertBest,
+            SelectCourseBest,
+
+            Count
+        };
+    };
+    std::array<sqlite3_stmt*, StatementID::Count> m_statements = {};
+    std::vector<sqlite3_stmt*> m_insertCourseStatements;
+    std::array<std::vector<sqlite3_stmt*>, 2u> m_selectCourseStatements; //without/with CPU
     
+    sqlite3_stmt* getStatement(sqlite3_stmt*& dst, const std::string& query);
+    void finaliseStatements();
+    bool execute(const std::string& query);
+
     std::array<std::vector<std::int32_t>, 3u> m_courseRecordCounts;
 
     //creates a new table for the given course ID if it doesn't exist
@@ -598,6 +598,19 @@ void MenuState::createScene()
                 }
             });
 
+    //clustered lights
+    textPos.y -= MenuSpacing;
+    entity = createButton("Clustered Lights", textPos);
+    entity.getComponent<cro::UIInput>().callbacks[cro::UIInput::ButtonUp] =
+        uiSystem->addCallback([&](cro::Entity e, const cro::ButtonEvent& evt)
+            {
+                if (activated(evt))
+                {
+                    requestStackClear();
+                    requestStackPush(States::ScratchPad::ClusteredLights);
+                }
+            });
+
     //Log rolling
     textPos.y -= MenuSpacing;
     entity = createButton("Log Roll", textPos);
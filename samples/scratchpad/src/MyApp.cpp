@@ -34,6 +34,7 @@ source distribution.
 #include "bounce/BounceState.hpp"
 #include "bush/BushState.hpp"
 #include "bsp/BspState.hpp"
+#include "clustered/ClusteredState.hpp"
 #include "collision/CollisionState.hpp"
 #include "frustum/FrustumState.hpp"
 #include "voxels/VoxelState.hpp"
@@ -198,6 +199,7 @@ bool MyApp::initialise()
     m_stateStack.registerState<SwingState>(States::ScratchPad::Swing);
     m_stateStack.registerState<AnimBlendState>(States::ScratchPad::AnimBlend);
     m_stateStack.registerState<SSAOState>(States::ScratchPad::SSAO);
+    m_stateStack.registerState<ClusteredState>(States::ScratchPad::ClusteredLights);
     m_stateStack.registerState<LogState>(States::ScratchPad::Log);
     m_stateStack.registerState<GCState>(States::ScratchPad::GC);
     m_stateStack.registerState<BounceState>(States::ScratchPad::Bounce);
@@ -43,6 +43,7 @@ namespace States
             Bounce,
             Bush,
             BSP,
+            ClusteredLights,
             Frustum,
             GC,
             InteriorMapping,
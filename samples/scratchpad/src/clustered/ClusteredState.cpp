@@ -0,0 +1,294 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine application - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#include "ClusteredState.hpp"
+
+#include <crogine/core/App.hpp>
+#include <crogine/gui/Gui.hpp>
+
+#include <crogine/ecs/components/Camera.hpp>
+#include <crogine/ecs/components/Transform.hpp>
+#include <crogine/ecs/components/Callback.hpp>
+#include <crogine/ecs/components/Model.hpp>
+#include <crogine/ecs/components/LightVolume.hpp>
+
+#include <crogine/ecs/systems/CameraSystem.hpp>
+#include <crogine/ecs/systems/CallbackSystem.hpp>
+#include <crogine/ecs/systems/LightVolumeSystem.hpp>
+#include <crogine/ecs/systems/ModelRenderer.hpp>
+
+#include <crogine/graphics/CubeBuilder.hpp>
+#include <crogine/graphics/SphereBuilder.hpp>
+#include <crogine/util/Constants.hpp>
+#include <crogine/util/Random.hpp>
+
+namespace
+{
+    const std::string LitVertex =
+        R"(
+        ATTRIBUTE vec4 a_position;
+        ATTRIBUTE vec3 a_normal;
+
+        #include CAMERA_UBO
+
+        uniform mat4 u_worldMatrix;
+
+        VARYING_OUT vec3 v_worldPosition;
+        VARYING_OUT vec3 v_normal;
+
+        void main()
+        {
+            vec4 worldPosition = u_worldMatrix * a_position;
+            v_worldPosition = worldPosition.xyz;
+            v_normal = mat3(u_worldMatrix) * a_normal;
+
+            gl_Position = u_viewProjectionMatrix * worldPosition;
+        })";
+
+    const std::string LitFragment =
+        R"(
+        OUTPUT
+
+        #include CAMERA_UBO
+        #include CLUSTERED_LIGHTS
+
+        uniform vec4 u_colour = vec4(1.0);
+
+        VARYING_IN vec3 v_worldPosition;
+        VARYING_IN vec3 v_normal;
+
+        const vec3 AmbientColour = vec3(0.04, 0.04, 0.06);
+
+        void main()
+        {
+            vec3 normal = normalize(v_normal);
+            vec3 lightColour = AmbientColour;
+        #if defined(CLUSTERED_LIGHTS)
+            lightColour += getClusteredLighting(v_worldPosition, normal);
+        #endif
+            FRAG_OUT = vec4(u_colour.rgb * lightColour, 1.0);
+        })";
+
+    struct ShaderID final
+    {
+        enum
+        {
+            ClusterLit
+        };
+    };
+
+    //must be no more than ModelRenderer::MaxClusteredLights
+    constexpr std::size_t LightCount = 200;
+    constexpr float FieldSize = 60.f;
+    constexpr std::int32_t BlockCount = 12;
+}
+
+ClusteredState::ClusteredState(cro::StateStack& stack, cro::State::Context context)
+    : cro::State    (stack, context),
+    m_gameScene     (context.appInstance.getMessageBus()),
+    m_animateLights (true)
+{
+    context.mainWindow.loadResources([this]() {
+        addSystems();
+        loadAssets();
+        createScene();
+        createUI();
+    });
+}
+
+//public
+bool ClusteredState::handleEvent(const cro::Event& evt)
+{
+    if (cro::ui::wantsMouse() || cro::ui::wantsKeyboard())
+    {
+        return true;
+    }
+
+    if (evt.type == SDL_KEYUP)
+    {
+        switch (evt.key.keysym.sym)
+        {
+        default: break;
+        case SDLK_BACKSPACE:
+        case SDLK_ESCAPE:
+            requestStackClear();
+            requestStackPush(States::ScratchPad::MainMenu);
+            break;
+        }
+    }
+
+    m_gameScene.forwardEvent(evt);
+    return true;
+}
+
+void ClusteredState::handleMessage(const cro::Message& msg)
+{
+    m_gameScene.forwardMessage(msg);
+}
+
+bool ClusteredState::simulate(float dt)
+{
+    m_gameScene.simulate(dt);
+    return true;
+}
+
+void ClusteredState::render()
+{
+    //there's no light map to update - all lighting
+    //is done when the ModelRenderer draws the scene
+    m_gameScene.render();
+}
+
+//private
+void ClusteredState::addSystems()
+{
+    auto& mb = getContext().appInstance.getMessageBus();
+
+    m_gameScene.addSystem<cro::CallbackSystem>(mb);
+    m_gameScene.addSystem<cro::CameraSystem>(mb);
+    //only used to cull the lights, so updateTarget() is never called
+    m_gameScene.addSystem<cro::LightVolumeSystem>(mb, cro::LightVolume::WorldSpace);
+    m_gameScene.addSystem<cro::ModelRenderer>(mb);
+}
+
+void ClusteredState::loadAssets()
+{
+    m_resources.shaders.loadFromString(ShaderID::ClusterLit, LitVertex, LitFragment);
+}
+
+void ClusteredState::createScene()
+{
+    auto materialID = m_resources.materials.add(m_resources.shaders.get(ShaderID::ClusterLit));
+
+    //ground
+    auto meshID = m_resources.meshes.loadMesh(cro::CubeBuilder(glm::vec3(FieldSize, 0.5f, FieldSize)));
+    auto material = m_resources.materials.get(materialID);
+    material.setProperty("u_colour", cro::Colour(0.7f, 0.7f, 0.7f));
+
+    auto entity = m_gameScene.createEntity();
+    entity.addComponent<cro::Transform>().setPosition({ 0.f, -0.25f, 0.f });
+    entity.addComponent<cro::Model>(m_resources.meshes.getMesh(meshID), material);
+
+    //blocks of random height to catch the light
+    meshID = m_resources.meshes.loadMesh(cro::CubeBuilder());
+    material.setProperty("u_colour", cro::Colour::White);
+
+    static constexpr float BlockSpacing = FieldSize / BlockCount;
+    for (auto y = 0; y < BlockCount; ++y)
+    {
+        for (auto x = 0; x < BlockCount; ++x)
+        {
+            const float height = cro::Util::Random::value(0.5f, 4.f);
+            const glm::vec3 position(
+                ((static_cast<float>(x) + 0.5f) * BlockSpacing) - (FieldSize / 2.f),
+                height / 2.f,
+                ((static_cast<float>(y) + 0.5f) * BlockSpacing) - (FieldSize / 2.f));
+
+            entity = m_gameScene.createEntity();
+            entity.addComponent<cro::Transform>().setPosition(position);
+            entity.getComponent<cro::Transform>().setScale({ 1.5f, height, 1.5f });
+            entity.addComponent<cro::Model>(m_resources.meshes.getMesh(meshID), material);
+        }
+    }
+
+    //lights - the LightVolumeSystem culls these against
+    //the sphere mesh, which is scaled to the light radius
+    meshID = m_resources.meshes.loadMesh(cro::SphereBuilder(1.f, 4));
+    for (auto i = 0u; i < LightCount; ++i)
+    {
+        const glm::vec3 centre(
+            cro::Util::Random::value(-FieldSize / 2.f, FieldSize / 2.f),
+            cro::Util::Random::value(0.5f, 2.5f),
+            cro::Util::Random::value(-FieldSize / 2.f, FieldSize / 2.f));
+        const float radius = cro::Util::Random::value(3.f, 6.f);
+
+        entity = m_gameScene.createEntity();
+        entity.addComponent<cro::Transform>().setPosition(centre);
+        entity.getComponent<cro::Transform>().setScale(glm::vec3(radius));
+        entity.addComponent<cro::LightVolume>().radius = radius;
+        entity.getComponent<cro::LightVolume>().colour = cro::Colour(
+            cro::Util::Random::value(0.2f, 1.f),
+            cro::Util::Random::value(0.2f, 1.f),
+            cro::Util::Random::value(0.2f, 1.f));
+        entity.addComponent<cro::Model>(m_resources.meshes.getMesh(meshID), m_resources.materials.get(materialID));
+        entity.getComponent<cro::Model>().setHidden(true);
+
+        const float orbitRadius = cro::Util::Random::value(1.f, 4.f);
+        const float speed = cro::Util::Random::value(-1.5f, 1.5f);
+        entity.addComponent<cro::Callback>().active = true;
+        entity.getComponent<cro::Callback>().function =
+            [&, centre, orbitRadius, speed](cro::Entity e, float dt) mutable
+        {
+            if (m_animateLights)
+            {
+                auto& rotation = std::any_cast<float&>(e.getComponent<cro::Callback>().userData);
+                rotation += speed * dt;
+
+                e.getComponent<cro::Transform>().setPosition(centre + glm::vec3(std::cos(rotation) * orbitRadius, 0.f, std::sin(rotation) * orbitRadius));
+            }
+        };
+        entity.getComponent<cro::Callback>().userData = std::make_any<float>(cro::Util::Random::value(0.f, cro::Util::Const::TAU));
+    }
+
+    auto camEnt = m_gameScene.getActiveCamera();
+    camEnt.getComponent<cro::Transform>().setPosition({ 0.f, 18.f, 36.f });
+    camEnt.getComponent<cro::Transform>().setRotation(cro::Transform::X_AXIS, -0.5f);
+
+    auto& cam = camEnt.getComponent<cro::Camera>();
+    updateView(cam);
+    cam.resizeCallback = std::bind(&ClusteredState::updateView, this, std::placeholders::_1);
+}
+
+void ClusteredState::createUI()
+{
+    registerWindow([&]()
+        {
+            if (ImGui::Begin("Clustered Lights"))
+            {
+                const auto drawListIndex = m_gameScene.getActiveCamera().getComponent<cro::Camera>().getDrawListIndex();
+                const auto& visibleLights = m_gameScene.getSystem<cro::LightVolumeSystem>()->getDrawList(drawListIndex);
+
+                ImGui::Text("Visible Lights: %u", static_cast<std::uint32_t>(visibleLights.size()));
+                ImGui::Text("Clustered Lights: %u", static_cast<std::uint32_t>(m_gameScene.getSystem<cro::ModelRenderer>()->getClusteredLightCount(drawListIndex)));
+                ImGui::Checkbox("Animate", &m_animateLights);
+            }
+            ImGui::End();
+        });
+}
+
+void ClusteredState::updateView(cro::Camera& cam3D)
+{
+    glm::vec2 size(cro::App::getWindow().getSize());
+    size.y = ((size.x / 16.f) * 9.f) / size.y;
+    size.x = 1.f;
+
+    cam3D.setPerspective(50.6f * cro::Util::Const::degToRad, 16.f / 9.f, 0.1f, 140.f);
+    cam3D.viewport.bottom = (1.f - size.y) / 2.f;
+    cam3D.viewport.height = size.y;
+}
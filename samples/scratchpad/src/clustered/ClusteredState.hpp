@@ -0,0 +1,74 @@
+/*-----------------------------------------------------------------------
+
+Matt Marchant 2026
+http://trederia.blogspot.com
+
+crogine application - Zlib license.
+
+This software is provided 'as-is', without any express or
+implied warranty.In no event will the authors be held
+liable for any damages arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute
+it freely, subject to the following restrictions :
+
+1. The origin of this software must not be misrepresented;
+you must not claim that you wrote the original software.
+If you use this software in a product, an acknowledgment
+in the product documentation would be appreciated but
+is not required.
+
+2. Altered source versions must be plainly marked as such,
+and must not be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any
+source distribution.
+
+-----------------------------------------------------------------------*/
+
+#pragma once
+
+#include "../StateIDs.hpp"
+
+#include <crogine/core/State.hpp>
+#include <crogine/ecs/Scene.hpp>
+#include <crogine/gui/GuiClient.hpp>
+#include <crogine/graphics/ModelDefinition.hpp>
+
+namespace cro
+{
+    struct Camera;
+}
+
+/*
+Forward lights a field of blocks with a couple of hundred moving point
+lights via the CLUSTERED_LIGHTS shader include. Unlike the SSAO state no
+position/normal buffers or light map pass are needed, the ModelRenderer
+bins the LightVolumes found visible by the LightVolumeSystem itself.
+*/
+class ClusteredState final : public cro::State, public cro::GuiClient
+{
+public:
+    ClusteredState(cro::StateStack&, cro::State::Context);
+
+    cro::StateID getStateID() const override { return States::ScratchPad::ClusteredLights; }
+
+    bool handleEvent(const cro::Event&) override;
+    void handleMessage(const cro::Message&) override;
+    bool simulate(float) override;
+    void render() override;
+
+private:
+
+    cro::Scene m_gameScene;
+    cro::ResourceCollection m_resources;
+
+    bool m_animateLights;
+
+    void addSystems();
+    void loadAssets();
+    void createScene();
+    void createUI();
+    void updateView(cro::Camera&);
+};